@@ -0,0 +1,74 @@
+/*
+ * Copyright 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+/**
+ * @file memstat_decoder.hpp
+ * @brief Replay of memory statistics file written by the driver
+ */
+
+#pragma once
+
+#include "stats_record.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace memstat {
+
+constexpr size_t CATEGORY_COUNT = static_cast<size_t>(MemoryStatsCategory::Count);
+
+struct Peak {
+    int64_t size = 0;
+    uint64_t timestamp_ns = 0;
+};
+
+/**
+ * @brief Allocated size rebuilt from the event stream, together with the last system sample
+ */
+class MemoryReplay {
+public:
+    explicit MemoryReplay(uint64_t start_ns) : start_ns_(start_ns) {}
+
+    void apply(const MemoryStatsRecord& record);
+    void writeTimelineHeader(FILE* out) const;
+    void writeTimelineRow(FILE* out) const;
+    void printReport(FILE* out) const;
+
+private:
+    static void updatePeak(Peak& peak, int64_t size, uint64_t timestamp_ns);
+    double toSeconds(uint64_t timestamp_ns) const;
+
+    uint64_t start_ns_;
+    uint64_t last_ns_ = 0;
+    std::array<int64_t, CATEGORY_COUNT> current_ = {};
+    std::array<Peak, CATEGORY_COUNT> peaks_ = {};
+    int64_t total_ = 0;
+    Peak total_peak_;
+    uint64_t sys_used_ram_ = 0;
+    uint64_t sys_shared_ram_ = 0;
+    uint64_t sys_used_swap_ = 0;
+    uint64_t sys_used_high_ = 0;
+    uint64_t max_rss_ = 0;
+    uint64_t user_time_us_ = 0;
+    uint64_t system_time_us_ = 0;
+    uint64_t allocs_ = 0;
+    uint64_t frees_ = 0;
+    uint64_t dropped_ = 0;
+    uint64_t invalid_records_ = 0;
+};
+
+/**
+ * @brief Decode the statistics file, print peak usage report to report and, if timeline is not
+ * null, the allocated size after each event in CSV format
+ *
+ * @return 0 on success, 1 if the file can not be decoded
+ */
+int decodeMemoryStats(const std::string& input_file, FILE* report, FILE* timeline);
+
+}  // namespace memstat
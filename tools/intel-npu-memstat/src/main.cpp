@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+/**
+ * @file main.cpp
+ * @brief Intel NPU memory statistics decoder
+ *
+ * Decodes the binary file written by the driver when ZE_INTEL_NPU_DUMP_MEM_STAT is set. Events are
+ * replayed to rebuild allocated size per memory category. The tool prints a peak usage report and
+ * optionally exports the timeline to CSV file.
+ */
+
+#include "memstat_decoder.hpp"
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <getopt.h>
+
+namespace {
+
+constexpr const char* VERSION = "1.0.0";
+
+void printUsage(const char* program_name) {
+    std::cout << "Intel NPU Memory Statistics Decoder v" << VERSION << "\n\n"
+              << "Usage: " << program_name << " [OPTIONS] <file>\n\n"
+              << "Options:\n"
+              << "  --timeline <file>     Export allocated size after each event to CSV file\n"
+              << "  -h, --help            Display this help message\n"
+              << "  --version             Display version information\n\n"
+              << "Examples:\n"
+              << "  " << program_name << " mem_stat.bin                      Print peak usage report\n"
+              << "  " << program_name << " --timeline out.csv mem_stat.bin   Also export timeline\n";
+}
+
+void printVersion() {
+    std::cout << "Intel NPU Memory Statistics Decoder v" << VERSION << "\n"
+              << "Copyright 2026 Intel Corporation\n";
+}
+
+struct Config {
+    std::string input_file;
+    std::string timeline_file;
+};
+
+/**
+ * @brief Result of argument parsing
+ */
+struct ParseResult {
+    Config config;
+    bool should_exit = false;
+    int exit_code = 0;
+};
+
+ParseResult parseArguments(int argc, char* argv[]) {
+    ParseResult result;
+
+    static struct option long_options[] = {
+        {"timeline", required_argument, nullptr, 1},
+        {"help",     no_argument,       nullptr, 'h'},
+        {"version",  no_argument,       nullptr, 2},
+        {nullptr,    0,                 nullptr, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "h", long_options, nullptr)) != -1) {
+        switch (opt) {
+            case 1:  // --timeline
+                result.config.timeline_file = optarg;
+                break;
+            case 'h':
+                printUsage(argv[0]);
+                return {result.config, true, 0};
+            case 2:  // --version
+                printVersion();
+                return {result.config, true, 0};
+            default:
+                printUsage(argv[0]);
+                return {result.config, true, 1};
+        }
+    }
+
+    if (optind + 1 != argc) {
+        printUsage(argv[0]);
+        return {result.config, true, 1};
+    }
+    result.config.input_file = argv[optind];
+
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    auto parsed = parseArguments(argc, argv);
+    if (parsed.should_exit) {
+        return parsed.exit_code;
+    }
+    auto config = parsed.config;
+
+    FILE* timeline = nullptr;
+    if (!config.timeline_file.empty()) {
+        timeline = fopen(config.timeline_file.c_str(), "w");
+        if (timeline == nullptr) {
+            fprintf(stderr, "Error: Failed to open %s for writing\n", config.timeline_file.c_str());
+            return 1;
+        }
+    }
+
+    int ret = memstat::decodeMemoryStats(config.input_file, stdout, timeline);
+    if (timeline) {
+        fclose(timeline);
+    }
+    return ret;
+}
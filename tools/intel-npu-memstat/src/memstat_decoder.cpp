@@ -0,0 +1,198 @@
+/*
+ * Copyright 2026 Intel Corporation.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "memstat_decoder.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace memstat {
+
+namespace {
+
+constexpr const char* CATEGORY_NAMES[CATEGORY_COUNT] = {"device", "host", "shared", "internal"};
+
+double microsecondsToSeconds(uint64_t time_us) {
+    return static_cast<double>(time_us) / 1e6;
+}
+
+}  // namespace
+
+void MemoryReplay::apply(const MemoryStatsRecord& record) {
+    switch (record.event) {
+        case MemoryStatsEvent::Alloc:
+        case MemoryStatsEvent::Free: {
+            auto index = static_cast<size_t>(record.category);
+            if (index >= CATEGORY_COUNT) {
+                invalid_records_++;
+                return;
+            }
+            auto delta = static_cast<int64_t>(record.value);
+            if (record.event == MemoryStatsEvent::Alloc) {
+                current_[index] += delta;
+                total_ += delta;
+                allocs_++;
+            } else {
+                current_[index] -= delta;
+                total_ -= delta;
+                frees_++;
+            }
+            updatePeak(peaks_[index], current_[index], record.timestampNs);
+            updatePeak(total_peak_, total_, record.timestampNs);
+            break;
+        }
+        case MemoryStatsEvent::SystemUsedRam:
+            sys_used_ram_ = record.value;
+            break;
+        case MemoryStatsEvent::SystemSharedRam:
+            sys_shared_ram_ = record.value;
+            break;
+        case MemoryStatsEvent::SystemUsedSwap:
+            sys_used_swap_ = record.value;
+            break;
+        case MemoryStatsEvent::SystemUsedHigh:
+            sys_used_high_ = record.value;
+            break;
+        case MemoryStatsEvent::ProcessMaxRss:
+            max_rss_ = record.value;
+            break;
+        case MemoryStatsEvent::ProcessUserTime:
+            user_time_us_ = record.value;
+            break;
+        case MemoryStatsEvent::ProcessSystemTime:
+            system_time_us_ = record.value;
+            break;
+        case MemoryStatsEvent::Dropped:
+            dropped_ += record.value;
+            break;
+        default:
+            invalid_records_++;
+            return;
+    }
+    last_ns_ = record.timestampNs;
+}
+
+void MemoryReplay::writeTimelineHeader(FILE* out) const {
+    fprintf(out, "time[s]");
+    for (auto name : CATEGORY_NAMES) {
+        fprintf(out, ",%s", name);
+    }
+    fprintf(out,
+            ",total,sysUsedRam,sysSharedRam,sysUsedSwap,sysUsedHigh,maxRss,userTime[s],"
+            "sysTime[s]\n");
+}
+
+void MemoryReplay::writeTimelineRow(FILE* out) const {
+    fprintf(out, "%.6f", toSeconds(last_ns_));
+    for (auto size : current_) {
+        fprintf(out, ",%ld", size);
+    }
+    fprintf(out,
+            ",%ld,%lu,%lu,%lu,%lu,%lu,%.6f,%.6f\n",
+            total_,
+            sys_used_ram_,
+            sys_shared_ram_,
+            sys_used_swap_,
+            sys_used_high_,
+            max_rss_,
+            microsecondsToSeconds(user_time_us_),
+            microsecondsToSeconds(system_time_us_));
+}
+
+void MemoryReplay::printReport(FILE* out) const {
+    fprintf(out, "Duration:        %.3f s\n", toSeconds(last_ns_));
+    fprintf(out, "Allocations:     %lu\n", allocs_);
+    fprintf(out, "Frees:           %lu\n", frees_);
+    fprintf(out, "Dropped events:  %lu\n", dropped_);
+    if (invalid_records_ > 0) {
+        fprintf(out, "Invalid records: %lu\n", invalid_records_);
+    }
+    fprintf(out, "Max RSS:         %lu B\n", max_rss_);
+    fprintf(out, "User time:       %.6f s\n", microsecondsToSeconds(user_time_us_));
+    fprintf(out, "System time:     %.6f s\n\n", microsecondsToSeconds(system_time_us_));
+
+    fprintf(out, "%-10s %16s %12s %16s\n", "Category", "Peak [B]", "At [s]", "Final [B]");
+    for (size_t i = 0; i < CATEGORY_COUNT; i++) {
+        fprintf(out,
+                "%-10s %16ld %12.6f %16ld\n",
+                CATEGORY_NAMES[i],
+                peaks_[i].size,
+                toSeconds(peaks_[i].timestamp_ns),
+                current_[i]);
+    }
+    fprintf(out,
+            "%-10s %16ld %12.6f %16ld\n",
+            "total",
+            total_peak_.size,
+            toSeconds(total_peak_.timestamp_ns),
+            total_);
+
+    if (dropped_ > 0) {
+        fprintf(out,
+                "\nWarning: %lu events were dropped, allocated sizes may be inaccurate\n",
+                dropped_);
+    }
+}
+
+void MemoryReplay::updatePeak(Peak& peak, int64_t size, uint64_t timestamp_ns) {
+    if (size > peak.size) {
+        peak.size = size;
+        peak.timestamp_ns = timestamp_ns;
+    }
+}
+
+double MemoryReplay::toSeconds(uint64_t timestamp_ns) const {
+    if (timestamp_ns < start_ns_) {
+        return 0.0;
+    }
+    return static_cast<double>(timestamp_ns - start_ns_) / 1e9;
+}
+
+int decodeMemoryStats(const std::string& input_file, FILE* report, FILE* timeline) {
+    std::ifstream input(input_file, std::ios::binary);
+    if (!input) {
+        fprintf(stderr, "Error: Failed to open %s\n", input_file.c_str());
+        return 1;
+    }
+
+    MemoryStatsHeader header = {};
+    if (!input.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        memcmp(header.magic, memoryStatsMagic, sizeof(header.magic)) != 0) {
+        fprintf(stderr, "Error: %s is not NPU memory statistics file\n", input_file.c_str());
+        return 1;
+    }
+    if (header.version != memoryStatsVersion || header.recordSize != sizeof(MemoryStatsRecord)) {
+        fprintf(stderr,
+                "Error: Unsupported file version %u (record size %u), expected %u (record size %zu)\n",
+                header.version,
+                header.recordSize,
+                memoryStatsVersion,
+                sizeof(MemoryStatsRecord));
+        return 1;
+    }
+
+    MemoryReplay replay(header.startTimestampNs);
+    if (timeline) {
+        replay.writeTimelineHeader(timeline);
+    }
+
+    MemoryStatsRecord record = {};
+    while (input.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        replay.apply(record);
+        if (timeline) {
+            replay.writeTimelineRow(timeline);
+        }
+    }
+    if (input.gcount() != 0) {
+        fprintf(stderr, "Warning: Truncated record at the end of %s\n", input_file.c_str());
+    }
+
+    replay.printReport(report);
+    return 0;
+}
+
+}  // namespace memstat
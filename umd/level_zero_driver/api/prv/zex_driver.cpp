@@ -8,9 +8,12 @@
 #include "level_zero_driver/api/prv/zex_driver.hpp"
 
 #include "level_zero_driver/api/zet_misc.hpp"
+#include "level_zero_driver/include/l0_exception.hpp"
+#include "level_zero_driver/source/cmdqueue.hpp"
 #include "level_zero_driver/source/context.hpp"
 #include "level_zero_driver/source/driver.hpp"
 #include "level_zero_driver/source/ext/disk_cache.hpp"
+#include "level_zero_driver/source/ext/graph.hpp"
 
 #include <filesystem>
 #include <loader/ze_loader.h>
@@ -55,4 +58,69 @@ ze_result_t ZE_APICALL zexContextSetIdlePruningTimeout(ze_context_handle_t hCont
     L0::Context::fromHandle(hContext)->setIdlePruningTimeout(timeoutMs);
     return ZE_RESULT_SUCCESS;
 }
+
+ze_result_t ZE_APICALL zexCommandQueueGetCompletionEventFd(ze_command_queue_handle_t hCommandQueue,
+                                                           int *pEventFd) {
+    if (hCommandQueue == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    if (pEventFd == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    auto ret = L0::translateHandle(ZEL_HANDLE_COMMAND_QUEUE, hCommandQueue);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    return L0::CommandQueue::fromHandle(hCommandQueue)->getCompletionEventFd(pEventFd);
+}
+
+ze_result_t ZE_APICALL zexCommandQueueGetThrottleStats(ze_command_queue_handle_t hCommandQueue,
+                                                       uint64_t *pCount,
+                                                       uint64_t *pTimeNs) {
+    if (hCommandQueue == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    if (pCount == nullptr || pTimeNs == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    auto ret = L0::translateHandle(ZEL_HANDLE_COMMAND_QUEUE, hCommandQueue);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    return L0::CommandQueue::fromHandle(hCommandQueue)->getThrottleStats(pCount, pTimeNs);
+}
+
+ze_result_t ZE_APICALL zexGraphCreateAsync(ze_context_handle_t hContext,
+                                           ze_device_handle_t hDevice,
+                                           const ze_graph_desc_2_t *desc,
+                                           ze_event_handle_t hEvent,
+                                           ze_graph_handle_t *phGraph,
+                                           ze_graph_build_log_handle_t *phGraphBuildLog) {
+    if (hContext == nullptr || hDevice == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+
+    auto ret = L0::translateHandle(ZEL_HANDLE_CONTEXT, hContext);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    ret = L0::translateHandle(ZEL_HANDLE_DEVICE, hDevice);
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    if (hEvent != nullptr) {
+        ret = L0::translateHandle(ZEL_HANDLE_EVENT, hEvent);
+        if (ret != ZE_RESULT_SUCCESS)
+            return ret;
+    }
+
+    L0_HANDLE_EXCEPTION_AND_RETURN(
+        L0::Graph::createAsync(hContext, hDevice, desc, hEvent, phGraph, phGraphBuildLog));
+}
+
+ze_result_t ZE_APICALL zexGraphGetBuildStatus(ze_graph_handle_t hGraph) {
+    if (hGraph == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+
+    // Loader has no graph handle type, graph handles are passed to the driver as created, like
+    // in zeGraph functions
+    L0_HANDLE_EXCEPTION_AND_RETURN(L0::Graph::fromHandle(hGraph)->getBuildStatus());
+}
 }
@@ -4,15 +4,69 @@
  * SPDX-License-Identifier: MIT
  *
  */
+#pragma once
+
 #include <stddef.h>
 #include <stdint.h>
 
 #include <ze_api.h>
+#include <ze_graph_ext.h>
 
 extern "C" {
+typedef enum _zex_structure_type_t {
+    ZEX_STRUCTURE_TYPE_COMMAND_QUEUE_PIPELINED_DESC = 0x7fff0001,
+    ZEX_STRUCTURE_TYPE_COMMAND_QUEUE_WAIT_POLICY_DESC = 0x7fff0002,
+    ZEX_STRUCTURE_TYPE_FORCE_UINT32 = 0x7fffffff
+} zex_structure_type_t;
+
+// Passed in pNext chain of ze_command_queue_desc_t to zeCommandListCreateImmediate. Appends do not
+// wait for previous submissions unless maxInFlightJobs jobs are still executing on the device.
+// Then the append blocks until the oldest job completes, like every append of a command list that
+// is not pipelined. A job waiting on an event signaled by the host after the append is not handled,
+// such events have to be signaled before the window fills up.
+typedef struct _zex_command_queue_pipelined_desc_t {
+    zex_structure_type_t stype;
+    const void *pNext;
+    uint32_t maxInFlightJobs;
+} zex_command_queue_pipelined_desc_t;
+
+// Passed in pNext chain of ze_command_queue_desc_t to zeCommandQueueCreate or
+// zeCommandListCreateImmediate. Host waiters busy wait for a job at most spinBudgetUs microseconds,
+// and only when the job is expected to finish within that time. Expected job duration is the
+// percentileTarget percentile of durations observed on the queue. Zero spinBudgetUs disables
+// busy waiting, also for turbo queues.
+typedef struct _zex_command_queue_wait_policy_desc_t {
+    zex_structure_type_t stype;
+    const void *pNext;
+    uint32_t spinBudgetUs;
+    uint32_t percentileTarget;
+} zex_command_queue_wait_policy_desc_t;
+
 ze_result_t ZE_APICALL zexDiskCacheSetSize(size_t size);
 ze_result_t ZE_APICALL zexDiskCacheGetSize(size_t *size);
 ze_result_t ZE_APICALL zexDiskCacheGetDirectory(char *path, size_t *len);
 ze_result_t ZE_APICALL zexContextSetIdlePruningTimeout(ze_context_handle_t hContext,
                                                        uint64_t timeoutMs);
+// Returns eventfd that is signaled for every command buffer completed on the queue after this call.
+// The eventfd is non blocking and owned by the driver, it can be added to epoll set by the caller.
+ze_result_t ZE_APICALL zexCommandQueueGetCompletionEventFd(ze_command_queue_handle_t hCommandQueue,
+                                                           int *pEventFd);
+// Returns number of submissions that waited for space in the firmware queue and the total time in
+// nanoseconds they spent waiting.
+ze_result_t ZE_APICALL zexCommandQueueGetThrottleStats(ze_command_queue_handle_t hCommandQueue,
+                                                       uint64_t *pCount,
+                                                       uint64_t *pTimeNs);
+// Creates graph like zeGraphCreate3, but returns the graph handle without waiting for the model
+// compilation. Graphs are built by a bounded pool of driver threads, set its size with
+// ZE_INTEL_NPU_GRAPH_BUILD_THREADS. hEvent is optional and it is signaled when the build completes.
+// Other graph functions return the build status until the build succeeds. The model in desc must
+// stay valid until then, destruction of the graph, its build log or the event waits for the build.
+ze_result_t ZE_APICALL zexGraphCreateAsync(ze_context_handle_t hContext,
+                                           ze_device_handle_t hDevice,
+                                           const ze_graph_desc_2_t *desc,
+                                           ze_event_handle_t hEvent,
+                                           ze_graph_handle_t *phGraph,
+                                           ze_graph_build_log_handle_t *phGraphBuildLog);
+// Returns ZE_RESULT_NOT_READY while the graph is built, the result of the build afterwards.
+ze_result_t ZE_APICALL zexGraphGetBuildStatus(ze_graph_handle_t hGraph);
 }
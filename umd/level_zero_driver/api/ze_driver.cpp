@@ -293,6 +293,10 @@ ze_result_t zeDriverGetExtensionFunctionAddress(ze_driver_handle_t hDriver,
     CHECK_PRIVATE_FUNCTION(zexDiskCacheGetSize);
     CHECK_PRIVATE_FUNCTION(zexDiskCacheGetDirectory);
     CHECK_PRIVATE_FUNCTION(zexContextSetIdlePruningTimeout);
+    CHECK_PRIVATE_FUNCTION(zexCommandQueueGetCompletionEventFd);
+    CHECK_PRIVATE_FUNCTION(zexCommandQueueGetThrottleStats);
+    CHECK_PRIVATE_FUNCTION(zexGraphCreateAsync);
+    CHECK_PRIVATE_FUNCTION(zexGraphGetBuildStatus);
 
     LOG_E("Driver Function Extension with %s name does not exist", name);
 exit:
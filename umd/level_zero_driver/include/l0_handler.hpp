@@ -14,6 +14,11 @@ namespace L0 {
 class IContextObject {
   public:
     virtual ~IContextObject() = default;
+
+    /**
+     * Release memory cached by object that can be recreated on demand
+     */
+    virtual void releaseMemory() {}
 };
 
 } // namespace L0
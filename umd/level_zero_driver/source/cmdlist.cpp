@@ -134,6 +134,57 @@ ze_result_t CommandList::checkCommandAppendCondition() {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t
+CommandList::appendCommandWithEvents(ze_event_handle_t hSignalEvent,
+                                     uint32_t numWaitEvents,
+                                     ze_event_handle_t *phWaitEvents,
+                                     std::vector<std::shared_ptr<VPU::VPUCommand>> commands) {
+    if (numWaitEvents > 0) {
+        if (phWaitEvents == nullptr) {
+            LOG_E("Invalid wait event input. phWaitEvents: %p, numWaitEvents: %u",
+                  phWaitEvents,
+                  numWaitEvents);
+            return ZE_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        ze_result_t result = appendWaitOnEvents(numWaitEvents, phWaitEvents);
+        if (result != ZE_RESULT_SUCCESS) {
+            LOG_E("Failed to add %u wait on events.", numWaitEvents);
+            return result;
+        }
+    }
+
+    for (auto &cmd : commands) {
+        if (!vpuJob->appendCommand(cmd)) {
+            LOG_E("Command(%#x) failed to push to list!", cmd->getCommandType());
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+
+        LOG(CMDLIST,
+            "Successfully appended the command(%#x) to CommandList",
+            cmd->getCommandType());
+    }
+
+    if (hSignalEvent != nullptr) {
+        ze_result_t result = appendSignalEvent(hSignalEvent);
+        if (result != ZE_RESULT_SUCCESS) {
+            LOG_E("Failed to append signal event command (handle: %p, error: %#x).",
+                  hSignalEvent,
+                  result);
+            return result;
+        }
+    }
+
+    LOG(CMDLIST,
+        "Successfully appended %lu commands with hSignal(%p), %u wait events(%p).",
+        commands.size(),
+        hSignalEvent,
+        numWaitEvents,
+        phWaitEvents);
+
+    return postAppend();
+}
+
 ze_result_t CommandList::appendBarrier(ze_event_handle_t hSignalEvent,
                                        uint32_t numWaitEvents,
                                        ze_event_handle_t *phWaitEvents) {
@@ -188,18 +239,37 @@ ze_result_t CommandList::appendMemoryFill(void *ptr,
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
+    uint32_t fillPattern = 0;
+    switch (patternSize) {
+    case sizeof(uint32_t):
+        fillPattern = *reinterpret_cast<const uint32_t *>(pattern);
+        break;
+
+    case sizeof(uint16_t):
+        fillPattern = *reinterpret_cast<const uint16_t *>(pattern);
+        fillPattern |= fillPattern << 16;
+        break;
+
+    case sizeof(uint8_t):
+        memset(reinterpret_cast<uint8_t *>(&fillPattern),
+               *static_cast<const uint8_t *>(pattern),
+               sizeof(fillPattern));
+        break;
+    default:
+        LOG_E("Unsupported pattern size");
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
     if (ctx->getDeviceCapabilities().npuArch >= VPU::NPU40XX)
         return appendMemoryFillCmd(ptr,
-                                   pattern,
-                                   patternSize,
+                                   fillPattern,
                                    size,
                                    hSignalEvent,
                                    numWaitEvents,
                                    phWaitEvents);
     else
         return appendMemoryFillAsCopyCmd(ptr,
-                                         pattern,
-                                         patternSize,
+                                         fillPattern,
                                          size,
                                          hSignalEvent,
                                          numWaitEvents,
@@ -207,33 +277,11 @@ ze_result_t CommandList::appendMemoryFill(void *ptr,
 }
 
 ze_result_t CommandList::appendMemoryFillCmd(void *ptr,
-                                             const void *pattern,
-                                             size_t patternSize,
+                                             uint32_t fillPattern,
                                              size_t size,
                                              ze_event_handle_t hSignalEvent,
                                              uint32_t numWaitEvents,
                                              ze_event_handle_t *phWaitEvents) {
-    uint32_t fill_pattern = 0;
-    switch (patternSize) {
-    case sizeof(uint32_t):
-        fill_pattern = *reinterpret_cast<const uint32_t *>(pattern);
-        break;
-
-    case sizeof(uint16_t):
-        fill_pattern = *reinterpret_cast<const uint16_t *>(pattern);
-        fill_pattern |= fill_pattern << 16;
-        break;
-
-    case sizeof(uint8_t):
-        memset(reinterpret_cast<uint8_t *>(&fill_pattern),
-               *static_cast<const uint8_t *>(pattern),
-               sizeof(fill_pattern));
-        break;
-    default:
-        LOG_E("Unsupported pattern size");
-        return ZE_RESULT_ERROR_INVALID_SIZE;
-    }
-
     auto ptrBo = ctx->findBufferObject(ptr);
     if (ptrBo == nullptr) {
         LOG_E("Buffer object not found");
@@ -257,7 +305,7 @@ ze_result_t CommandList::appendMemoryFillCmd(void *ptr,
             static_cast<uint8_t *>(ptr) + offset,
             ptrBo,
             fillSize,
-            fill_pattern);
+            fillPattern);
         if (result != ZE_RESULT_SUCCESS) {
             LOG_E("Failed to append fill command to list");
             break;
@@ -271,8 +319,7 @@ ze_result_t CommandList::appendMemoryFillCmd(void *ptr,
 }
 
 ze_result_t CommandList::appendMemoryFillAsCopyCmd(void *ptr,
-                                                   const void *pattern,
-                                                   size_t patternSize,
+                                                   uint32_t fillPattern,
                                                    size_t size,
                                                    ze_event_handle_t hSignalEvent,
                                                    uint32_t numWaitEvents,
@@ -281,28 +328,27 @@ ze_result_t CommandList::appendMemoryFillAsCopyCmd(void *ptr,
     if (result != ZE_RESULT_SUCCESS)
         return result;
 
-    auto patternBo =
-        ctx->createUntrackedBufferObject(size + patternSize, VPU::VPUBufferObject::Type::CachedDma);
+    auto fillBo = ctx->findBufferObject(ptr);
+    if (fillBo == nullptr) {
+        LOG_E("Buffer object not found");
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    auto patternBo = ctx->fillPatternCacheAcquire(fillPattern);
     if (patternBo == nullptr) {
-        LOG_E("Failed to allocate memory");
+        LOG_E("Failed to acquire fill pattern buffer");
         return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
     }
 
-    if (!patternBo->fillBuffer(pattern, patternSize)) {
-        LOG_E("Failed to fill memory");
+    // Implement fill by copying small pattern buffer once and doubling the filled part of user
+    // buffer with every next copy
+    auto commands = VPU::VPUCopyCommand::createFillSequence(ctx, patternBo, ptr, fillBo, size);
+    if (commands.empty()) {
+        LOG_E("Failed to create fill sequence");
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
-    // Implement fill by memory copy from internal filled buffer to user buffer.
-    auto fillBo = ctx->findBufferObject(ptr);
-    return appendCommandWithEvents<VPU::VPUCopyCommand>(hSignalEvent,
-                                                        numWaitEvents,
-                                                        phWaitEvents,
-                                                        ctx,
-                                                        patternBo->getBasePointer(),
-                                                        patternBo,
-                                                        ptr,
-                                                        std::move(fillBo),
-                                                        size);
+
+    return appendCommandWithEvents(hSignalEvent, numWaitEvents, phWaitEvents, std::move(commands));
 }
 
 ze_result_t CommandList::appendMemoryCopyRegion(void *dstptr,
@@ -316,8 +362,6 @@ ze_result_t CommandList::appendMemoryCopyRegion(void *dstptr,
                                                 ze_event_handle_t hSignalEvent,
                                                 uint32_t numWaitEvents,
                                                 ze_event_handle_t *phWaitEvents) {
-    ze_result_t result = ZE_RESULT_SUCCESS;
-
     if ((dstptr == nullptr) || (srcptr == nullptr)) {
         LOG_E("Source or destination pointer is nullptr");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -339,50 +383,67 @@ ze_result_t CommandList::appendMemoryCopyRegion(void *dstptr,
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    if (dstPitch < dstRegion->width) {
-        LOG_E("Invalid value for the destination pitch");
-        return ZE_RESULT_ERROR_INVALID_SIZE;
-    }
-
-    // Only support 2D copies for now
-    if ((dstSlicePitch != 0) || (srcSlicePitch != 0)) {
-        LOG_E("Slice pitch value other than 0 is not supported");
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    // Region without rows or slices is copied as no-op, no command is appended
+    if (dstRegion->height == 0 || dstRegion->depth == 0) {
+        LOG(CMDLIST, "Empty copy region, nothing to copy");
+        return ZE_RESULT_SUCCESS;
     }
 
-    if ((dstRegion->depth != 1) || (srcRegion->depth != 1)) {
-        LOG_E("The region depth value other than 1 is not supported");
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    // Row of the region can not continue to the next row
+    if (static_cast<size_t>(dstRegion->originX) + dstRegion->width > dstPitch) {
+        LOG_E("Invalid value for the destination pitch");
+        return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    if ((dstRegion->originZ != 0) || (srcRegion->originZ != 0)) {
-        LOG_E("The origin z offset other than 0 is not supported");
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    if (static_cast<size_t>(srcRegion->originX) + srcRegion->width > srcPitch) {
+        LOG_E("Invalid value for the source pitch");
+        return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    for (uint32_t y = 0; y < dstRegion->height; y++) {
-        uint32_t srcOffset = srcRegion->originX + (srcRegion->originY + y) * srcPitch;
-        uint32_t dstOffset = dstRegion->originX + (dstRegion->originY + y) * dstPitch;
+    // Slice pitch equal to 0 means that slice ends with the last row of the region
+    size_t srcSlice = srcSlicePitch;
+    if (srcSlice == 0)
+        srcSlice = static_cast<size_t>(srcRegion->originY + srcRegion->height) * srcPitch;
 
-        auto srcBo = ctx->findBufferObject(static_cast<const uint8_t *>(srcptr) + srcOffset);
-        auto dstBo = ctx->findBufferObject(static_cast<uint8_t *>(dstptr) + dstOffset);
+    size_t dstSlice = dstSlicePitch;
+    if (dstSlice == 0)
+        dstSlice = static_cast<size_t>(dstRegion->originY + dstRegion->height) * dstPitch;
 
-        result = appendCommandWithEvents<VPU::VPUCopyCommand>(
-            hSignalEvent,
-            numWaitEvents,
-            phWaitEvents,
-            ctx,
-            static_cast<const uint8_t *>(srcptr) + srcOffset,
-            std::move(srcBo),
-            static_cast<uint8_t *>(dstptr) + dstOffset,
-            std::move(dstBo),
-            dstRegion->width);
-        if (result != ZE_RESULT_SUCCESS) {
-            LOG_E("Failed to append copy command to list");
-            break;
-        }
+    if (dstRegion->depth > 1 && (srcSlice < static_cast<size_t>(srcRegion->height) * srcPitch ||
+                                 dstSlice < static_cast<size_t>(dstRegion->height) * dstPitch)) {
+        LOG_E("Invalid value for the slice pitch");
+        return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
+    size_t srcOffset = srcRegion->originX + static_cast<size_t>(srcRegion->originY) * srcPitch +
+                       static_cast<size_t>(srcRegion->originZ) * srcSlice;
+    size_t dstOffset = dstRegion->originX + static_cast<size_t>(dstRegion->originY) * dstPitch +
+                       static_cast<size_t>(dstRegion->originZ) * dstSlice;
+    const uint8_t *srcStart = static_cast<const uint8_t *>(srcptr) + srcOffset;
+    uint8_t *dstStart = static_cast<uint8_t *>(dstptr) + dstOffset;
+
+    VPU::VPUCopyRegion region = {.width = dstRegion->width,
+                                 .height = dstRegion->height,
+                                 .depth = dstRegion->depth,
+                                 .srcPitch = srcPitch,
+                                 .srcSlicePitch = srcSlice,
+                                 .dstPitch = dstPitch,
+                                 .dstSlicePitch = dstSlice};
+
+    // Region is copied by single command, buffer objects are resolved only for region start
+    ze_result_t result =
+        appendCommandWithEvents<VPU::VPUCopyCommand>(hSignalEvent,
+                                                     numWaitEvents,
+                                                     phWaitEvents,
+                                                     ctx,
+                                                     srcStart,
+                                                     ctx->findBufferObject(srcStart),
+                                                     dstStart,
+                                                     ctx->findBufferObject(dstStart),
+                                                     region);
+    if (result != ZE_RESULT_SUCCESS)
+        LOG_E("Failed to append copy region command to list");
+
     return result;
 }
 
@@ -502,6 +563,12 @@ ze_result_t CommandList::appendGraphInitialize(ze_graph_handle_t hGraph,
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
 
+    result = graph->getBuildStatus();
+    if (result != ZE_RESULT_SUCCESS) {
+        LOG_E("Graph is not built, status: %#x", result);
+        return result;
+    }
+
     auto cmd = graph->allocateGraphInitCommand(ctx);
     if (cmd == nullptr) {
         LOG_E("Graph-Initialize Command failed to be initialized!");
@@ -565,6 +632,12 @@ ze_result_t CommandList::appendGraphExecute(ze_graph_handle_t hGraph,
         return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
     }
 
+    result = graph->getBuildStatus();
+    if (result != ZE_RESULT_SUCCESS) {
+        LOG_E("Graph is not built, status: %#x", result);
+        return result;
+    }
+
     GraphProfilingQuery *profilingQuery = nullptr;
     if (graph->getProfilingOutputSize()) {
         profilingQuery = GraphProfilingQuery::fromHandle(hProfilingQuery);
@@ -122,15 +122,13 @@ struct CommandList : _ze_command_list_handle_t, IContextObject {
 
   protected:
     ze_result_t appendMemoryFillCmd(void *ptr,
-                                    const void *pattern,
-                                    size_t patternSize,
+                                    uint32_t fillPattern,
                                     size_t size,
                                     ze_event_handle_t hEvent,
                                     uint32_t numWaitEvents,
                                     ze_event_handle_t *phWaitEvents);
     ze_result_t appendMemoryFillAsCopyCmd(void *ptr,
-                                          const void *pattern,
-                                          size_t patternSize,
+                                          uint32_t fillPattern,
                                           size_t size,
                                           ze_event_handle_t hEvent,
                                           uint32_t numWaitEvents,
@@ -169,44 +167,21 @@ struct CommandList : _ze_command_list_handle_t, IContextObject {
         if (result != ZE_RESULT_SUCCESS)
             return result;
 
-        if (numWaitEvents > 0) {
-            if (phWaitEvents == nullptr) {
-                LOG_E("Invalid wait event input. phWaitEvents: %p, numWaitEvents: %u",
-                      phWaitEvents,
-                      numWaitEvents);
-                return ZE_RESULT_ERROR_INVALID_SIZE;
-            }
-
-            result = appendWaitOnEvents(numWaitEvents, phWaitEvents);
-            if (result != ZE_RESULT_SUCCESS) {
-                LOG_E("Failed to add %u wait on events.", numWaitEvents);
-                return result;
-            }
-        }
-
-        result = appendCommand<Cmd>(std::forward<Args>(args)...);
-        if (result != ZE_RESULT_SUCCESS)
-            return result;
-
-        if (hSignalEvent != nullptr) {
-            result = appendSignalEvent(hSignalEvent);
-            if (result != ZE_RESULT_SUCCESS) {
-                LOG_E("Failed to append signal event command (handle: %p, error: %#x).",
-                      hSignalEvent,
-                      result);
-                return result;
-            }
+        auto cmd = Cmd::create(std::forward<Args>(args)...);
+        if (cmd == nullptr) {
+            LOG_E("Command is NULL / failed to be initialized!");
+            return ZE_RESULT_ERROR_UNINITIALIZED;
         }
 
-        LOG(CMDLIST,
-            "Successfully appended the command with hSignal(%p), %u wait events(%p).",
-            hSignalEvent,
-            numWaitEvents,
-            phWaitEvents);
-
-        return postAppend();
+        return appendCommandWithEvents(hSignalEvent, numWaitEvents, phWaitEvents, {cmd});
     }
 
+    /* Append commands between wait and signal events, append condition is checked by caller */
+    ze_result_t appendCommandWithEvents(ze_event_handle_t hSignalEvent,
+                                        uint32_t numWaitEvents,
+                                        ze_event_handle_t *phWaitEvents,
+                                        std::vector<std::shared_ptr<VPU::VPUCommand>> commands);
+
     Context *pContext = nullptr;
     bool isMutable = false;
     VPU::VPUDeviceContext *ctx = nullptr;
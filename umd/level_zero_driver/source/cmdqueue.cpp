@@ -13,7 +13,9 @@
 #include "context.hpp"
 #include "device.hpp"
 #include "fence.hpp"
+#include "level_zero_driver/api/prv/zex_driver.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
+#include "level_zero_driver/include/nested_structs_handler.hpp"
 #include "vpu_driver/source/command/job.hpp"
 #include "vpu_driver/source/device/vpu_command_queue.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
@@ -26,6 +28,7 @@
 #include <iterator>
 #include <limits>
 #include <mutex>
+#include <optional>
 #include <utility>
 #include <ze_api.h>
 
@@ -91,6 +94,27 @@ ze_result_t CommandQueue::create(ze_context_handle_t hContext,
                                 ? CommandQueueMode::SYNCHRONOUS
                                 : CommandQueueMode::DEFAULT;
 
+    std::optional<VPU::VPUWaitPolicy::Config> waitPolicy;
+    auto handler = [&waitPolicy](const void *pNext) -> std::optional<const void *> {
+        const auto *base = reinterpret_cast<const ze_base_desc_t *>(pNext);
+        if (static_cast<zex_structure_type_t>(base->stype) ==
+            ZEX_STRUCTURE_TYPE_COMMAND_QUEUE_WAIT_POLICY_DESC) {
+            const auto *desc =
+                reinterpret_cast<const zex_command_queue_wait_policy_desc_t *>(pNext);
+            if (desc->percentileTarget == 0 || desc->percentileTarget > 100) {
+                LOG_E("Invalid percentile target %u for wait policy", desc->percentileTarget);
+                return std::nullopt;
+            }
+            waitPolicy = VPU::VPUWaitPolicy::Config{std::chrono::microseconds(desc->spinBudgetUs),
+                                                    desc->percentileTarget};
+        }
+        return base->pNext;
+    };
+    if (!handleNestedStructs(desc->pNext, handler)) {
+        LOG_E("Invalid pNext chain in command queue descriptor");
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
     try {
         Device *pDevice = Device::fromHandle(hDevice);
         ze_command_queue_group_property_flags_t flags =
@@ -139,6 +163,16 @@ ze_result_t CommandQueue::create(ze_context_handle_t hContext,
         L0_THROW_WHEN(vpuQueue == nullptr,
                       "VPU Command queue creation failed.",
                       ZE_RESULT_ERROR_UNINITIALIZED);
+        L0_THROW_WHEN(waitPolicy.has_value() && !vpuQueue->setWaitPolicy(*waitPolicy),
+                      "Wait policy is not supported by the command queue.",
+                      ZE_RESULT_ERROR_INVALID_ARGUMENT);
+
+        // Host waiters of a job share BO waits of the completion service thread. Turbo queue
+        // waiter keeps its own BO wait, the hand-off to the service thread adds a wakeup.
+        if (!vpuQueue->isTurbo() &&
+            vpuQueue->enableCompletionNotification(
+                pContext->getDeviceContext()->getCompletionService()) < 0)
+            LOG_W("Completion notification not available, jobs are waited with direct BO wait");
 
         auto cmdQueue =
             std::make_unique<CommandQueue>(pContext, std::move(vpuQueue), std::move(mode));
@@ -311,6 +345,38 @@ ze_result_t CommandQueue::synchronize(uint64_t timeout) {
     return result;
 }
 
+ze_result_t CommandQueue::retireJobs(size_t maxInFlightJobs,
+                                     std::vector<std::shared_ptr<VPU::VPUJob>> &retiredJobs) {
+    // Jobs from a single queue complete in submission order. Completed jobs are collected from the
+    // front without blocking, the oldest job is waited for only if too many jobs are in flight.
+    auto absTp = VPU::getAbsoluteTimePoint(std::numeric_limits<uint64_t>::max());
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto it = trackedJobs.begin();
+    for (; it != trackedJobs.end(); ++it) {
+        bool windowFull = static_cast<size_t>(trackedJobs.end() - it) > maxInFlightJobs;
+        if (!(*it)->waitForCompletion(windowFull ? absTp.time_since_epoch().count() : 0)) {
+            // Wait without timeout fails only if the device is not usable anymore
+            if (windowFull) {
+                LOG_E("Failed to wait for job %p from full in-flight window", it->get());
+                result = pContext->getStatus();
+                if (result == ZE_RESULT_SUCCESS)
+                    result = ZE_RESULT_ERROR_UNKNOWN;
+            }
+            break;
+        }
+    }
+
+    std::move(trackedJobs.begin(), it, std::back_inserter(retiredJobs));
+    trackedJobs.erase(trackedJobs.begin(), it);
+    if (result != ZE_RESULT_SUCCESS)
+        return result;
+
+    if (trackedJobs.empty())
+        setIdle();
+
+    return Device::jobStatusToResult(retiredJobs);
+}
+
 ze_result_t CommandQueue::waitForJobs(std::chrono::steady_clock::time_point absTimePoint,
                                       const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs) {
     for (auto const &job : jobs) {
@@ -319,6 +385,12 @@ ze_result_t CommandQueue::waitForJobs(std::chrono::steady_clock::time_point absT
         }
     }
 
+    setIdle();
+
+    return Device::jobStatusToResult(jobs);
+}
+
+void CommandQueue::setIdle() {
     // Put back the preemption buffer if no jobs are using it.
     // This covers "zeFence" and "zeCommandQueue" synchronization cases
     if (pContext->getDeviceContext()->isPreemptionBufferSupported()) {
@@ -329,8 +401,6 @@ ze_result_t CommandQueue::waitForJobs(std::chrono::steady_clock::time_point absT
     }
 
     pContext->setIdle();
-
-    return Device::jobStatusToResult(jobs);
 }
 
 ze_result_t CommandQueue::setWorkloadType(ze_command_queue_workload_type_t workloadType) {
@@ -348,4 +418,22 @@ ze_result_t CommandQueue::setWorkloadType(ze_command_queue_workload_type_t workl
     }
     return ZE_RESULT_SUCCESS;
 }
+
+ze_result_t CommandQueue::getCompletionEventFd(int *pEventFd) {
+    // Turbo queue jobs submitted from now on are observed by the device completion service
+    int eventFd = vpuQueue->enableCompletionNotification(
+        pContext->getDeviceContext()->getCompletionService());
+    if (eventFd < 0)
+        return ZE_RESULT_ERROR_UNKNOWN;
+
+    *pEventFd = eventFd;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CommandQueue::getThrottleStats(uint64_t *pCount, uint64_t *pTimeNs) {
+    auto stats = vpuQueue->getThrottleStats();
+    *pCount = stats.count;
+    *pTimeNs = stats.timeNs;
+    return ZE_RESULT_SUCCESS;
+}
 } // namespace L0
@@ -56,13 +56,19 @@ struct CommandQueue : _ze_command_queue_handle_t, IContextObject {
                                     ze_command_list_handle_t *phCommandLists,
                                     ze_fence_handle_t hFence);
     ze_result_t synchronize(uint64_t timeout);
+    ze_result_t retireJobs(size_t maxInFlightJobs,
+                           std::vector<std::shared_ptr<VPU::VPUJob>> &retiredJobs);
 
     void destroyFence(Fence *pFence);
     ze_result_t waitForJobs(std::chrono::steady_clock::time_point timeout,
                             const std::vector<std::shared_ptr<VPU::VPUJob>> &jobs);
     ze_result_t setWorkloadType(ze_command_queue_workload_type_t workloadType);
+    ze_result_t getCompletionEventFd(int *pEventFd);
+    ze_result_t getThrottleStats(uint64_t *pCount, uint64_t *pTimeNs);
 
   protected:
+    void setIdle();
+
     std::unique_ptr<VPU::VPUDeviceQueue> vpuQueue;
     Context *pContext = nullptr;
 
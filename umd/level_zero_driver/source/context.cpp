@@ -233,8 +233,17 @@ ze_result_t Context::setProperties(const ze_context_properties_npu_ext_t *pConte
 }
 
 ze_result_t Context::releaseMemory() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &object : objects)
+            object.second->releaseMemory();
+    }
+
     ctx->preemptionCachePrune();
     ctx->scratchCachePrune(std::numeric_limits<size_t>::max());
+    ctx->commandBufferCachePrune();
+    ctx->fillPatternCachePrune();
+    ctx->slabAllocatorPrune();
     return ZE_RESULT_SUCCESS;
 }
 
@@ -11,13 +11,16 @@
 #include "driver_handle.hpp"
 #include "ext/compiler.hpp"
 #include "ext/disk_cache.hpp"
+#include "ext/graph_build_queue.hpp"
 #include "version.h"
 #include "vpu_driver/source/device/vpu_device.hpp"
 #include "vpu_driver/source/os_interface/os_interface.hpp"
 #include "vpu_driver/source/os_interface/vpu_device_factory.hpp"
+#include "vpu_driver/source/utilities/async_log.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/stats.hpp"
 
+#include <charconv>
 #include <memory>
 #include <stdlib.h>
 #include <string>
@@ -30,6 +33,18 @@ namespace L0 {
 static Driver driver;
 Driver *Driver::pDriver;
 
+static size_t getEnvSize(const char *name, size_t defaultValue) {
+    const char *env = getenv(name);
+    if (env) {
+        size_t val = defaultValue;
+        std::string_view envStr = env;
+        // On error "from_chars" function leave "val" unmodified
+        std::from_chars(envStr.begin(), envStr.end(), val);
+        return val;
+    }
+    return defaultValue;
+}
+
 void Driver::initializeEnvVariables() {
     const char *env = getenv("ZE_AFFINITY_MASK");
     envVariables.affinityMask = env == nullptr ? "" : env;
@@ -37,6 +52,10 @@ void Driver::initializeEnvVariables() {
     env = getenv("ZET_ENABLE_METRICS");
     envVariables.metrics = env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
 
+    env = getenv("ZE_INTEL_NPU_METRIC_STREAMING");
+    envVariables.metricStreaming =
+        env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
+
     env = getenv("ZE_ENABLE_PCI_ID_DEVICE_ORDER");
     envVariables.pciIdDeviceOrder =
         env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
@@ -45,6 +64,17 @@ void Driver::initializeEnvVariables() {
     envVariables.sharedForceDeviceAlloc =
         env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
 
+    env = getenv("ZE_INTEL_NPU_GRAPH_BUILD_THREADS");
+    envVariables.graphBuildThreads =
+        env == nullptr ? 0u : static_cast<uint32_t>(strtoul(env, nullptr, 10));
+
+    envVariables.hpiPoolSize =
+        getEnvSize("ZE_INTEL_NPU_HPI_POOL_SIZE", L0EnvVariables::defaultHpiPoolSize);
+    envVariables.hpiPoolPrewarm = getEnvSize("ZE_INTEL_NPU_HPI_POOL_PREWARM", 0);
+
+    env = getenv("ZE_INTEL_NPU_DISABLE_ELF_ARENA");
+    envVariables.disableElfArena = env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
+
     env = getenv("ZE_ENABLE_VALIDATION_LAYER");
     bool validationLayerEnabled = env == nullptr || env[0] == '0' || env[0] == '\0' ? false : true;
 
@@ -72,6 +102,15 @@ void Driver::initializeLogging() {
         MemoryStatistics::get().enable(umdMemStatsPath);
     }
 
+    env = getenv("ZE_INTEL_NPU_LOG_BINARY");
+    if (env) {
+        VPU::AsyncLog::enable(std::string_view(env), VPU::AsyncLog::Format::Binary);
+    } else {
+        env = getenv("ZE_INTEL_NPU_LOG_ASYNC");
+        if (env != nullptr && env[0] != '0' && env[0] != '\0')
+            VPU::AsyncLog::enable(stderr, VPU::AsyncLog::Format::Text);
+    }
+
     VPU::setLogLevel(umdLogLevel);
     VPU::setLogMask(umdLogMask);
     L0::Compiler::setLogLevel(cidLogLevel);
@@ -97,6 +136,17 @@ void Driver::displayComponentVersions() {
     }
 }
 
+GraphBuildQueue &Driver::getGraphBuildQueue() {
+    std::call_once(graphBuildQueueOnce, [this]() {
+        size_t workers = envVariables.graphBuildThreads;
+        if (workers == 0)
+            workers = GraphBuildQueue::getDefaultWorkerCount();
+        LOG(DRIVER, "Graph build queue uses up to %zu worker threads", workers);
+        graphBuildQueue = std::make_unique<GraphBuildQueue>(workers);
+    });
+    return *graphBuildQueue;
+}
+
 void Driver::driverInit(ze_init_flags_t flags) {
     std::call_once(this->initDriverOnce, [&]() {
         initializeEnvVariables();
@@ -11,6 +11,7 @@
 
 #include "driver_handle.hpp"
 #include "ext/disk_cache.hpp"
+#include "ext/graph_build_queue.hpp"
 
 #include <memory>
 #include <mutex>
@@ -28,9 +29,16 @@ class Driver {
     struct L0EnvVariables {
         std::string_view affinityMask;
         bool metrics;
+        bool metricStreaming;
         bool pciIdDeviceOrder;
         bool sharedForceDeviceAlloc;
         bool extensionValidation;
+        uint32_t graphBuildThreads;
+        size_t hpiPoolSize = defaultHpiPoolSize;
+        size_t hpiPoolPrewarm;
+        bool disableElfArena;
+
+        static constexpr size_t defaultHpiPoolSize = 8;
     };
 
     Driver() {
@@ -48,6 +56,7 @@ class Driver {
     virtual DriverHandle *getDriverHandle() { return pGlobalDriverHandle.get(); }
 
     DiskCache &getDiskCache() { return *diskCache; }
+    GraphBuildQueue &getGraphBuildQueue();
 
     std::unique_ptr<DiskCache> diskCache;
 
@@ -64,6 +73,9 @@ class Driver {
     VPU::OsInterface *osInfc = nullptr;
     ze_result_t initStatus = ZE_RESULT_ERROR_UNINITIALIZED;
     std::once_flag initDriverOnce;
+    /* Declared last to complete the builds before the driver handle is destroyed */
+    std::unique_ptr<GraphBuildQueue> graphBuildQueue;
+    std::once_flag graphBuildQueueOnce;
 };
 
 ze_result_t init(ze_init_flags_t);
@@ -14,6 +14,7 @@
 #include "vpu_driver/source/command/command_buffer.hpp"
 #include "vpu_driver/source/command/job.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/device/vpu_metric_stream_reader.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/timer.hpp"
 
@@ -41,6 +42,12 @@ Event::Event(VPU::VPUDeviceContext *ctx,
     setEventState(VPU::VPUEventCommand::STATE_EVENT_INITIAL);
 }
 
+Event::~Event() {
+    // Host task still signals the event, e.g. asynchronous graph build
+    for (auto &task : hostTasks)
+        task.wait();
+}
+
 ze_result_t Event::destroy() {
     destroyCb();
     LOG(EVENT, "Event destroyed - %p", this);
@@ -58,6 +65,14 @@ void Event::trackMetricData(int64_t timeoutNs) {
     if (!msExpectedDataSize || !msGroupMask)
         return;
 
+    // In streaming mode the reader thread wakes up the waiter when enough reports are buffered
+    if (auto reader = msReader.lock()) {
+        if (*eventState < VPU::VPUEventCommand::STATE_HOST_SIGNAL &&
+            reader->waitForData(msExpectedDataSize, timeoutNs))
+            hostSignal();
+        return;
+    }
+
     do {
         size_t dataSize = 0;
         if (*eventState >= VPU::VPUEventCommand::STATE_HOST_SIGNAL) {
@@ -79,7 +94,8 @@ void Event::trackMetricData(int64_t timeoutNs) {
 }
 
 ze_result_t Event::hostSynchronize(uint64_t timeout) {
-    auto absoluteTimeout = VPU::getAbsoluteTimeoutNanoseconds(timeout);
+    auto timeoutPoint = VPU::getAbsoluteTimePoint(timeout);
+    int64_t absoluteTimeout = timeoutPoint.time_since_epoch().count();
 
     /* Remove dangling weak pointers */
     associatedJobs.erase(std::remove_if(associatedJobs.begin(),
@@ -102,6 +118,26 @@ ze_result_t Event::hostSynchronize(uint64_t timeout) {
         }
     }
 
+    // Tasks are waited for without the lock, so other threads can associate tasks meanwhile
+    std::vector<std::shared_future<void>> tasks;
+    {
+        const std::lock_guard<std::mutex> lock(hostTasksMutex);
+        tasks = hostTasks;
+    }
+    for (auto &task : tasks)
+        task.wait_until(timeoutPoint);
+
+    {
+        const std::lock_guard<std::mutex> lock(hostTasksMutex);
+        hostTasks.erase(std::remove_if(hostTasks.begin(),
+                                       hostTasks.end(),
+                                       [](auto &task) {
+                                           return task.wait_for(std::chrono::seconds(0)) ==
+                                                  std::future_status::ready;
+                                       }),
+                        hostTasks.end());
+    }
+
     return queryStatus(absoluteTimeout);
 }
 
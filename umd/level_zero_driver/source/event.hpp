@@ -14,7 +14,9 @@
 #include "vpu_driver/source/command/event_command.hpp"
 
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 #include <ze_api.h>
@@ -23,6 +25,7 @@ namespace VPU {
 class VPUBufferObject;
 class VPUDeviceContext;
 class VPUJob;
+class VPUMetricStreamReader;
 } // namespace VPU
 
 struct _ze_event_handle_t {};
@@ -36,7 +39,7 @@ struct Event : _ze_event_handle_t, IContextObject {
           const std::shared_ptr<VPU::VPUBufferObject> eventBaseBo,
           uint64_t vpuAddr,
           std::function<void()> &&destroyCb);
-    ~Event() = default;
+    ~Event();
 
     inline ze_event_handle_t toHandle() { return this; }
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
@@ -51,9 +54,17 @@ struct Event : _ze_event_handle_t, IContextObject {
     const std::shared_ptr<VPU::VPUBufferObject> getAssociatedBo() const;
 
     void associateJob(std::weak_ptr<VPU::VPUJob> job) { associatedJobs.push_back(std::move(job)); }
-    void setMetricTrackData(uint64_t groupMask, size_t dataSize) {
+    /* Host task that signals the event, hostSynchronize and destructor wait for it */
+    void associateHostTask(std::shared_future<void> task) {
+        const std::lock_guard<std::mutex> lock(hostTasksMutex);
+        hostTasks.push_back(std::move(task));
+    }
+    void setMetricTrackData(uint64_t groupMask,
+                            size_t dataSize,
+                            std::weak_ptr<VPU::VPUMetricStreamReader> reader = {}) {
         msGroupMask = groupMask;
         msExpectedDataSize = dataSize;
+        msReader = std::move(reader);
     }
     void trackMetricData(int64_t timeoutNs);
 
@@ -66,8 +77,12 @@ struct Event : _ze_event_handle_t, IContextObject {
     uint64_t eventVpuAddr = 0;
     std::function<void()> destroyCb;
     std::vector<std::weak_ptr<VPU::VPUJob>> associatedJobs;
+    /* Guards hostTasks, tasks are associated and waited for from different threads */
+    std::mutex hostTasksMutex;
+    std::vector<std::shared_future<void>> hostTasks;
     size_t msExpectedDataSize = 0;
     uint64_t msGroupMask = 0ULL;
+    std::weak_ptr<VPU::VPUMetricStreamReader> msReader;
 };
 
 } // namespace L0
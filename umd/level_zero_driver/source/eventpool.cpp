@@ -75,9 +75,9 @@ EventPool::EventPool(Context *pContext, const ze_event_pool_desc_t *desc)
     , ctx(pContext->getDeviceContext())
     , pEventPool(nullptr)
     , events(desc->count) {
-    pEventPool =
-        ctx->createUntrackedBufferObject(sizeof(VPU::VPUEventCommand::JsmEventData) * events.size(),
-                                         VPU::VPUBufferObject::Type::CachedFw);
+    pEventPool = ctx->createUntrackedSubAllocation(
+        sizeof(VPU::VPUEventCommand::JsmEventData) * events.size(),
+        VPU::VPUBufferObject::Type::CachedFw);
     L0_THROW_WHEN(pEventPool == nullptr,
                   "Failed to allocate buffer object for event pool",
                   ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY);
@@ -21,9 +21,12 @@
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/trace_perfetto.hpp" // IWYU pragma: keep
 
+#include <algorithm>
 #include <bitset>
 #include <memory>
+#include <mutex>
 #include <string.h>
+#include <vector>
 #include <ze_api.h>
 
 namespace L0 {
@@ -128,6 +131,85 @@ ze_result_t Compiler::compilerDestroy(vcl_compiler_handle_t compiler) {
     return vclToL0Err(Vcl::sym().compilerDestroy(compiler));
 }
 
+/*
+ * Compiler handles are reused between compilations, because vclCompilerCreate parses the device
+ * description and loads the compiler plugin on every call. A handle is checked out for exclusive
+ * use by a single compilation. The log is drained before the handle is returned and the length of
+ * the drained part is kept with the handle, so messages from one compilation never show up in the
+ * log of another, whether or not the compiler clears the log when it is read.
+ */
+class CompilerPool {
+  public:
+    struct Handle {
+        uint32_t deviceId = 0u;
+        uint16_t deviceRevision = 0u;
+        uint32_t tileConfig = 0u;
+        vcl_log_level_t logLevel = VCL_LOG_NONE;
+        vcl_compiler_handle_t compiler = nullptr;
+        vcl_log_handle_t logHandle = nullptr;
+        size_t logSize = 0u;
+    };
+
+    static CompilerPool &getInstance() {
+        static CompilerPool pool;
+        return pool;
+    }
+
+    ~CompilerPool() {
+        for (auto &handle : handles)
+            Compiler::compilerDestroy(handle.compiler);
+    }
+
+    CompilerPool(const CompilerPool &) = delete;
+    CompilerPool &operator=(const CompilerPool &) = delete;
+
+    ze_result_t checkout(const VPU::VPUHwInfo &hwInfo, Handle &handle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = std::find_if(handles.begin(), handles.end(), [&](const Handle &h) {
+                return h.deviceId == hwInfo.deviceId && h.deviceRevision == hwInfo.deviceRevision &&
+                       h.tileConfig == hwInfo.tileConfig && h.logLevel == cidLogLevel;
+            });
+            if (it != handles.end()) {
+                handle = *it;
+                handles.erase(it);
+                LOG(GRAPH, "Reusing compiler handle %p", handle.compiler);
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        handle.deviceId = hwInfo.deviceId;
+        handle.deviceRevision = hwInfo.deviceRevision;
+        handle.tileConfig = hwInfo.tileConfig;
+        handle.logLevel = cidLogLevel;
+        return Compiler::compilerCreate(hwInfo, handle.compiler, handle.logHandle);
+    }
+
+    void checkin(Handle &handle) {
+        if (handle.logSize <= maxLogSize) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (handles.size() < maxHandles) {
+                handles.push_back(handle);
+                return;
+            }
+        }
+        Compiler::compilerDestroy(handle.compiler);
+    }
+
+  private:
+    CompilerPool() {
+        // Pool has to be destroyed before the compiler library is unloaded
+        Vcl::sym();
+    }
+
+    static constexpr size_t maxHandles = 4;
+    // Log that is not cleared on read grows with every compilation, then the handle is recreated
+    static constexpr size_t maxLogSize = 1 * 1024 * 1024;
+
+    std::mutex mutex;
+    std::vector<Handle> handles;
+};
+
 ze_result_t Compiler::compilerInit(VPU::VPUDevice *vpuDevice) {
     if (!Vcl::sym().ok())
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
@@ -164,12 +246,17 @@ ze_result_t Compiler::compilerInit(VPU::VPUDevice *vpuDevice) {
     return ret;
 }
 
-static void appendCompilerLog(vcl_log_handle_t logHandle, std::string &buffer) {
+/*
+ * Appends the compiler log to buffer, leaving out the first skipSize characters that were already
+ * read from a pooled compiler handle. Returns the length of the whole compiler log.
+ */
+static size_t
+appendCompilerLog(vcl_log_handle_t logHandle, std::string &buffer, size_t skipSize = 0) {
     if (!Vcl::sym().ok())
-        return;
+        return 0;
 
     if (logHandle == NULL) {
-        return;
+        return 0;
     }
 
     size_t compilerLogSize = 0;
@@ -178,32 +265,41 @@ static void appendCompilerLog(vcl_log_handle_t logHandle, std::string &buffer) {
     TRACE_EVENT_END("NPU_COMPILER");
     if (logRet != VCL_RESULT_SUCCESS) {
         LOG_E("Failed to get size of error message");
-        return;
+        return 0;
     }
 
     if (compilerLogSize == 0) {
-        return;
+        return 0;
     }
 
-    size_t currentSize = buffer.size();
-    buffer.resize(currentSize + compilerLogSize);
-
+    std::string compilerLog(compilerLogSize, '\0');
     TRACE_EVENT("NPU_COMPILER", "vclLogHandleGetString");
-    logRet =
-        Vcl::sym().logHandleGetString(logHandle, &compilerLogSize, buffer.data() + currentSize);
+    logRet = Vcl::sym().logHandleGetString(logHandle, &compilerLogSize, compilerLog.data());
     if (logRet != VCL_RESULT_SUCCESS) {
-        buffer.resize(currentSize);
         buffer += "[NPU_DRV] Failed to get content of log from compiler\n";
         LOG_E("Failed to get content of log from compiler");
-        return;
+        return 0;
     }
 
     // Remove the zero byte from the end of string to add driver messages
-    if (!buffer.empty() && buffer.back() == '\0')
-        buffer.pop_back();
+    if (!compilerLog.empty() && compilerLog.back() == '\0')
+        compilerLog.pop_back();
+
+    if (compilerLog.size() <= skipSize)
+        return compilerLog.size();
 
+    buffer.append(compilerLog, skipSize);
     buffer.push_back('\n');
     LOG(GRAPH, "Saved compiler message to log buffer, message: %s", buffer.c_str());
+    return compilerLog.size();
+}
+
+static size_t getCompilerLogSize(vcl_log_handle_t logHandle) {
+    size_t compilerLogSize = 0;
+    TRACE_EVENT("NPU_COMPILER", "vclLogHandleGetString");
+    if (Vcl::sym().logHandleGetString(logHandle, &compilerLogSize, NULL) != VCL_RESULT_SUCCESS)
+        return 0;
+    return compilerLogSize;
 }
 
 static uint8_t *vclAllocate2(vcl_allocator2_t *allocator, uint64_t size) {
@@ -266,23 +362,24 @@ ze_result_t Compiler::getCompiledBlob(VPU::VPUDeviceContext *ctx,
         return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
-    vcl_compiler_handle_t compiler = NULL;
-    vcl_log_handle_t logHandle = NULL;
-    ze_result_t ret = compilerCreate(ctx->getDeviceCapabilities(), compiler, logHandle);
+    CompilerPool::Handle handle;
+    ze_result_t ret = CompilerPool::getInstance().checkout(ctx->getDeviceCapabilities(), handle);
     if (ret != ZE_RESULT_SUCCESS) {
         log += "[NPU_DRV] Driver reports a failure from vclCompilerCreate, return code: " +
                std::to_string(ret) + '\n';
-        appendCompilerLog(logHandle, log);
+        appendCompilerLog(handle.logHandle, log);
         LOG_E("Failed to create compiler! Result:%#x", ret);
         return ret;
     }
 
-    ret = getCompilerExecutableAllocation(ctx, compiler, desc, blob, log);
+    ret = getCompilerExecutableAllocation(ctx, handle.compiler, desc, blob, log);
 
-    appendCompilerLog(logHandle, log);
+    handle.logSize = appendCompilerLog(handle.logHandle, log, handle.logSize);
+    // Compiler that clears the log when it is read starts the next log from the beginning
+    if (handle.logSize > 0 && getCompilerLogSize(handle.logHandle) == 0)
+        handle.logSize = 0;
 
-    TRACE_EVENT("NPU_COMPILER", "vclCompilerDestroy");
-    Vcl::sym().compilerDestroy(compiler);
+    CompilerPool::getInstance().checkin(handle);
     return ret;
 }
 
@@ -309,19 +406,12 @@ std::string Compiler::getCompilerVersionString() {
            std::to_string(compilerProperties.version.minor) + "(" + compilerProperties.id + ")";
 }
 
-ze_result_t Compiler::getDecodedProfilingBuffer(ze_graph_profiling_type_t profilingType,
-                                                const BlobContainer &blob,
-                                                const uint8_t *profData,
-                                                uint64_t profSize,
-                                                uint32_t *pSize,
-                                                void *pData,
-                                                std::string &logBuffer) {
-    if (!Vcl::sym().ok())
-        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
-
-    if (!isVclProfilingApiCompatible())
-        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
-
+static ze_result_t decodeProfilingBuffer(vcl_profiling_request_type_t profType,
+                                         const BlobContainer &blob,
+                                         const uint8_t *profData,
+                                         uint64_t profSize,
+                                         std::vector<uint8_t> &decodedBuffer,
+                                         std::string &logBuffer) {
     vcl_profiling_handle_t profHandle = NULL;
     vcl_profiling_input_t profilingApiInput = {.blobData = blob.ptr,
                                                .blobSize = blob.size,
@@ -342,10 +432,6 @@ ze_result_t Compiler::getDecodedProfilingBuffer(ze_graph_profiling_type_t profil
     }
 
     vcl_profiling_output_t profOutput = {};
-    vcl_profiling_request_type_t profType = VCL_PROFILING_LAYER_LEVEL;
-    if (profilingType == ZE_GRAPH_PROFILING_TASK_LEVEL)
-        profType = VCL_PROFILING_TASK_LEVEL;
-
     TRACE_EVENT_BEGIN("NPU_COMPILER", "vclGetDecodedProfilingBuffer");
     ret = vclToL0Err(Vcl::sym().getDecodedProfilingBuffer(profHandle, profType, &profOutput));
     TRACE_EVENT_END("NPU_COMPILER");
@@ -355,20 +441,42 @@ ze_result_t Compiler::getDecodedProfilingBuffer(ze_graph_profiling_type_t profil
             std::to_string(ret) + '\n';
         appendCompilerLog(logHandle, logBuffer);
         LOG_E("Failed to get decoded profiling data in compiler");
-
-        TRACE_EVENT("NPU_COMPILER", "vclProfilingDestroy");
-        Vcl::sym().profilingDestroy(profHandle);
-        return ret;
+    } else {
+        decodedBuffer.assign(profOutput.data, profOutput.data + profOutput.size);
     }
 
-    if (*pSize == 0 || *pSize > profOutput.size)
-        *pSize = safe_cast<uint32_t>(profOutput.size);
-
-    if (pData != nullptr)
-        memcpy(pData, profOutput.data, *pSize);
-
     TRACE_EVENT("NPU_COMPILER", "vclProfilingDestroy");
     Vcl::sym().profilingDestroy(profHandle);
+    return ret;
+}
+
+ze_result_t Compiler::getDecodedProfilingBuffers(
+    ze_graph_profiling_type_t profilingType,
+    const BlobContainer &blob,
+    const std::vector<std::pair<const uint8_t *, uint64_t>> &profBuffers,
+    std::vector<std::vector<uint8_t>> &decodedBuffers,
+    std::string &logBuffer) {
+    if (!Vcl::sym().ok())
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+    if (!isVclProfilingApiCompatible())
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    vcl_profiling_request_type_t profType = VCL_PROFILING_LAYER_LEVEL;
+    if (profilingType == ZE_GRAPH_PROFILING_TASK_LEVEL)
+        profType = VCL_PROFILING_TASK_LEVEL;
+
+    decodedBuffers.resize(profBuffers.size());
+    for (size_t i = 0; i < profBuffers.size(); i++) {
+        ze_result_t ret = decodeProfilingBuffer(profType,
+                                                blob,
+                                                profBuffers[i].first,
+                                                profBuffers[i].second,
+                                                decodedBuffers[i],
+                                                logBuffer);
+        if (ret != ZE_RESULT_SUCCESS)
+            return ret;
+    }
     return ZE_RESULT_SUCCESS;
 }
 
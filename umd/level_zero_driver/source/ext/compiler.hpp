@@ -15,6 +15,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 #include <ze_graph_profiling_ext.h>
@@ -45,13 +47,13 @@ class Compiler {
 
     static vcl_version_info_t getVclCompilerApiVersion();
     static std::string getCompilerVersionString();
-    static ze_result_t getDecodedProfilingBuffer(ze_graph_profiling_type_t profilingType,
-                                                 const BlobContainer &blob,
-                                                 const uint8_t *profData,
-                                                 uint64_t profSize,
-                                                 uint32_t *size,
-                                                 void *data,
-                                                 std::string &log);
+    /* Decode raw profiling buffers of the blob, one compiler profiling handle per buffer */
+    static ze_result_t getDecodedProfilingBuffers(
+        ze_graph_profiling_type_t profilingType,
+        const BlobContainer &blob,
+        const std::vector<std::pair<const uint8_t *, uint64_t>> &profBuffers,
+        std::vector<std::vector<uint8_t>> &decodedBuffers,
+        std::string &log);
     static ze_result_t queryNetworkCreate(vcl_compiler_handle_t compiler,
                                           vcl_query_desc_t &queryDesc,
                                           vcl_query_handle_t *query);
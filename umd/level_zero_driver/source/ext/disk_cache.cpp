@@ -15,18 +15,27 @@
 #include "npu_driver_compiler.h"
 #include "vpu_driver/source/os_interface/os_interface.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/trace_perfetto.hpp"
 
+#include <algorithm>
 #include <charconv>
+#include <chrono>
 #include <filesystem>
 #include <functional>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <stdlib.h>
 #include <string.h>
 #include <string_view>
 #include <sys/stat.h>
+#include <system_error>
+#include <thread>
 #include <time.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 #include <ze_api.h>
 #include <ze_graph_ext.h>
 
@@ -50,22 +59,33 @@ static std::filesystem::path getCacheDir() {
 }
 
 static size_t getCacheMaxSize() {
+    constexpr size_t GB = 1024 * 1024 * 1024;
+    size_t val = 4 * GB;
     const char *env = getenv("ZE_INTEL_NPU_CACHE_SIZE");
     if (env) {
-        size_t val = 0;
         std::string_view envStr = env;
         // On error "from_chars" function leave "val" unmodified
         std::from_chars(envStr.begin(), envStr.end(), val);
-        return val;
     }
-    constexpr size_t GB = 1024 * 1024 * 1024;
-    return 4 * GB;
+    return val;
+}
+
+static std::chrono::milliseconds getCacheLockTimeout() {
+    uint32_t val = 60;
+    const char *env = getenv("ZE_INTEL_NPU_CACHE_LOCK_TIMEOUT");
+    if (env) {
+        std::string_view envStr = env;
+        // On error "from_chars" function leave "val" unmodified
+        std::from_chars(envStr.begin(), envStr.end(), val);
+    }
+    return std::chrono::seconds(val);
 }
 
 DiskCache::DiskCache(VPU::OsInterface &osInfc)
     : osInfc(osInfc)
     , cachePath()
-    , maxSize() {
+    , maxSize()
+    , lockTimeout(getCacheLockTimeout()) {
     cachePath = getCacheDir();
     if (cachePath.empty()) {
         LOG_W("Cache path is empty, disabling cache");
@@ -79,7 +99,18 @@ DiskCache::DiskCache(VPU::OsInterface &osInfc)
     }
 
     maxSize = getCacheMaxSize();
-    LOG(CACHE, "Cache is initialized, path: %s, max size: %lu", cachePath.c_str(), maxSize);
+    loadIndex();
+    LOG(CACHE,
+        "Cache is initialized, path: %s, max size: %lu, cache size: %lu",
+        cachePath.c_str(),
+        maxSize,
+        cacheSize);
+}
+
+DiskCache::~DiskCache() {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    if (isIndexDirty())
+        storeIndex();
 }
 
 size_t DiskCache::getCacheSize() {
@@ -88,11 +119,8 @@ size_t DiskCache::getCacheSize() {
         return 0;
     }
 
-    size_t size = 0;
-    osInfc.osiScanDir(cachePath, [&size](const char *name, struct stat &stat) {
-        size += static_cast<size_t>(stat.st_size);
-    });
-    return size;
+    std::lock_guard<std::mutex> lock(indexMutex);
+    return cacheSize;
 }
 
 DiskCache::Key DiskCache::computeKey(const ze_graph_desc_2_t &desc) {
@@ -134,49 +162,356 @@ DiskCache::Key DiskCache::computeKey(const ze_graph_desc_2_t &desc) {
     return hash.final(desc.pInput, desc.inputSize);
 }
 
+static int64_t toNanoseconds(const struct timespec &ts) {
+    return ts.tv_sec * 1'000'000'000LL + ts.tv_nsec;
+}
+
+static constexpr std::string_view indexHeader = "ze_intel_npu_cache_index";
+static constexpr uint32_t indexVersion = 1;
+static constexpr std::string_view indexNoChecksum = "-";
+
+bool DiskCache::readIndexFile(std::unordered_map<Key, IndexEntry> &fileIndex,
+                              uint64_t &fileUseCounter,
+                              int64_t &fileMtime) {
+    auto file = osInfc.osiOpenWithSharedLock(cachePath / indexFileName, false);
+    if (!file || file->size() == 0 || file->mmap() == nullptr)
+        return false;
+
+    std::istringstream stream(std::string(static_cast<const char *>(file->mmap()), file->size()));
+    std::string header;
+    uint32_t version = 0;
+    if (!(stream >> header >> version >> fileUseCounter) || header != indexHeader ||
+        version != indexVersion) {
+        LOG_W("Invalid cache index");
+        return false;
+    }
+
+    Key key;
+    IndexEntry entry;
+    while (stream >> key >> entry.size >> entry.mtime >> entry.lastUse >> entry.checksum) {
+        if (entry.checksum == indexNoChecksum)
+            entry.checksum.clear();
+        fileIndex.emplace(key, entry);
+    }
+    fileMtime = file->mtime();
+    return true;
+}
+
+void DiskCache::mergeIndex(std::unordered_map<Key, IndexEntry> fileIndex, uint64_t fileUseCounter) {
+    for (const auto &key : removedKeys)
+        fileIndex.erase(key);
+
+    /* Entries used by this process since the index was stored are the most recently used ones */
+    std::vector<std::pair<uint64_t, Key>> changed;
+    changed.reserve(changedKeys.size());
+    for (const auto &key : changedKeys)
+        changed.emplace_back(index[key].lastUse, key);
+    std::sort(changed.begin(), changed.end());
+
+    for (auto &[lastUse, key] : changed) {
+        auto entry = index[key];
+        entry.lastUse = ++fileUseCounter;
+        fileIndex[key] = std::move(entry);
+    }
+
+    index = std::move(fileIndex);
+    useCounter = fileUseCounter;
+    cacheSize = 0;
+    for (const auto &[key, entry] : index)
+        cacheSize += entry.size;
+}
+
+void DiskCache::loadIndex() {
+    std::unordered_map<Key, IndexEntry> fileIndex;
+    uint64_t fileUseCounter = 0;
+    if (!readIndexFile(fileIndex, fileUseCounter, indexMtime)) {
+        LOG(CACHE, "Cache index is not available, scanning cache directory");
+        syncIndexWithCacheDir();
+        return;
+    }
+
+    mergeIndex(std::move(fileIndex), fileUseCounter);
+    LOG(CACHE, "Cache index loaded, entries: %lu", index.size());
+}
+
+void DiskCache::refreshIndex() {
+    /* Other process stored the index since it was read, so it may have added or removed blobs */
+    auto file = osInfc.osiOpenWithSharedLock(cachePath / indexFileName, false);
+    if (!file || file->mtime() == indexMtime)
+        return;
+    file.reset();
+
+    std::unordered_map<Key, IndexEntry> fileIndex;
+    uint64_t fileUseCounter = 0;
+    if (!readIndexFile(fileIndex, fileUseCounter, indexMtime))
+        return;
+
+    mergeIndex(std::move(fileIndex), fileUseCounter);
+    LOG(CACHE, "Cache index refreshed, entries: %lu, cache size: %lu", index.size(), cacheSize);
+}
+
+std::unique_ptr<DiskCache::EntryLock> DiskCache::lockIndex() {
+    constexpr int lockAttempts = 10;
+    std::filesystem::path lockPath = cachePath / (std::string(indexFileName) + lockFileSuffix);
+    for (int i = 0; i < lockAttempts; i++) {
+        if (auto file = osInfc.osiOpenWithExclusiveLock(lockPath, true))
+            return std::make_unique<EntryLock>(osInfc, lockPath, std::move(file));
+
+        /* Lock file that is not locked is left by a process that terminated while storing */
+        if (auto file = osInfc.osiOpenWithExclusiveLock(lockPath, false)) {
+            if (osInfc.osiFileRemove(lockPath))
+                continue;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return nullptr;
+}
+
+void DiskCache::storeIndex() {
+    /* Index is read, merged with changes of this process and written while holding the lock */
+    auto indexLock = lockIndex();
+    if (!indexLock) {
+        LOG(CACHE, "Cache index is locked, skipping update");
+        return;
+    }
+
+    if (!indexScanned) {
+        std::unordered_map<Key, IndexEntry> fileIndex;
+        uint64_t fileUseCounter = 0;
+        int64_t fileMtime = 0;
+        if (readIndexFile(fileIndex, fileUseCounter, fileMtime))
+            mergeIndex(std::move(fileIndex), fileUseCounter);
+    }
+
+    std::string data = std::string(indexHeader) + " " + std::to_string(indexVersion) + " " +
+                       std::to_string(useCounter) + "\n";
+    for (const auto &[key, entry] : index) {
+        data += key + " " + std::to_string(entry.size) + " " + std::to_string(entry.mtime) + " " +
+                std::to_string(entry.lastUse) + " " +
+                (entry.checksum.empty() ? std::string(indexNoChecksum) : entry.checksum) + "\n";
+    }
+
+    /* Index is replaced as a whole. Old index is removed only if no other process reads it */
+    std::filesystem::path indexPath = cachePath / indexFileName;
+    if (auto oldIndex = osInfc.osiOpenWithExclusiveLock(indexPath, false))
+        osInfc.osiFileRemove(indexPath);
+
+    auto file = osInfc.osiOpenWithExclusiveLock(indexPath, true);
+    if (!file) {
+        LOG(CACHE, "Cache index is in use, skipping update");
+        return;
+    }
+    if (!file->write(data.data(), data.size())) {
+        LOG_W("Failed to write cache index");
+        osInfc.osiFileRemove(indexPath);
+        return;
+    }
+    file.reset();
+
+    if (auto storedIndex = osInfc.osiOpenWithSharedLock(indexPath, false))
+        indexMtime = storedIndex->mtime();
+    changedKeys.clear();
+    removedKeys.clear();
+    indexScanned = false;
+}
+
+void DiskCache::syncIndexWithCacheDir() {
+    std::unordered_map<Key, IndexEntry> scannedIndex;
+    size_t scannedSize = 0;
+    osInfc.osiScanDir(cachePath, [&](const char *name, struct stat &stat) {
+        std::string_view filename(name);
+        std::string_view lockSuffix(lockFileSuffix);
+        if (filename == indexFileName ||
+            (filename.size() > lockSuffix.size() &&
+             filename.substr(filename.size() - lockSuffix.size()) == lockSuffix))
+            return;
+
+        IndexEntry entry;
+        entry.size = static_cast<size_t>(stat.st_size);
+        entry.mtime = toNanoseconds(stat.st_mtim);
+
+        auto it = index.find(name);
+        if (it != index.end() && it->second.size == entry.size &&
+            it->second.mtime == entry.mtime) {
+            entry = it->second;
+        }
+        scannedSize += entry.size;
+        scannedIndex.emplace(name, std::move(entry));
+    });
+
+    index = std::move(scannedIndex);
+    cacheSize = scannedSize;
+    /* Scanned index replaces the stored one */
+    changedKeys.clear();
+    removedKeys.clear();
+    indexScanned = true;
+}
+
+void DiskCache::updateIndexEntry(const Key &key, IndexEntry entry) {
+    auto [it, inserted] = index.try_emplace(key);
+    if (!inserted)
+        cacheSize -= it->second.size;
+
+    cacheSize += entry.size;
+    entry.lastUse = ++useCounter;
+    it->second = std::move(entry);
+    changedKeys.insert(key);
+    removedKeys.erase(key);
+}
+
+void DiskCache::removeIndexEntry(const Key &key) {
+    auto it = index.find(key);
+    if (it == index.end())
+        return;
+
+    cacheSize -= it->second.size;
+    index.erase(it);
+    changedKeys.erase(key);
+    removedKeys.insert(key);
+}
+
+static TraceCounter diskCacheHits("Disk cache hits");
+static TraceCounter diskCacheMisses("Disk cache misses");
+
 std::unique_ptr<BlobContainer> DiskCache::getBlob(const Key &key) {
     if (cachePath.empty())
         return {};
 
+    auto blob = readBlob(key, false);
+    if (blob)
+        diskCacheHits.add(1);
+    else
+        diskCacheMisses.add(1);
+    return blob;
+}
+
+DiskCache::EntryLock::EntryLock(VPU::OsInterface &osInfc,
+                                std::filesystem::path path,
+                                std::unique_ptr<VPU::OsFile> file)
+    : osInfc(osInfc)
+    , path(std::move(path))
+    , file(std::move(file)) {}
+
+DiskCache::EntryLock::~EntryLock() {
+    /* Remove the lock file before unlocking it, so waiting processes never take a stale lock */
+    osInfc.osiFileRemove(path);
+}
+
+std::unique_ptr<BlobContainer> DiskCache::getBlobOrLock(const Key &key,
+                                                        std::unique_ptr<EntryLock> &entryLock) {
+    entryLock.reset();
+    auto blob = getBlob(key);
+    if (blob || cachePath.empty())
+        return blob;
+
+    /* File locks do not block, so the waiting process polls the cache entry and the lock file */
+    constexpr auto pollInterval = std::chrono::milliseconds(20);
+    std::filesystem::path lockPath = cachePath / (key + lockFileSuffix);
+    auto deadline = std::chrono::steady_clock::now() + lockTimeout;
+    bool lockFileMissing = false;
+    while (true) {
+        if (auto file = osInfc.osiOpenWithExclusiveLock(lockPath, true)) {
+            entryLock = std::make_unique<EntryLock>(osInfc, lockPath, std::move(file));
+            /* Other process could store the blob and release the lock since the lookup */
+            blob = readBlob(key, false);
+            if (blob)
+                entryLock.reset();
+            return blob;
+        }
+
+        /*
+         * Lock file that is not locked is left by a process that terminated while compiling. If
+         * the lock is released just now the removed file can belong to the next owner, then the
+         * blob is compiled twice, but setBlob stores it only once.
+         */
+        if (auto file = osInfc.osiOpenWithExclusiveLock(lockPath, false)) {
+            LOG(CACHE, "Removing abandoned lock file for %s key", key.c_str());
+            if (osInfc.osiFileRemove(lockPath))
+                continue;
+        }
+
+        blob = readBlob(key, false);
+        if (blob)
+            return blob;
+
+        /* Lock file can not be created although it does not exist, e.g. cache is read-only */
+        std::error_code ec;
+        if (!std::filesystem::exists(lockPath, ec)) {
+            if (lockFileMissing) {
+                LOG(CACHE, "Failed to create lock file for %s key", key.c_str());
+                return nullptr;
+            }
+            lockFileMissing = true;
+            continue;
+        }
+        lockFileMissing = false;
+
+        if (std::chrono::steady_clock::now() >= deadline) {
+            LOG_W("Timed out waiting for cache entry %s, compiling without lock", key.c_str());
+            return nullptr;
+        }
+        std::this_thread::sleep_for(pollInterval);
+    }
+}
+
+std::unique_ptr<BlobContainer> DiskCache::readBlob(const Key &key, bool verified) {
     std::string filename = key;
     std::filesystem::path dataPath = cachePath / filename;
 
     auto file = osInfc.osiOpenWithSharedLock(dataPath, false);
-    if (!file || file->size() == 0 || file->mmap() == nullptr) {
+    if (!file || file->size() <= HashCity::DigestLength || file->mmap() == nullptr) {
         LOG(CACHE, "Cache missed using %s key", filename.c_str());
         return nullptr;
     }
-    /* Validate blob checksum */
     uint8_t *filePtr = static_cast<uint8_t *>(file->mmap());
     if (filePtr == nullptr)
         return nullptr;
 
-    uint64_t offsetSum = file->size() - HashCity::DigestLength;
-    HashCity::DigestType fileSum = reinterpret_cast<HashCity::DigestType>(filePtr + offsetSum);
-    std::string computedSum = HashCity::getDigest(filePtr, offsetSum);
+    IndexEntry entry;
+    entry.size = file->size();
+    entry.mtime = file->mtime();
+
+    uint64_t offsetSum = entry.size - HashCity::DigestLength;
+    std::string_view fileSum(reinterpret_cast<const char *>(filePtr + offsetSum),
+                             HashCity::DigestLength);
+    entry.checksum = fileSum;
+
+    /* Skip validation of blob checksum if the file did not change since it was validated */
+    if (!verified) {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        auto it = index.find(key);
+        verified = it != index.end() && it->second.size == entry.size &&
+                   it->second.mtime == entry.mtime && it->second.checksum == fileSum;
+    }
 
-    if (computedSum != std::string_view(fileSum, HashCity::DigestLength)) {
+    if (!verified && HashCity::getDigest(filePtr, offsetSum) != fileSum) {
         LOG_W("Cache missed using %s key: Incorrect checksum, removing it", filename.c_str());
         /* Remove the file without setting exclusive lock comparing to "setBlob()" function */
 
         osInfc.osiFileRemove(dataPath);
+        std::lock_guard<std::mutex> lock(indexMutex);
+        removeIndexEntry(key);
         return nullptr;
     }
 
-    LOG(CACHE, "Cache hit using %s key", filename.c_str());
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        updateIndexEntry(key, std::move(entry));
+    }
+
+    LOG(CACHE, "Cache hit using %s key, checksum validated: %d", filename.c_str(), !verified);
     return std::make_unique<BlobContainer>(filePtr, offsetSum, std::move(file));
 }
 
-static size_t
-removeLeastUsedFiles(VPU::OsInterface &osInfc, std::filesystem::path &cachePath, size_t expSize) {
-    std::map<time_t, std::string> sortedFiles;
-    osInfc.osiScanDir(cachePath, [&sortedFiles](const char *name, struct stat &stat) {
-        /* Posix struct stat is used because std::filesystem only show timestamp of last write */
-        sortedFiles.emplace(stat.st_atim.tv_sec, name);
-    });
+size_t DiskCache::removeLeastUsedFiles(size_t expSize) {
+    std::vector<std::pair<uint64_t, Key>> sortedFiles;
+    sortedFiles.reserve(index.size());
+    for (const auto &[key, entry] : index)
+        sortedFiles.emplace_back(entry.lastUse, key);
+    std::sort(sortedFiles.begin(), sortedFiles.end());
 
     size_t removedSize = 0;
-    for (auto &[timestamp, filename] : sortedFiles) {
+    for (auto &[lastUse, filename] : sortedFiles) {
         auto filePath = cachePath / filename;
         auto file = osInfc.osiOpenWithExclusiveLock(filePath, false);
         if (!file)
@@ -186,11 +521,8 @@ removeLeastUsedFiles(VPU::OsInterface &osInfc, std::filesystem::path &cachePath,
         if (!osInfc.osiFileRemove(filePath))
             continue;
 
-        LOG(CACHE,
-            "Removed: %s, last access: %lu, size: %lu",
-            filename.c_str(),
-            timestamp,
-            fileSize);
+        LOG(CACHE, "Removed: %s, last use: %lu, size: %lu", filename.c_str(), lastUse, fileSize);
+        removeIndexEntry(filename);
         removedSize += fileSize;
         if (removedSize >= expSize)
             break;
@@ -205,12 +537,18 @@ std::unique_ptr<BlobContainer> DiskCache::setBlob(const Key &key,
         return blob;
     // Add checksum after blob
     size_t cachedBlobSize = blob->size + HashCity::DigestLength;
-    size_t cacheSize = getCacheSize();
-
-    if (cachedBlobSize > maxSize) {
+    if (cachedBlobSize > maxSize)
         return blob;
-    } else if (cacheSize + cachedBlobSize > maxSize) {
-        cacheSize -= removeLeastUsedFiles(osInfc, cachePath, cacheSize + cachedBlobSize - maxSize);
+
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        refreshIndex();
+        if (cacheSize + cachedBlobSize > maxSize) {
+            /* Other processes could modify the cache since the index was loaded */
+            syncIndexWithCacheDir();
+            if (cacheSize + cachedBlobSize > maxSize)
+                removeLeastUsedFiles(cacheSize + cachedBlobSize - maxSize);
+        }
     }
 
     std::filesystem::path dstPath = cachePath / key;
@@ -229,20 +567,22 @@ std::unique_ptr<BlobContainer> DiskCache::setBlob(const Key &key,
         return blob;
     }
 
-    cacheSize += cachedBlobSize;
-    LOG(CACHE,
-        "Cache set %s key, data size: %lu, cache size: %lu",
-        key.c_str(),
-        blob->size,
-        cacheSize);
-
     file.reset();
 
-    auto newBlob = getBlob(key);
+    /* Checksum has been just computed from the blob, no need to validate it again */
+    auto newBlob = readBlob(key, true);
     if (newBlob == nullptr) {
-        LOG_E("Failed to read back cached blob for key %s\n", key.c_str());
+        LOG_E("Failed to read back cached blob for key %s", key.c_str());
         return blob;
     }
+
+    std::lock_guard<std::mutex> lock(indexMutex);
+    storeIndex();
+    LOG(CACHE,
+        "Cache set %s key, data size: %lu, cache size: %lu",
+        key.c_str(),
+        blob->size,
+        cacheSize);
     return newBlob;
 }
 
@@ -8,15 +8,21 @@
 #pragma once
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "blob_container.hpp"
 
+#include <chrono>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <ze_graph_ext.h>
 
 namespace VPU {
+class OsFile;
 class OsInterface;
 } // namespace VPU
 
@@ -25,22 +31,92 @@ namespace L0 {
 class DiskCache {
   public:
     DiskCache(VPU::OsInterface &osInfc);
+    ~DiskCache();
 
     using Key = std::string;
 
+    /* Ownership of the lock file of a cache entry, the lock file is removed on release */
+    class EntryLock {
+      public:
+        EntryLock(VPU::OsInterface &osInfc,
+                  std::filesystem::path path,
+                  std::unique_ptr<VPU::OsFile> file);
+        ~EntryLock();
+
+        EntryLock(const EntryLock &) = delete;
+        EntryLock &operator=(const EntryLock &) = delete;
+
+      private:
+        VPU::OsInterface &osInfc;
+        std::filesystem::path path;
+        std::unique_ptr<VPU::OsFile> file;
+    };
+
     Key computeKey(const ze_graph_desc_2_t &desc);
     std::unique_ptr<BlobContainer> getBlob(const Key &key);
     std::unique_ptr<BlobContainer> setBlob(const Key &key, std::unique_ptr<BlobContainer> blob);
 
+    /**
+     * Single-flight lookup used when the blob is compiled on a miss. If the blob is not cached the
+     * lock file of the entry is taken, so only one process compiles the blob. Other processes wait
+     * until the blob is stored, the lock is released or the lock timeout expires. Returns the blob
+     * if it is cached, otherwise nullptr and entryLock that has to be held until setBlob returns.
+     * entryLock stays empty if the wait timed out, then the blob is compiled without coordination.
+     */
+    std::unique_ptr<BlobContainer> getBlobOrLock(const Key &key,
+                                                 std::unique_ptr<EntryLock> &entryLock);
+
     void setMaxSize(size_t size) { maxSize = size; }
     size_t getMaxSize() { return maxSize; }
+    void setLockTimeout(std::chrono::milliseconds timeout) { lockTimeout = timeout; }
     std::filesystem::path getCacheDirPath() { return cachePath; }
     size_t getCacheSize();
 
+    static constexpr const char *indexFileName = "ze_intel_npu_cache.index";
+    static constexpr const char *lockFileSuffix = ".lock";
+
   private:
+    // The index is a hint shared between processes. Entries are trusted only if the size and the
+    // modification time of the cached file did not change, otherwise the checksum is recomputed.
+    struct IndexEntry {
+        size_t size = 0;
+        int64_t mtime = 0;
+        uint64_t lastUse = 0;
+        std::string checksum;
+    };
+
+    std::unique_ptr<BlobContainer> readBlob(const Key &key, bool verified);
+    bool readIndexFile(std::unordered_map<Key, IndexEntry> &fileIndex,
+                       uint64_t &fileUseCounter,
+                       int64_t &fileMtime);
+    void mergeIndex(std::unordered_map<Key, IndexEntry> fileIndex, uint64_t fileUseCounter);
+    void loadIndex();
+    void refreshIndex();
+    std::unique_ptr<EntryLock> lockIndex();
+    void storeIndex();
+    void syncIndexWithCacheDir();
+    void updateIndexEntry(const Key &key, IndexEntry entry);
+    void removeIndexEntry(const Key &key);
+    size_t removeLeastUsedFiles(size_t expSize);
+
     VPU::OsInterface &osInfc;
     std::filesystem::path cachePath;
     size_t maxSize;
+    std::chrono::milliseconds lockTimeout;
+
+    std::mutex indexMutex;
+    std::unordered_map<Key, IndexEntry> index;
+    uint64_t useCounter = 0;
+    size_t cacheSize = 0;
+    /* Changes since the index was stored, they are merged into the index stored by others */
+    std::unordered_set<Key> changedKeys;
+    std::unordered_set<Key> removedKeys;
+    bool indexScanned = false;
+    int64_t indexMtime = 0;
+
+    bool isIndexDirty() const {
+        return indexScanned || !changedKeys.empty() || !removedKeys.empty();
+    }
 };
 
 } // namespace L0
@@ -12,6 +12,7 @@
 #include <cstdint>
 
 #include "blob_container.hpp"
+#include "driver.hpp"
 #include "graph.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "profiling_data.hpp"
@@ -38,6 +39,7 @@
 #include <unordered_map>
 #include <vpux_elf/accessor.hpp>
 #include <vpux_elf/types/data_types.hpp>
+#include <vpux_elf/types/elf_header.hpp>
 #include <vpux_elf/types/section_header.hpp>
 #include <vpux_elf/types/vpu_extensions.hpp>
 #include <vpux_elf/utils/error.hpp>
@@ -55,13 +57,18 @@
 
 namespace L0 {
 
+static bool hasNPUAccess(uint64_t flags) {
+    return (flags & (elf::SHF_EXECINSTR | elf::VPU_SHF_PROC_DMA | elf::VPU_SHF_PROC_SHAVE |
+                     elf::SHF_ALLOC)) != 0;
+}
+
 class DriverBufferManager : public elf::BufferManager {
   public:
     DriverBufferManager(VPU::VPUDeviceContext *context)
         : ctx(context) {}
     ~DriverBufferManager() override = default;
 
-    VPU::VPUBufferObject::Type getBufferType(elf::Elf_Xword flag) {
+    static VPU::VPUBufferObject::Type getBufferType(elf::Elf_Xword flag) {
         if (flag & elf::SHF_EXECINSTR)
             return VPU::VPUBufferObject::Type::WriteCombineFw;
 
@@ -71,6 +78,34 @@ class DriverBufferManager : public elf::BufferManager {
         return VPU::VPUBufferObject::Type::WriteCombineDma;
     }
 
+    /**
+     * Reserve size bytes in arena of given type. Buffers of reserved type are sub-allocated from
+     * arena buffer object that is big enough to hold all reserved buffers of single inference.
+     * Every inference copy gets its own arena, buffer that does not fit the rest of the arena gets
+     * separate buffer object.
+     */
+    void reserveArena(VPU::VPUBufferObject::Type type, size_t size) {
+        const std::lock_guard<std::mutex> lock(mtx);
+        arenas[type].reservedSize += size;
+    }
+
+    /**
+     * Next allocations belong to a new inference copy, arenas with buffers of previous inference
+     * are released by deallocate() once all their buffers are deallocated
+     */
+    void startInferenceCopy() {
+        const std::lock_guard<std::mutex> lock(mtx);
+        for (auto &[type, arena] : arenas) {
+            if (arena.bo == nullptr || arena.used == 0)
+                continue;
+
+            if (tracedElfParserBuffers.at(arena.bo->getBasePointer()).allocations == 0)
+                tracedElfParserBuffers.erase(arena.bo->getBasePointer());
+            arena.bo.reset();
+            arena.used = 0;
+        }
+    }
+
     elf::DeviceBuffer allocate(const elf::BufferSpecs &buffSpecs) override {
         TRACE_EVENT("NPU_ELF", "elf::BufferManager::allocate");
         LOG(GRAPH,
@@ -80,14 +115,20 @@ class DriverBufferManager : public elf::BufferManager {
             buffSpecs.procFlags);
 
         auto range = getBufferType(buffSpecs.procFlags);
-        // If zero-sized buffer is requested, return only NPU address from required range. Use
-        // unmappable allocation to quickly deallocate buffer at function exit
+        // If zero-sized buffer is requested, return only NPU address from required range. The
+        // address is taken from unmappable sentinel buffer that is shared by all such requests
         if (buffSpecs.size == 0) {
-            constexpr size_t allocSize = 1;
-            auto bo =
-                ctx->createUntrackedBufferObject(allocSize,
-                                                 VPU::VPUBufferObject::convertToUnmappable(range));
-            VPUX_ELF_THROW_WHEN(bo == nullptr, elf::AllocError, "Failed to get zero-sized buffer");
+            const std::lock_guard<std::mutex> lock(mtx);
+            auto &bo = zeroSizedBuffers[range];
+            if (bo == nullptr) {
+                constexpr size_t allocSize = 1;
+                bo = ctx->createUntrackedBufferObject(
+                    allocSize,
+                    VPU::VPUBufferObject::convertToUnmappable(range));
+                VPUX_ELF_THROW_WHEN(bo == nullptr,
+                                    elf::AllocError,
+                                    "Failed to get zero-sized buffer");
+            }
 
             LOG(GRAPH, "Zero-sized buffer, returning only vpu address: %#lx", bo->getVPUAddr());
             return elf::DeviceBuffer(nullptr, bo->getVPUAddr(), buffSpecs.size);
@@ -101,22 +142,23 @@ class DriverBufferManager : public elf::BufferManager {
             return elf::DeviceBuffer();
         }
 
-        auto bo = ctx->createUntrackedBufferObject(buffSpecs.size, range);
-        VPUX_ELF_THROW_WHEN(bo == nullptr, elf::AllocError, "Failed to allocate device buffer");
+        const std::lock_guard<std::mutex> lock(mtx);
+        auto [bo, offset] = allocateFromArena(range, buffSpecs.size, buffSpecs.alignment);
+        if (bo == nullptr) {
+            bo = allocateBufferObject(buffSpecs.size, range);
+            offset = 0;
+        }
 
         LOG(GRAPH,
-            "Allocated: cpu_addr: %p, vpu_addr: %#lx, size: %#lx",
-            bo->getBasePointer(),
-            bo->getVPUAddr(),
-            bo->getAllocSize());
-
-        void *ptr = bo->getBasePointer();
-        const std::lock_guard<std::mutex> lock(mtx);
-        auto [it, success] = tracedElfParserBuffers.emplace(ptr, std::move(bo));
-        VPUX_ELF_THROW_WHEN(!success, elf::AllocError, "Failed to trace new device buffer");
+            "Allocated: cpu_addr: %p, vpu_addr: %#lx, size: %#lx, offset in buffer: %#lx",
+            bo->getBasePointer() + offset,
+            bo->getVPUAddr() + offset,
+            buffSpecs.size,
+            offset);
 
-        return elf::DeviceBuffer(it->second->getBasePointer(),
-                                 it->second->getVPUAddr(),
+        tracedElfParserBuffers.at(bo->getBasePointer()).allocations++;
+        return elf::DeviceBuffer(bo->getBasePointer() + offset,
+                                 bo->getVPUAddr() + offset,
                                  buffSpecs.size);
     }
 
@@ -134,8 +176,9 @@ class DriverBufferManager : public elf::BufferManager {
         }
 
         const std::lock_guard<std::mutex> lock(mtx);
-        auto it = tracedElfParserBuffers.find(devAddress.cpu_addr());
-        if (it == tracedElfParserBuffers.end()) {
+        auto it = tracedElfParserBuffers.lower_bound(devAddress.cpu_addr());
+        if (it == tracedElfParserBuffers.end() ||
+            !it->second.bo->isInRange(devAddress.cpu_addr()) || it->second.allocations == 0) {
             LOG_E("Could not find a buffer to deallocate: cpu: %p, vpu: %lx, size: %lu",
                   devAddress.cpu_addr(),
                   devAddress.vpu_addr(),
@@ -143,6 +186,17 @@ class DriverBufferManager : public elf::BufferManager {
             return;
         }
 
+        if (--it->second.allocations > 0)
+            return;
+
+        // Arena that is still used for allocation is rewound instead of released
+        for (auto &[type, arena] : arenas) {
+            if (arena.bo == it->second.bo) {
+                arena.used = 0;
+                return;
+            }
+        }
+
         tracedElfParserBuffers.erase(it);
     }
 
@@ -173,7 +227,8 @@ class DriverBufferManager : public elf::BufferManager {
             return 0;
         }
 
-        if (!bo->copyToBuffer(from, count, 0)) {
+        size_t offset = static_cast<size_t>(to.cpu_addr() - bo->getBasePointer());
+        if (!bo->copyToBuffer(from, count, offset)) {
             LOG_E("Failed to copy a buffer");
             return 0;
         }
@@ -188,7 +243,7 @@ class DriverBufferManager : public elf::BufferManager {
             return nullptr;
         }
 
-        auto &bo = it->second;
+        auto &bo = it->second.bo;
         if (!bo->isInRange(ptr)) {
             return nullptr;
         }
@@ -203,18 +258,68 @@ class DriverBufferManager : public elf::BufferManager {
         }
 
         const std::lock_guard<std::mutex> lock(mtx);
-        auto [it, success] = tracedElfParserBuffers.emplace(ptr, std::move(bo));
+        auto [it, success] = tracedElfParserBuffers.emplace(ptr, TracedBuffer{std::move(bo), 0});
         VPUX_ELF_THROW_WHEN(!success, elf::AllocError, "Failed to trace external buffer");
     }
 
+    /**
+     * Allocate buffer object that is not part of any arena and is kept until manager is destroyed
+     */
+    std::shared_ptr<VPU::VPUBufferObject> allocateInternal(size_t size) {
+        const std::lock_guard<std::mutex> lock(mtx);
+        return allocateBufferObject(size, VPU::VPUBufferObject::Type::WriteCombineDma);
+    }
+
   public:
     size_t sharedScratchSize = 0;
 
   private:
+    struct TracedBuffer {
+        std::shared_ptr<VPU::VPUBufferObject> bo;
+        size_t allocations;
+    };
+
+    struct Arena {
+        size_t reservedSize = 0;
+        std::shared_ptr<VPU::VPUBufferObject> bo;
+        size_t used = 0;
+    };
+
+    std::shared_ptr<VPU::VPUBufferObject> allocateBufferObject(size_t size,
+                                                               VPU::VPUBufferObject::Type type) {
+        auto bo = ctx->createUntrackedBufferObject(size, type);
+        VPUX_ELF_THROW_WHEN(bo == nullptr, elf::AllocError, "Failed to allocate device buffer");
+
+        auto *ptr = bo->getBasePointer();
+        auto [it, success] = tracedElfParserBuffers.emplace(ptr, TracedBuffer{bo, 0});
+        VPUX_ELF_THROW_WHEN(!success, elf::AllocError, "Failed to trace new device buffer");
+        return bo;
+    }
+
+    std::pair<std::shared_ptr<VPU::VPUBufferObject>, size_t>
+    allocateFromArena(VPU::VPUBufferObject::Type type, size_t size, size_t alignment) {
+        auto it = arenas.find(type);
+        if (it == arenas.end() || size > it->second.reservedSize)
+            return {nullptr, 0};
+
+        auto &arena = it->second;
+        if (arena.bo == nullptr)
+            arena.bo = allocateBufferObject(arena.reservedSize, type);
+
+        alignment = std::max(alignment, size_t{1});
+        size_t offset = (arena.used + alignment - 1) / alignment * alignment;
+        if (offset + size > arena.bo->getAllocSize())
+            return {nullptr, 0};
+
+        arena.used = offset + size;
+        return {arena.bo, offset};
+    }
+
     mutable std::mutex mtx;
     VPU::VPUDeviceContext *ctx;
-    std::map<const void *, std::shared_ptr<VPU::VPUBufferObject>, std::greater<const void *>>
-        tracedElfParserBuffers;
+    std::map<const void *, TracedBuffer, std::greater<const void *>> tracedElfParserBuffers;
+    std::map<VPU::VPUBufferObject::Type, Arena> arenas;
+    std::map<VPU::VPUBufferObject::Type, std::shared_ptr<VPU::VPUBufferObject>> zeroSizedBuffers;
 };
 
 class DriverAccessManager : public elf::AccessManager {
@@ -283,23 +388,27 @@ class DriverAccessManager : public elf::AccessManager {
     }
 
   private:
-    static bool hasNPUAccess(uint64_t flags) {
-        return (flags & (elf::SHF_EXECINSTR | elf::VPU_SHF_PROC_DMA | elf::VPU_SHF_PROC_SHAVE |
-                         elf::SHF_ALLOC)) != 0;
-    }
-
     DriverBufferManager *bufferManager = nullptr;
     BlobContainer *blobContainer = nullptr;
 };
 
+static const Driver::L0EnvVariables &getEnvVariables() {
+    static const Driver::L0EnvVariables defaultEnvVariables = {};
+    Driver *driver = Driver::getInstance();
+    return driver ? driver->getEnvVariables() : defaultEnvVariables;
+}
+
 ElfParser::ElfParser(VPU::VPUDeviceContext *ctx,
-                     std::unique_ptr<elf::BufferManager> buffer,
+                     std::unique_ptr<DriverBufferManager> buffer,
                      std::unique_ptr<elf::AccessManager> access,
                      std::shared_ptr<elf::HostParsedInference> hpi)
     : ctx(ctx)
     , bufferManager(std::move(buffer))
     , accessManager(std::move(access))
-    , hpiManager(std::make_unique<HostParsedInferenceManager>(std::move(hpi))) {}
+    , hpiManager(std::make_unique<HostParsedInferenceManager>(
+          std::move(hpi),
+          getEnvVariables().hpiPoolSize,
+          [manager = bufferManager.get()] { manager->startInferenceCopy(); })) {}
 
 ElfParser::~ElfParser() {
     ctx->scratchCachePrune(getSharedScratchSize());
@@ -431,34 +540,148 @@ static void loadHostParsedInference(const std::shared_ptr<elf::HostParsedInferen
     throw DriverError(ZE_RESULT_ERROR_UNKNOWN);
 }
 
-std::shared_ptr<elf::HostParsedInference> HostParsedInferenceManager::acquire() {
-    std::lock_guard<std::mutex> lock(mtx);
+static TraceCounter hpiPoolSize("HPI pool size");
+
+HostParsedInferenceManager::~HostParsedInferenceManager() {
+    hpiPoolSize.add(-static_cast<int64_t>(hpis.size()));
+    logStatistics();
+}
+
+void HostParsedInferenceManager::logStatistics() {
+    LOG(GRAPH,
+        "HPI pool statistics: hits: %lu, copies: %lu, unpooled copies: %lu, trimmed: %lu",
+        stats.hits,
+        stats.copies,
+        stats.unpooledCopies,
+        stats.trimmed);
+}
+
+void HostParsedInferenceManager::load() {
     if (!loaded) {
         loadHostParsedInference(headHpi);
         loaded = true;
     }
+}
+
+std::shared_ptr<elf::HostParsedInference> HostParsedInferenceManager::acquire() {
+    std::lock_guard<std::mutex> lock(mtx);
+    load();
 
-    if (headHpi.use_count() == 1)
+    if (headHpi.use_count() == 1) {
+        stats.hits++;
         return headHpi;
+    }
 
     for (auto &hpi : hpis) {
         if (hpi.use_count() == 1) {
+            stats.hits++;
             return hpi;
         }
     }
 
+    if (onCopy)
+        onCopy();
     auto hpi = copyHostParsedInference(headHpi);
-    if (hpi != nullptr) {
+    if (hpi == nullptr)
+        return nullptr;
+
+    if (hpis.size() < highWaterMark) {
         hpis.push_back(hpi);
+        hpiPoolSize.add(1);
+        stats.copies++;
+    } else {
+        LOG(GRAPH, "HPI pool reached high-water mark %lu, copy is not pooled", highWaterMark);
+        stats.unpooledCopies++;
     }
-
     return hpi;
 }
 
+void HostParsedInferenceManager::prewarm(size_t count) {
+    std::lock_guard<std::mutex> lock(mtx);
+    load();
+
+    size_t poolSize = std::min(count > 0 ? count - 1 : 0, highWaterMark);
+    while (hpis.size() < poolSize) {
+        if (onCopy)
+            onCopy();
+        auto hpi = copyHostParsedInference(headHpi);
+        if (hpi == nullptr)
+            break;
+
+        hpis.push_back(std::move(hpi));
+        hpiPoolSize.add(1);
+        stats.copies++;
+    }
+    LOG(GRAPH, "HPI pool prewarmed to %lu copies", hpis.size());
+}
+
+void HostParsedInferenceManager::trim() {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t poolSize = hpis.size();
+    hpis.erase(std::remove_if(hpis.begin(),
+                              hpis.end(),
+                              [](const auto &hpi) { return hpi.use_count() == 1; }),
+               hpis.end());
+    stats.trimmed += poolSize - hpis.size();
+    hpiPoolSize.add(static_cast<int64_t>(hpis.size()) - static_cast<int64_t>(poolSize));
+    LOG(GRAPH, "Trimmed %lu HPI copies, remaining: %lu", poolSize - hpis.size(), hpis.size());
+    logStatistics();
+}
+
+size_t HostParsedInferenceManager::getPoolSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return hpis.size();
+}
+
+HostParsedInferenceManager::Statistics HostParsedInferenceManager::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return stats;
+}
+
+/*
+ * Sum the sizes of sections that are loaded to device memory, per buffer type. Sections that are
+ * imported from blob backing store are skipped. Runtime allocations of loader are not listed in
+ * section table, they are served from arena space left after sections or from separate buffers.
+ */
+static void reserveSectionArenas(DriverBufferManager &bufferManager, const BlobContainer &blob) {
+    if (blob.size < sizeof(elf::ELFHeader))
+        return;
+
+    const auto *header = reinterpret_cast<const elf::ELFHeader *>(blob.ptr);
+    if (header->e_shentsize != sizeof(elf::SectionHeader) || header->e_shoff > blob.size ||
+        header->e_shnum > (blob.size - header->e_shoff) / sizeof(elf::SectionHeader)) {
+        LOG(GRAPH, "Section table not found, arena is not used");
+        return;
+    }
+
+    std::map<VPU::VPUBufferObject::Type, size_t> sizes;
+    const auto *sections =
+        reinterpret_cast<const elf::SectionHeader *>(blob.ptr + header->e_shoff);
+    for (size_t i = 0; i < header->e_shnum; i++) {
+        const auto &section = sections[i];
+        if (section.sh_size == 0 || !hasNPUAccess(section.sh_flags))
+            continue;
+
+        if (blob.hasBackingStore() && section.sh_flags == (elf::VPU_SHF_PROC_DMA | elf::SHF_ALLOC))
+            continue;
+
+        size_t alignment = std::max(section.sh_addralign, elf::Elf_Xword{1});
+        auto &size = sizes[DriverBufferManager::getBufferType(section.sh_flags)];
+        size = (size + alignment - 1) / alignment * alignment + section.sh_size;
+    }
+
+    for (const auto &[type, size] : sizes) {
+        LOG(GRAPH, "Reserved arena of type %#x, size: %#lx", static_cast<uint32_t>(type), size);
+        bufferManager.reserveArena(type, size);
+    }
+}
+
 std::unique_ptr<ElfParser> ElfParser::getElfParser(VPU::VPUDeviceContext *ctx,
                                                    const std::unique_ptr<BlobContainer> &blob,
                                                    std::string &logBuffer) {
     auto bufferManager = std::make_unique<DriverBufferManager>(ctx);
+    if (!getEnvVariables().disableElfArena)
+        reserveSectionArenas(*bufferManager, *blob);
     auto accessManager = std::make_unique<DriverAccessManager>(blob.get(), bufferManager.get());
     auto hpi = createHostParsedInference(bufferManager.get(), accessManager.get(), ctx, logBuffer);
     if (hpi != nullptr)
@@ -834,13 +1057,13 @@ bool ElfParser::getProfilingSize(uint32_t &size) const {
 std::shared_ptr<VPU::VPUBufferObject> ElfParser::findBuffer(const void *ptr) {
     if (bufferManager == nullptr)
         return nullptr;
-    return dynamic_cast<DriverBufferManager &>(*bufferManager).findBuffer(ptr);
+    return bufferManager->findBuffer(ptr);
 }
 
 size_t ElfParser::getSharedScratchSize() const {
     if (bufferManager == nullptr)
         return 0;
-    return dynamic_cast<DriverBufferManager &>(*bufferManager).sharedScratchSize;
+    return bufferManager->sharedScratchSize;
 }
 
 void ElfParser::updateSharedScratchBuffers(std::shared_ptr<elf::HostParsedInference> &cmdHpi,
@@ -867,6 +1090,7 @@ bool ElfParser::applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &cmd
                                   GraphProfilingQuery *profilingQuery,
                                   std::vector<std::shared_ptr<VPU::VPUBufferObject>> &bos) {
     auto getDeviceBuffers = [this, &bos](const std::vector<const void *> &ptrs,
+                                         size_t boIndex,
                                          std::vector<elf::DeviceBuffer> &buffers) {
         buffers.reserve(ptrs.size());
 
@@ -875,7 +1099,9 @@ bool ElfParser::applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &cmd
         }
 
         for (size_t i = 0; i < ptrs.size(); i++) {
-            auto bo = ctx->findBufferObject(ptrs[i]);
+            auto &bo = bos[boIndex + i];
+            if (bo == nullptr)
+                bo = ctx->findBufferObject(ptrs[i]);
             if (bo == nullptr) {
                 LOG_E("Failed to find a user buffer");
                 return false;
@@ -892,8 +1118,6 @@ bool ElfParser::applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &cmd
                 return false;
             }
 
-            bos.push_back(bo);
-
             uint64_t vpuAddr = bo->getVPUAddr(ptrs[i]);
             uint8_t *basePtr = static_cast<uint8_t *>(const_cast<void *>(ptrs[i]));
             buffers[i] = elf::DeviceBuffer(basePtr, vpuAddr, 0);
@@ -902,12 +1126,14 @@ bool ElfParser::applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &cmd
         return true;
     };
 
+    bos.resize(inputPtrs.size() + outputPtrs.size() + (profilingQuery ? 1 : 0));
+
     std::vector<elf::DeviceBuffer> inputDeviceBuffers = cmdHpi->getInputBuffers();
-    if (!getDeviceBuffers(inputPtrs, inputDeviceBuffers))
+    if (!getDeviceBuffers(inputPtrs, 0, inputDeviceBuffers))
         return false;
 
     std::vector<elf::DeviceBuffer> outputDeviceBuffers = cmdHpi->getOutputBuffers();
-    if (!getDeviceBuffers(outputPtrs, outputDeviceBuffers))
+    if (!getDeviceBuffers(outputPtrs, inputPtrs.size(), outputDeviceBuffers))
         return false;
 
     for (const auto &[i, strides] : inputStrides) {
@@ -925,7 +1151,7 @@ bool ElfParser::applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &cmd
         if (!profilingMemPtr || !profilingBo)
             return false;
 
-        bos.push_back(profilingBo);
+        bos.back() = profilingBo;
         profilingDeviceBuffers.emplace_back(profilingMemPtr,
                                             profilingBo->getVPUAddr(profilingMemPtr),
                                             profilingQuery->getSize());
@@ -1031,6 +1257,8 @@ ze_result_t ElfParser::parse(std::vector<GraphArgumentProperties> &argumentPrope
 ze_result_t ElfParser::initialize() {
     try {
         hpiManager->acquire();
+        // Prepare HPIs for the expected number of command lists executing graph concurrently
+        hpiManager->prewarm(getEnvVariables().hpiPoolPrewarm);
         return ZE_RESULT_SUCCESS;
     } catch (const DriverError &e) {
         return e.result();
@@ -1038,13 +1266,14 @@ ze_result_t ElfParser::initialize() {
     return ZE_RESULT_ERROR_UNKNOWN;
 }
 
+void ElfParser::releaseMemory() {
+    hpiManager->trim();
+}
+
 std::shared_ptr<VPU::VPUBufferObject> ElfParser::allocateInternal(size_t size) {
-    if (!size)
+    if (!size || bufferManager == nullptr)
         return nullptr;
-    elf::BufferSpecs spec = {};
-    spec.size = size;
-    elf::DeviceBuffer buffer = bufferManager->allocate(spec);
-    return findBuffer(buffer.cpu_addr());
+    return bufferManager->allocateInternal(size);
 }
 
 std::shared_ptr<VPU::VPUCommand> ElfParser::allocateInitCommand(VPU::VPUDeviceContext *ctx) {
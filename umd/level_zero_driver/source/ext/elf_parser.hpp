@@ -15,6 +15,7 @@
 #include "vpu_driver/source/command/command.hpp"
 #include "vpux_elf/utils/version.hpp"
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -27,7 +28,6 @@
 
 namespace elf {
 class AccessManager;
-class BufferManager;
 } // namespace elf
 
 namespace VPU {
@@ -39,28 +39,68 @@ class VPUInferenceExecute;
 namespace L0 {
 
 class BlobContainer;
+class DriverBufferManager;
 struct GraphProfilingQuery;
 struct GraphArgumentProperties;
 
 class HostParsedInferenceManager {
   public:
-    HostParsedInferenceManager(std::shared_ptr<elf::HostParsedInference> hpi)
-        : headHpi(std::move(hpi)) {}
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t copies = 0;
+        uint64_t unpooledCopies = 0;
+        uint64_t trimmed = 0;
+    };
+
+    /* onCopy is called before every copy of head HPI allocates its buffers */
+    HostParsedInferenceManager(std::shared_ptr<elf::HostParsedInference> hpi,
+                               size_t highWaterMark,
+                               std::function<void()> onCopy = {})
+        : headHpi(std::move(hpi))
+        , highWaterMark(highWaterMark)
+        , onCopy(std::move(onCopy)) {}
+    ~HostParsedInferenceManager();
 
     std::shared_ptr<elf::HostParsedInference> &head() { return headHpi; }
+
+    /**
+     * Return HPI that is not used by any command. Copies of head HPI are kept in pool up to
+     * highWaterMark, copies above it are released together with the last command using them.
+     */
     std::shared_ptr<elf::HostParsedInference> acquire();
 
+    /**
+     * Copy head HPI until count HPIs, including head, can be acquired without copying. The pool
+     * does not grow above highWaterMark.
+     */
+    void prewarm(size_t count);
+
+    /**
+     * Release pooled HPIs that are not used by any command, head HPI is kept. Pool statistics
+     * are logged on every trim, so the effect of the pool is visible for a live graph.
+     */
+    void trim();
+
+    size_t getPoolSize();
+    Statistics getStatistics();
+
   private:
+    void load();
+    void logStatistics();
+
     std::mutex mtx;
     std::shared_ptr<elf::HostParsedInference> headHpi;
     std::vector<std::shared_ptr<elf::HostParsedInference>> hpis;
+    size_t highWaterMark;
+    std::function<void()> onCopy;
+    Statistics stats = {};
     bool loaded = false;
 };
 
 class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser> {
   public:
     ElfParser(VPU::VPUDeviceContext *ctx,
-              std::unique_ptr<elf::BufferManager> manager,
+              std::unique_ptr<DriverBufferManager> manager,
               std::unique_ptr<elf::AccessManager> access,
               std::shared_ptr<elf::HostParsedInference> loader);
     ~ElfParser();
@@ -80,6 +120,7 @@ class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser>
     bool getArgumentMetadata(std::vector<ze_graph_argument_metadata_t> &args) const;
     bool getProfilingSize(uint32_t &size) const;
     size_t getSharedScratchSize() const;
+    HostParsedInferenceManager &getHpiManager() { return *hpiManager; }
 
     std::shared_ptr<VPU::VPUInferenceExecute>
     createInferenceExecuteCommand(const std::vector<const void *> &inputPtrs,
@@ -93,6 +134,7 @@ class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser>
                       uint32_t &profilingOutputSize) override;
 
     ze_result_t initialize() override;
+    void releaseMemory() override;
     std::shared_ptr<VPU::VPUBufferObject> allocateInternal(size_t size) override;
 
     std::shared_ptr<VPU::VPUCommand> allocateInitCommand(VPU::VPUDeviceContext *ctx) override;
@@ -106,6 +148,10 @@ class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser>
 
     void updateSharedScratchBuffers(std::shared_ptr<elf::HostParsedInference> &hpi,
                                     std::shared_ptr<VPU::VPUBufferObject> &bo);
+    /**
+     * Relocate graph arguments in hpi. bos holds buffer object of each input, output and
+     * profiling buffer. Entries that are already set are reused, the rest is looked up by pointer.
+     */
     bool applyInputOutputs(std::shared_ptr<elf::HostParsedInference> &hpi,
                            const std::vector<const void *> &inputs,
                            const std::vector<const void *> &outputs,
@@ -117,7 +163,7 @@ class ElfParser : public IParser, public std::enable_shared_from_this<ElfParser>
 
   private:
     VPU::VPUDeviceContext *ctx;
-    std::unique_ptr<elf::BufferManager> bufferManager;
+    std::unique_ptr<DriverBufferManager> bufferManager;
     std::unique_ptr<elf::AccessManager> accessManager;
     std::unique_ptr<HostParsedInferenceManager> hpiManager;
 };
@@ -11,12 +11,14 @@
 #include "compiler.hpp"
 #include "disk_cache.hpp"
 #include "elf_parser.hpp"
+#include "graph_build_queue.hpp"
 #include "interface_parser.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "level_zero_driver/include/nested_structs_handler.hpp"
 #include "level_zero_driver/source/context.hpp"
 #include "level_zero_driver/source/device.hpp"
 #include "level_zero_driver/source/driver.hpp"
+#include "level_zero_driver/source/event.hpp"
 #include "npu_driver_compiler.h"
 #include "profiling_data.hpp"
 #include "umd_common.hpp"
@@ -29,6 +31,7 @@
 #include "vpux_hpi.hpp"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -55,12 +58,20 @@ static std::string &getLastFailLog() {
 GraphBuildLog::GraphBuildLog(Context *pCtx)
     : pContext(pCtx) {}
 
+GraphBuildLog::~GraphBuildLog() {
+    if (buildDone.valid())
+        buildDone.wait();
+}
+
 ze_result_t GraphBuildLog::getLogString(uint32_t *pSize, char *pBuildLog) {
     if (pSize == nullptr) {
         LOG_E("Input size pointer is NULL");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
+    if (buildDone.valid())
+        buildDone.wait();
+
     if (pBuildLog == nullptr) {
         *pSize = static_cast<uint32_t>(log.size() + 1);
         return ZE_RESULT_SUCCESS;
@@ -75,14 +86,22 @@ ze_result_t GraphBuildLog::destroy() {
     return ZE_RESULT_SUCCESS;
 }
 
-Graph::Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc, std::string &log)
+Graph::Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc)
     : pContext(pCtx)
     , ctx(pCtx->getDeviceContext())
     , desc(*pDesc)
-    , buildFlags(desc.pBuildFlags != nullptr ? desc.pBuildFlags : "") {
+    , buildFlags(desc.pBuildFlags != nullptr ? desc.pBuildFlags : "") {}
+
+Graph::Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc, std::string &log)
+    : Graph(pCtx, pDesc) {
     initialize(log);
 }
 
+Graph::~Graph() {
+    if (buildDone.valid())
+        buildDone.wait();
+}
+
 ze_result_t Graph::create(const ze_context_handle_t hContext,
                           const ze_device_handle_t hDevice,
                           const ze_graph_desc_2_t *pDesc,
@@ -124,6 +143,81 @@ ze_result_t Graph::create(const ze_context_handle_t hContext,
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t Graph::createAsync(const ze_context_handle_t hContext,
+                               const ze_device_handle_t hDevice,
+                               const ze_graph_desc_2_t *pDesc,
+                               ze_event_handle_t hEvent,
+                               ze_graph_handle_t *phGraph,
+                               ze_graph_build_log_handle_t *phGraphBuildLog) {
+    if (pDesc == nullptr) {
+        LOG_E("Invalid graph descriptor");
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (phGraph == nullptr) {
+        LOG_E("Invalid graph pointer to handle");
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    Context *pContext = Context::fromHandle(hContext);
+    if (pContext->getDeviceContext() == nullptr) {
+        LOG_E("Device Context failed to be retrieved");
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    auto pGraph = std::make_unique<Graph>(pContext, pDesc);
+    Graph *graph = pGraph.get();
+    auto promise = std::make_shared<std::promise<void>>();
+    graph->buildDone = promise->get_future().share();
+    graph->buildStatus = ZE_RESULT_NOT_READY;
+
+    // Graph, build log and event wait for the build when destroyed, so the worker can use them
+    std::string *logBuffer = &graph->asyncBuildLog;
+    if (phGraphBuildLog) {
+        auto logObject = std::make_unique<GraphBuildLog>(pContext);
+        logObject->setBuildDone(graph->buildDone);
+        logBuffer = &logObject->getBuffer();
+        *phGraphBuildLog = logObject->toHandle();
+        pContext->appendObject(std::move(logObject));
+    }
+
+    Event *event = hEvent != nullptr ? Event::fromHandle(hEvent) : nullptr;
+    if (event != nullptr)
+        event->associateHostTask(graph->buildDone);
+
+    Driver::getInstance()->getGraphBuildQueue().submit(
+        [graph]() {
+            try {
+                return graph->getBuildKey();
+            } catch (const std::exception &e) {
+                LOG_E("Exception caught, msg: '%s'", e.what());
+                return DiskCache::Key();
+            }
+        },
+        [graph, logBuffer, event, promise]() {
+            ze_result_t result = ZE_RESULT_SUCCESS;
+            try {
+                graph->initialize(*logBuffer);
+            } catch (const DriverError &err) {
+                result = err.result();
+            } catch (const std::exception &e) {
+                LOG_E("Exception caught, msg: '%s'", e.what());
+                result = ZE_RESULT_ERROR_UNKNOWN;
+            }
+            LOG(GRAPH, "Graph %p built asynchronously, result: %#x", graph, result);
+
+            graph->buildStatus = result;
+            if (event != nullptr)
+                event->hostSignal();
+            promise->set_value();
+        });
+
+    *phGraph = graph;
+    pContext->appendObject(std::move(pGraph));
+    LOG(GRAPH, "Graph created asynchronously - %p", *phGraph);
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t Graph::destroy() {
     pContext->removeObject(this);
     LOG(GRAPH, "Graph destroyed - %p", this);
@@ -131,6 +225,10 @@ ze_result_t Graph::destroy() {
 }
 
 ze_result_t Graph::getNativeBinary(size_t *pSize, uint8_t *pGraphNativeBinary) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pSize == nullptr) {
         LOG_E("Input size pointer is NULL");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -152,6 +250,10 @@ ze_result_t Graph::getNativeBinary(size_t *pSize, uint8_t *pGraphNativeBinary) {
 }
 
 ze_result_t Graph::getNativeBinary2(size_t *pSize, const uint8_t **pGraphNativeBinary) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     *pSize = blob->size;
     *pGraphNativeBinary = blob->ptr;
 
@@ -159,6 +261,10 @@ ze_result_t Graph::getNativeBinary2(size_t *pSize, const uint8_t **pGraphNativeB
 }
 
 ze_result_t Graph::setArgumentValue(uint32_t argIndex, const void *pArgValue) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pArgValue == nullptr)
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
 
@@ -214,6 +320,10 @@ std::optional<const void *> gatherArgumentValues(const void *pNext, size_t argIn
 }
 
 ze_result_t Graph::setArgumentValue2(uint32_t argIndex, const void *pArgValue) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pArgValue == nullptr)
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
 
@@ -234,6 +344,10 @@ ze_result_t Graph::setArgumentValue2(uint32_t argIndex, const void *pArgValue) {
 }
 
 ze_result_t Graph::getProperties(ze_graph_properties_t *pGraphProperties) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pGraphProperties == nullptr) {
         LOG_E("Invalid pointer");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -244,6 +358,10 @@ ze_result_t Graph::getProperties(ze_graph_properties_t *pGraphProperties) {
 }
 
 ze_result_t Graph::getProperties2(ze_graph_properties_2_t *pGraphProperties) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     pGraphProperties->numGraphArgs = safe_cast<uint32_t>(argumentProperties.size());
     pGraphProperties->initStageRequired = ZE_GRAPH_STAGE_INITIALIZE;
 
@@ -251,6 +369,10 @@ ze_result_t Graph::getProperties2(ze_graph_properties_2_t *pGraphProperties) {
 }
 
 ze_result_t Graph::getProperties3(ze_graph_properties_3_t *pGraphProperties) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     pGraphProperties->numGraphArgs = safe_cast<uint32_t>(argumentProperties.size());
     pGraphProperties->initStageRequired = ZE_GRAPH_STAGE_INITIALIZE;
     pGraphProperties->flags = propFlags;
@@ -277,6 +399,10 @@ std::optional<void *> setArgumentProperties(void *pNext, size_t argIndex, const
 
 ze_result_t Graph::getArgumentProperties(uint32_t argIndex,
                                          ze_graph_argument_properties_t *pGraphArgProps) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pGraphArgProps == nullptr) {
         LOG_E("Invalid pointer for argument properties");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -308,6 +434,10 @@ ze_result_t Graph::getArgumentProperties(uint32_t argIndex,
 
 ze_result_t Graph::getArgumentProperties2(uint32_t argIndex,
                                           ze_graph_argument_properties_2_t *pGraphArgProps) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pGraphArgProps == nullptr) {
         LOG_E("Invalid pointer for argument properties");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -338,6 +468,10 @@ ze_result_t Graph::getArgumentProperties2(uint32_t argIndex,
 
 ze_result_t Graph::getArgumentProperties3(uint32_t argIndex,
                                           ze_graph_argument_properties_3_t *pGraphArgProps) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pGraphArgProps == nullptr) {
         LOG_E("Invalid pointer for argument properties");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -366,6 +500,10 @@ ze_result_t Graph::getArgumentProperties3(uint32_t argIndex,
 
 ze_result_t Graph::getArgumentMetadata(uint32_t argIndex,
                                        ze_graph_argument_metadata_t *pGraphArgMetadata) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (pGraphArgMetadata == nullptr) {
         LOG_E("Invalid pointer for argument properties");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
@@ -389,6 +527,10 @@ ze_result_t Graph::getArgumentMetadata(uint32_t argIndex,
 
 ze_result_t Graph::createProfilingPool(uint32_t count,
                                        ze_graph_profiling_pool_handle_t *phProfilingPool) {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     if (!parser) {
         LOG_E("Graph object is not properly initialized!");
         return ZE_RESULT_ERROR_DEVICE_LOST;
@@ -642,20 +784,39 @@ static void addImportedBufferFromBlob(VPU::VPUDeviceContext *ctx, BlobContainer
     }
 }
 
+void Graph::prepareNGraphLite() {
+    if (ngraphLitePrepared)
+        return;
+
+    addDeviceConfigToBuildFlags();
+    desc.pBuildFlags = buildFlags.c_str();
+    if (!(desc.flags & ZE_GRAPH_FLAG_DISABLE_CACHING))
+        cacheKey = Driver::getInstance()->getDiskCache().computeKey(desc);
+    ngraphLitePrepared = true;
+}
+
+DiskCache::Key Graph::getBuildKey() {
+    if (desc.format != ZE_GRAPH_FORMAT_NGRAPH_LITE || desc.pInput == nullptr ||
+        desc.inputSize == 0)
+        return {};
+
+    prepareNGraphLite();
+    return cacheKey;
+}
+
 std::unique_ptr<BlobContainer> Graph::getBlobContainerNGraphLite(std::string &log) {
     std::unique_ptr<BlobContainer> blob;
     DiskCache &cache = Driver::getInstance()->getDiskCache();
-    DiskCache::Key key;
     bool cacheDisabled = desc.flags & ZE_GRAPH_FLAG_DISABLE_CACHING;
 
-    addDeviceConfigToBuildFlags();
-    desc.pBuildFlags = buildFlags.c_str();
+    prepareNGraphLite();
 
     std::string &lastFailLog = getLastFailLog();
 
+    /* Held until the compiled blob is stored, other processes wait for it instead of compiling */
+    std::unique_ptr<DiskCache::EntryLock> cacheLock;
     if (!cacheDisabled) {
-        key = cache.computeKey(desc);
-        blob = cache.getBlob(key);
+        blob = cache.getBlobOrLock(cacheKey, cacheLock);
         if (blob) {
             log += "ZE DynamicCaching cache_status_t: cache_status_t::found\n";
             /* Cache status is stored also in fail log due to back compatibility */
@@ -674,7 +835,7 @@ std::unique_ptr<BlobContainer> Graph::getBlobContainerNGraphLite(std::string &lo
     }
 
     if (!cacheDisabled) {
-        blob = cache.setBlob(key, std::move(blob));
+        blob = cache.setBlob(cacheKey, std::move(blob));
         log += "ZE DynamicCaching cache_status_t: cache_status_t::stored\n";
         /* Cache status is stored also in fail log due to back compatibility */
         lastFailLog = "ZE DynamicCaching cache_status_t: cache_status_t::stored\n";
@@ -743,9 +904,19 @@ void Graph::initialize(std::string &log) {
 }
 
 ze_result_t Graph::parserInitialize() {
+    ze_result_t status = getBuildStatus();
+    if (status != ZE_RESULT_SUCCESS)
+        return status;
+
     return parser->initialize();
 }
 
+void Graph::releaseMemory() {
+    // Parser is set by the worker until the asynchronous build completes
+    if (getBuildStatus() == ZE_RESULT_SUCCESS && parser)
+        parser->releaseMemory();
+}
+
 std::shared_ptr<VPU::VPUCommand> Graph::allocateGraphInitCommand(VPU::VPUDeviceContext *ctx) {
     return parser->allocateInitCommand(ctx);
 }
@@ -11,10 +11,13 @@
 #include <stdint.h>
 
 #include "blob_container.hpp"
+#include "disk_cache.hpp"
 #include "level_zero_driver/include/l0_handler.hpp"
 #include "umd_common.hpp"
 #include "vpu_driver/source/command/command.hpp"
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -39,6 +42,7 @@ struct GraphProfilingQuery;
 
 struct GraphBuildLog : _ze_graph_build_log_handle_t, IContextObject {
     GraphBuildLog(Context *pCtx);
+    ~GraphBuildLog();
     static GraphBuildLog *fromHandle(ze_graph_build_log_handle_t handle) {
         return static_cast<GraphBuildLog *>(handle);
     }
@@ -47,10 +51,13 @@ struct GraphBuildLog : _ze_graph_build_log_handle_t, IContextObject {
     inline ze_graph_build_log_handle_t toHandle() { return this; }
     ze_result_t getLogString(uint32_t *pSize, char *pBuildLog);
     std::string &getBuffer() { return log; }
+    /* Log is written by asynchronous build, it is read and destroyed after the build completes */
+    void setBuildDone(std::shared_future<void> build) { buildDone = std::move(build); }
 
   private:
     Context *pContext;
     std::string log;
+    std::shared_future<void> buildDone;
 };
 
 struct GraphArgumentProperties {
@@ -59,14 +66,29 @@ struct GraphArgumentProperties {
 };
 
 struct Graph : _ze_graph_handle_t, IContextObject {
+    Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc);
     Graph(Context *pCtx, const ze_graph_desc_2_t *pDesc, std::string &log);
-    ~Graph() = default;
+    ~Graph();
 
     static ze_result_t create(const ze_context_handle_t hContext,
                               const ze_device_handle_t hDevice,
                               const ze_graph_desc_2_t *pDesc,
                               ze_graph_handle_t *phGraph,
                               ze_graph_build_log_handle_t *phGraphBuildLog = nullptr);
+    /**
+     * Return graph handle immediately and build the graph on GraphBuildQueue worker. hEvent is
+     * signaled when the build completes, getBuildStatus returns its result. Other graph functions
+     * return the build status until the build succeeds. Input of pDesc has to stay valid until
+     * completion, graph, build log and event are destroyed after the build completes.
+     */
+    static ze_result_t createAsync(const ze_context_handle_t hContext,
+                                   const ze_device_handle_t hDevice,
+                                   const ze_graph_desc_2_t *pDesc,
+                                   ze_event_handle_t hEvent,
+                                   ze_graph_handle_t *phGraph,
+                                   ze_graph_build_log_handle_t *phGraphBuildLog = nullptr);
+    /* ZE_RESULT_NOT_READY while the graph created by createAsync is built */
+    ze_result_t getBuildStatus() const { return buildStatus.load(); }
     ze_result_t destroy();
     ze_result_t getNativeBinary(size_t *pSize, uint8_t *pGraphNativeBinary);
     ze_result_t getNativeBinary2(size_t *pSize, const uint8_t **pGraphNativeBinary);
@@ -101,6 +123,7 @@ struct Graph : _ze_graph_handle_t, IContextObject {
     inline ze_graph_handle_t toHandle() { return this; }
 
     ze_result_t parserInitialize();
+    void releaseMemory() override;
 
     std::shared_ptr<VPU::VPUCommand> allocateGraphInitCommand(VPU::VPUDeviceContext *ctx);
     std::shared_ptr<VPU::VPUCommand>
@@ -122,6 +145,8 @@ struct Graph : _ze_graph_handle_t, IContextObject {
 
   private:
     void initialize(std::string &log);
+    void prepareNGraphLite();
+    DiskCache::Key getBuildKey();
     std::unique_ptr<BlobContainer> getBlobContainerNative();
     std::unique_ptr<BlobContainer> getBlobContainerNGraphLite(std::string &log);
     friend std::optional<const void *>
@@ -133,6 +158,8 @@ struct Graph : _ze_graph_handle_t, IContextObject {
     VPU::VPUDeviceContext *ctx;
     ze_graph_desc_2_t desc;
     std::string buildFlags;
+    bool ngraphLitePrepared = false;
+    DiskCache::Key cacheKey;
     std::unique_ptr<BlobContainer> blob;
     ze_graph_properties_flags_t propFlags = 0;
 
@@ -148,6 +175,11 @@ struct Graph : _ze_graph_handle_t, IContextObject {
 
     std::shared_ptr<IParser> parser = nullptr;
     std::unordered_map<void *, std::unique_ptr<GraphProfilingPool>> profilingPools;
+
+    std::atomic<ze_result_t> buildStatus = ZE_RESULT_SUCCESS;
+    std::shared_future<void> buildDone;
+    /* Build log of asynchronous build when build log handle is not requested */
+    std::string asyncBuildLog;
 };
 
 } // namespace L0
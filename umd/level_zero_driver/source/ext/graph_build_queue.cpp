@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "graph_build_queue.hpp"
+
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace L0 {
+
+GraphBuildQueue::GraphBuildQueue(size_t maxWorkers)
+    : maxWorkers(std::max(maxWorkers, size_t(1))) {}
+
+GraphBuildQueue::~GraphBuildQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    taskCv.notify_all();
+
+    for (auto &worker : workers)
+        worker.join();
+}
+
+size_t GraphBuildQueue::getDefaultWorkerCount() {
+    return std::max(std::thread::hardware_concurrency() / 2, 1u);
+}
+
+uint64_t GraphBuildQueue::getDeduplicatedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return deduplicatedCount;
+}
+
+void GraphBuildQueue::submit(std::function<Key()> &&getKey, std::function<void()> &&build) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Task task;
+    task.getKey = std::move(getKey);
+    task.build = std::move(build);
+    tasks.push_back(std::move(task));
+    if (tasks.size() > idleWorkers && workers.size() < maxWorkers) {
+        workers.emplace_back(&GraphBuildQueue::run, this);
+        LOG(GRAPH, "Started graph build worker %lu of %lu", workers.size(), maxWorkers);
+    }
+    taskCv.notify_one();
+}
+
+bool GraphBuildQueue::startTask(Task &task) {
+    if (task.deduplicated || task.key.empty())
+        return true;
+
+    auto [it, inserted] = inFlight.try_emplace(task.key);
+    if (inserted)
+        return true;
+
+    LOG(GRAPH, "Graph build waits for identical build in flight");
+    deduplicatedCount++;
+    task.deduplicated = true;
+    it->second.push_back(std::move(task));
+    return false;
+}
+
+void GraphBuildQueue::completeTask(const Task &task) {
+    if (task.deduplicated || task.key.empty())
+        return;
+
+    auto node = inFlight.extract(task.key);
+    auto &parked = node.mapped();
+    if (parked.empty())
+        return;
+
+    tasks.insert(tasks.begin(),
+                 std::make_move_iterator(parked.begin()),
+                 std::make_move_iterator(parked.end()));
+    taskCv.notify_all();
+}
+
+void GraphBuildQueue::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        idleWorkers++;
+        taskCv.wait(lock, [this] { return stopping || !tasks.empty(); });
+        idleWorkers--;
+        if (tasks.empty())
+            break;
+
+        Task task = std::move(tasks.front());
+        tasks.pop_front();
+
+        if (!task.keyReady) {
+            lock.unlock();
+            task.key = task.getKey();
+            task.keyReady = true;
+            lock.lock();
+        }
+
+        if (!startTask(task))
+            continue;
+
+        lock.unlock();
+        task.build();
+        lock.lock();
+
+        completeTask(task);
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace L0 {
+
+/**
+ * Bounded pool of driver worker threads that build graphs created asynchronously. Every build is
+ * identified by a key computed on the worker, identical builds have the same non-empty key. Build
+ * that is submitted while an identical build is running is parked without occupying a worker and
+ * it is queued again when the running build completes, so it can load the result from disk cache.
+ * Worker threads are started on demand. Destructor completes all submitted builds.
+ */
+class GraphBuildQueue {
+  public:
+    using Key = std::string;
+
+    explicit GraphBuildQueue(size_t maxWorkers);
+    ~GraphBuildQueue();
+
+    GraphBuildQueue(const GraphBuildQueue &) = delete;
+    GraphBuildQueue &operator=(const GraphBuildQueue &) = delete;
+
+    /* Queue build, getKey and build are called on a worker thread and must not throw */
+    void submit(std::function<Key()> &&getKey, std::function<void()> &&build);
+
+    size_t getMaxWorkers() const { return maxWorkers; }
+    /* Number of builds that waited for an identical build to complete */
+    uint64_t getDeduplicatedCount() const;
+
+    /* Default number of workers, half of the available cores */
+    static size_t getDefaultWorkerCount();
+
+  private:
+    struct Task {
+        std::function<Key()> getKey;
+        std::function<void()> build;
+        Key key;
+        bool keyReady = false;
+        bool deduplicated = false;
+    };
+
+    void run();
+    bool startTask(Task &task);
+    void completeTask(const Task &task);
+
+    const size_t maxWorkers;
+
+    mutable std::mutex mutex;
+    std::condition_variable taskCv;
+    std::deque<Task> tasks;
+    std::unordered_map<Key, std::vector<Task>> inFlight;
+    std::vector<std::thread> workers;
+    size_t idleWorkers = 0;
+    uint64_t deduplicatedCount = 0;
+    bool stopping = false;
+};
+
+} // namespace L0
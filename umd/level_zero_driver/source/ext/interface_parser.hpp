@@ -25,6 +25,7 @@ class IParser {
                               std::vector<ze_graph_argument_metadata_t> &args,
                               uint32_t &size) = 0;
     virtual ze_result_t initialize() = 0;
+    virtual void releaseMemory() {}
     virtual std::shared_ptr<VPU::VPUCommand> allocateInitCommand(VPU::VPUDeviceContext *ctx) = 0;
     virtual std::shared_ptr<VPU::VPUBufferObject> allocateInternal(size_t size) = 0;
     virtual std::shared_ptr<VPU::VPUCommand>
@@ -10,6 +10,7 @@
 #include "compiler.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "umd_common.hpp"
+#include "vpu_driver/source/command/command_buffer.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
@@ -51,12 +52,14 @@ GraphProfilingPool::GraphProfilingPool(const uint32_t size,
     memset(poolBuffer->getBasePointer(), 0, poolBuffer->getAllocSize());
 }
 
-GraphProfilingQuery::GraphProfilingQuery(const BlobContainer *blob,
+GraphProfilingQuery::GraphProfilingQuery(GraphProfilingPool *pool,
+                                         const BlobContainer *blob,
                                          const uint32_t size,
                                          void *pData,
                                          std::shared_ptr<VPU::VPUBufferObject> profilingMemoryBo,
                                          std::function<void()> &&destroyCb)
-    : size(size)
+    : pool(pool)
+    , size(size)
     , data(pData)
     , blob(blob)
     , profilingBo(std::move(profilingMemoryBo))
@@ -75,6 +78,7 @@ GraphProfilingPool::createProfilingQuery(const uint32_t index,
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
+    std::lock_guard<std::mutex> lock(queriesMutex);
     if (queries[index] != nullptr) {
         LOG_E("Index %u is occupied by GraphProfilingQuery (%p)", index, queries[index].get());
         return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
@@ -82,16 +86,70 @@ GraphProfilingPool::createProfilingQuery(const uint32_t index,
 
     auto *dataPtr = poolBuffer->getBasePointer() + (index * getFwDataCacheAlign(querySize));
     queries[index] =
-        std::make_unique<GraphProfilingQuery>(blob,
+        std::make_unique<GraphProfilingQuery>(this,
+                                              blob,
                                               querySize,
                                               dataPtr,
                                               poolBuffer,
-                                              [this, index]() { queries[index].reset(); });
+                                              [this, index]() {
+                                                  std::lock_guard<std::mutex> lock(queriesMutex);
+                                                  queries[index].reset();
+                                              });
     *phProfilingQuery = queries[index].get();
     LOG(GRAPH, "GraphProfilingQuery created - %p", *phProfilingQuery);
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t GraphProfilingPool::decodeQueries(ze_graph_profiling_type_t profilingType) {
+    if (profilingType != ZE_GRAPH_PROFILING_LAYER_LEVEL &&
+        profilingType != ZE_GRAPH_PROFILING_TASK_LEVEL) {
+        LOG_E("Invalid profiling type");
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    std::lock_guard<std::mutex> lock(queriesMutex);
+    std::vector<GraphProfilingQuery *> staleQueries;
+    std::vector<uint64_t> generations;
+    std::vector<std::pair<const uint8_t *, uint64_t>> profBuffers;
+    for (auto &query : queries) {
+        uint64_t currentGeneration = 0u;
+        if (query == nullptr || !query->needsDecode(profilingType, currentGeneration))
+            continue;
+
+        staleQueries.push_back(query.get());
+        generations.push_back(currentGeneration);
+        profBuffers.emplace_back(query->getQueryPtr(), query->getSize());
+    }
+
+    if (staleQueries.empty())
+        return ZE_RESULT_SUCCESS;
+
+    std::vector<std::vector<uint8_t>> decodedBuffers;
+    ze_result_t ret = Compiler::getDecodedProfilingBuffers(profilingType,
+                                                           *blob,
+                                                           profBuffers,
+                                                           decodedBuffers,
+                                                           getLastErrorMsg());
+    if (ret != ZE_RESULT_SUCCESS)
+        return ret;
+
+    for (size_t i = 0; i < staleQueries.size(); i++)
+        staleQueries[i]->setDecodedData(profilingType,
+                                        generations[i],
+                                        std::move(decodedBuffers[i]));
+
+    LOG(GRAPH, "Decoded %lu profiling queries of pool %p", staleQueries.size(), this);
+    return ZE_RESULT_SUCCESS;
+}
+
+static void copyDecodedBuffer(const std::vector<uint8_t> &buffer, uint32_t *pSize, uint8_t *pData) {
+    if (*pSize == 0 || *pSize > buffer.size())
+        *pSize = safe_cast<uint32_t>(buffer.size());
+
+    if (pData != nullptr)
+        memcpy(pData, buffer.data(), *pSize);
+}
+
 ze_result_t GraphProfilingQuery::getData(ze_graph_profiling_type_t profilingType,
                                          uint32_t *pSize,
                                          uint8_t *pData) {
@@ -100,16 +158,33 @@ ze_result_t GraphProfilingQuery::getData(ze_graph_profiling_type_t profilingType
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    std::string &lastErrorMsg = getLastErrorMsg();
     if (profilingType == ZE_GRAPH_PROFILING_LAYER_LEVEL ||
         profilingType == ZE_GRAPH_PROFILING_TASK_LEVEL) {
-        return Compiler::getDecodedProfilingBuffer(profilingType,
-                                                   *blob,
-                                                   static_cast<uint8_t *>(data),
-                                                   size,
-                                                   pSize,
-                                                   pData,
-                                                   lastErrorMsg);
+        if (copyDecodedData(profilingType, pSize, pData))
+            return ZE_RESULT_SUCCESS;
+
+        // Completed queries of the pool are decoded in one batch, the requested one among them
+        if (pool->decodeQueries(profilingType) == ZE_RESULT_SUCCESS &&
+            copyDecodedData(profilingType, pSize, pData))
+            return ZE_RESULT_SUCCESS;
+
+        // Raw data of running inference is still written, so its decoded data is not cached. The
+        // query is also decoded alone when the batch has failed on data of other query.
+        uint64_t currentGeneration = 0u;
+        bool cacheable = needsDecode(profilingType, currentGeneration);
+        std::vector<std::vector<uint8_t>> decodedBuffers;
+        ze_result_t ret = Compiler::getDecodedProfilingBuffers(profilingType,
+                                                               *blob,
+                                                               {{getQueryPtr(), size}},
+                                                               decodedBuffers,
+                                                               getLastErrorMsg());
+        if (ret != ZE_RESULT_SUCCESS)
+            return ret;
+
+        copyDecodedBuffer(decodedBuffers[0], pSize, pData);
+        if (cacheable)
+            setDecodedData(profilingType, currentGeneration, std::move(decodedBuffers[0]));
+        return ZE_RESULT_SUCCESS;
     }
 
     if (profilingType != ZE_GRAPH_PROFILING_RAW) {
@@ -126,6 +201,53 @@ ze_result_t GraphProfilingQuery::getData(ze_graph_profiling_type_t profilingType
     return ZE_RESULT_SUCCESS;
 }
 
+GraphProfilingQuery::DecodedData &
+GraphProfilingQuery::getDecodedData(ze_graph_profiling_type_t profilingType) {
+    return decodedData[profilingType == ZE_GRAPH_PROFILING_TASK_LEVEL ? 1 : 0];
+}
+
+bool GraphProfilingQuery::needsDecode(ze_graph_profiling_type_t profilingType,
+                                      uint64_t &currentGeneration) {
+    currentGeneration = generation.load(std::memory_order_acquire);
+    if (!isSubmissionCompleted())
+        return false;
+
+    std::lock_guard<std::mutex> lock(decodedMutex);
+    const DecodedData &decoded = getDecodedData(profilingType);
+    return !decoded.valid || decoded.generation != currentGeneration;
+}
+
+void GraphProfilingQuery::setDecodedData(ze_graph_profiling_type_t profilingType,
+                                         uint64_t decodedGeneration,
+                                         std::vector<uint8_t> &&buffer) {
+    std::lock_guard<std::mutex> lock(decodedMutex);
+    DecodedData &decoded = getDecodedData(profilingType);
+    decoded.buffer = std::move(buffer);
+    decoded.generation = decodedGeneration;
+    decoded.valid = true;
+}
+
+bool GraphProfilingQuery::copyDecodedData(ze_graph_profiling_type_t profilingType,
+                                          uint32_t *pSize,
+                                          uint8_t *pData) {
+    uint64_t currentGeneration = generation.load(std::memory_order_acquire);
+    if (!isSubmissionCompleted())
+        return false;
+
+    std::lock_guard<std::mutex> lock(decodedMutex);
+    const DecodedData &decoded = getDecodedData(profilingType);
+    if (!decoded.valid || decoded.generation != currentGeneration)
+        return false;
+
+    copyDecodedBuffer(decoded.buffer, pSize, pData);
+    return true;
+}
+
+bool GraphProfilingQuery::isSubmissionCompleted() const {
+    auto fence = std::atomic_load(&submission);
+    return fence == nullptr || fence->isSignaled();
+}
+
 ze_result_t GraphProfilingQuery::destroy() {
     destroyCb();
     LOG(GRAPH, "GraphProfilingQuery destroyed - %p", this);
@@ -155,12 +277,15 @@ ze_result_t GraphProfilingQuery::getLogString(uint32_t *pSize, char *pProfilingL
 }
 
 ze_result_t GraphProfilingPool::destroy() {
-    for (size_t i = 0; i < queries.size(); i++) {
-        if (queries[i] != nullptr) {
-            LOG_E("GraphProfilingQuery object (%p) at index (%lu) has not been destroyed",
-                  queries[i].get(),
-                  i);
-            return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    {
+        std::lock_guard<std::mutex> lock(queriesMutex);
+        for (size_t i = 0; i < queries.size(); i++) {
+            if (queries[i] != nullptr) {
+                LOG_E("GraphProfilingQuery object (%p) at index (%lu) has not been destroyed",
+                      queries[i].get(),
+                      i);
+                return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+            }
         }
     }
 
@@ -9,14 +9,18 @@
 
 #include <cstdint>
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <ze_api.h>
 #include <ze_graph_profiling_ext.h>
 
 namespace VPU {
 class VPUBufferObject;
+class VPUSubmissionFence;
 } // namespace VPU
 
 struct _ze_graph_profiling_query_handle_t {};
@@ -25,10 +29,12 @@ struct _ze_graph_profiling_pool_handle_t {};
 namespace L0 {
 
 class BlobContainer;
+struct GraphProfilingPool;
 
 struct GraphProfilingQuery : _ze_graph_profiling_query_handle_t {
   public:
-    GraphProfilingQuery(const BlobContainer *blob,
+    GraphProfilingQuery(GraphProfilingPool *pool,
+                        const BlobContainer *blob,
                         const uint32_t size,
                         void *queryPtrInput,
                         std::shared_ptr<VPU::VPUBufferObject> profilingMemoryBo,
@@ -47,12 +53,47 @@ struct GraphProfilingQuery : _ze_graph_profiling_query_handle_t {
     inline std::shared_ptr<VPU::VPUBufferObject> getBo() { return profilingBo; }
     inline uint32_t getSize() { return size; }
 
+    /**
+     * Called on every submission of an inference that writes to the query. The fence is signaled
+     * when completion of the inference is observed, nullptr if the completion is not tracked.
+     */
+    inline void onSubmit(std::shared_ptr<VPU::VPUSubmissionFence> fence) {
+        std::atomic_store(&submission, std::move(fence));
+        generation.fetch_add(1, std::memory_order_release);
+    }
+
+    /* Return true if the inference is completed and its decoded data is not cached yet */
+    bool needsDecode(ze_graph_profiling_type_t profilingType, uint64_t &currentGeneration);
+    void setDecodedData(ze_graph_profiling_type_t profilingType,
+                        uint64_t decodedGeneration,
+                        std::vector<uint8_t> &&buffer);
+
   private:
+    struct DecodedData {
+        bool valid = false;
+        uint64_t generation = 0u;
+        std::vector<uint8_t> buffer;
+    };
+    DecodedData &getDecodedData(ze_graph_profiling_type_t profilingType);
+    bool isSubmissionCompleted() const;
+    bool copyDecodedData(ze_graph_profiling_type_t profilingType, uint32_t *pSize, uint8_t *pData);
+
+    GraphProfilingPool *pool;
     uint32_t size = 0u;
     void *data = nullptr;
     const BlobContainer *blob;
     std::shared_ptr<VPU::VPUBufferObject> profilingBo;
     std::function<void()> destroyCb;
+
+    /*
+     * Decoded data is cached only when the last submitted inference is completed, it is valid until
+     * the query is written by the next submitted inference
+     */
+    std::atomic<uint64_t> generation = 0u;
+    std::shared_ptr<VPU::VPUSubmissionFence> submission;
+    std::mutex decodedMutex;
+    /* Layer and task level decoded data */
+    std::array<DecodedData, 2> decodedData;
 };
 
 struct GraphProfilingPool : _ze_graph_profiling_pool_handle_t {
@@ -66,6 +107,8 @@ struct GraphProfilingPool : _ze_graph_profiling_pool_handle_t {
     ze_result_t destroy();
     ze_result_t createProfilingQuery(const uint32_t index,
                                      ze_graph_profiling_query_handle_t *phProfilingQuery);
+    /* Decode all queries of completed inferences with stale decoded data in a single batch */
+    ze_result_t decodeQueries(ze_graph_profiling_type_t profilingType);
 
     inline ze_graph_profiling_pool_handle_t toHandle() { return this; }
     static GraphProfilingPool *fromHandle(ze_graph_profiling_pool_handle_t handle) {
@@ -77,6 +120,8 @@ struct GraphProfilingPool : _ze_graph_profiling_pool_handle_t {
     std::shared_ptr<VPU::VPUBufferObject> poolBuffer = nullptr;
     const BlobContainer *blob;
 
+    /* Guards the queries and serializes decoding, so the same data is decoded once */
+    std::mutex queriesMutex;
     std::vector<std::unique_ptr<GraphProfilingQuery>> queries;
     std::function<void(GraphProfilingPool *)> destroyCb;
 };
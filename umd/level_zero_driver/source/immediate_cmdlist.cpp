@@ -11,8 +11,10 @@
 #include "cmdqueue.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "level_zero_driver/api/prv/zex_driver.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "level_zero_driver/include/l0_handler.hpp"
+#include "level_zero_driver/include/nested_structs_handler.hpp"
 #include "vpu_driver/source/command/event_command.hpp"
 #include "vpu_driver/source/command/job.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
@@ -20,13 +22,17 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <ze_api.h>
 
 namespace L0 {
-ImmediateCommandList::ImmediateCommandList(Context *pCtx, CommandQueue *pCmdQueue)
+ImmediateCommandList::ImmediateCommandList(Context *pCtx,
+                                           CommandQueue *pCmdQueue,
+                                           uint32_t maxInFlightJobs)
     : CommandList(pCtx, false)
-    , pCommandQueue(pCmdQueue) {}
+    , pCommandQueue(pCmdQueue)
+    , maxInFlightJobs(maxInFlightJobs) {}
 
 ze_result_t ImmediateCommandList::create(ze_context_handle_t hContext,
                                          ze_device_handle_t hDevice,
@@ -48,6 +54,26 @@ ze_result_t ImmediateCommandList::create(ze_context_handle_t hContext,
         LOG_E("Invalid command list pointer");
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
     }
+
+    uint32_t maxInFlightJobs = 0;
+    auto handler = [&maxInFlightJobs](const void *pNext) -> std::optional<const void *> {
+        const auto *base = reinterpret_cast<const ze_base_desc_t *>(pNext);
+        if (static_cast<zex_structure_type_t>(base->stype) ==
+            ZEX_STRUCTURE_TYPE_COMMAND_QUEUE_PIPELINED_DESC) {
+            const auto *desc = reinterpret_cast<const zex_command_queue_pipelined_desc_t *>(pNext);
+            if (desc->maxInFlightJobs == 0) {
+                LOG_E("Invalid number of in-flight jobs for pipelined command list");
+                return std::nullopt;
+            }
+            maxInFlightJobs = desc->maxInFlightJobs;
+        }
+        return base->pNext;
+    };
+    if (!handleNestedStructs(altdesc->pNext, handler)) {
+        LOG_E("Invalid pNext chain in command queue descriptor");
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
     try {
         ze_result_t result;
         ze_command_queue_handle_t hCommandQueue = nullptr;
@@ -59,12 +85,16 @@ ze_result_t ImmediateCommandList::create(ze_context_handle_t hContext,
 
         auto pContext = Context::fromHandle(hContext);
         auto pCmdq = CommandQueue::fromHandle(hCommandQueue);
-        auto commandList = std::make_unique<ImmediateCommandList>(pContext, pCmdq);
+        auto commandList =
+            std::make_unique<ImmediateCommandList>(pContext, pCmdq, maxInFlightJobs);
 
         *phCommandList = commandList.get();
         pContext->appendObject(std::move(commandList));
 
-        LOG(CMDLIST, "CommandList created - %p", *phCommandList);
+        LOG(CMDLIST,
+            "CommandList created - %p, max in-flight jobs: %u",
+            *phCommandList,
+            maxInFlightJobs);
     } catch (const DriverError &err) {
         return err.result();
     }
@@ -90,7 +120,13 @@ ze_result_t ImmediateCommandList::isImmediate(ze_bool_t *pIsImmediate) {
 ze_result_t ImmediateCommandList::checkCommandAppendCondition() {
     ze_result_t result;
 
-    result = pCommandQueue->synchronize(std::numeric_limits<uint64_t>::max());
+    if (isPipelined()) {
+        // Leave room for the job that is going to be submitted by this append
+        result = pCommandQueue->retireJobs(maxInFlightJobs - 1, retiredJobs);
+        recycleRetiredJobs();
+    } else {
+        result = pCommandQueue->synchronize(std::numeric_limits<uint64_t>::max());
+    }
 
     if (!vpuJob || vpuJob->isClosed()) {
         reset();
@@ -98,6 +134,17 @@ ze_result_t ImmediateCommandList::checkCommandAppendCondition() {
     return result;
 }
 
+void ImmediateCommandList::recycleRetiredJobs() {
+    for (auto &job : retiredJobs) {
+        // Jobs associated with an event or a fence are still referenced by them
+        if (job.use_count() == 1 && freeJobs.size() < maxInFlightJobs) {
+            job->reset();
+            freeJobs.emplace_back(std::move(job));
+        }
+    }
+    retiredJobs.clear();
+}
+
 ze_result_t ImmediateCommandList::hostSynchronize(uint64_t timeout) {
     ze_result_t result = pCommandQueue->synchronize(timeout);
     if (result == ZE_RESULT_SUCCESS) {
@@ -176,7 +223,12 @@ ze_result_t ImmediateCommandList::postAppend() {
             LOG_E("Immediate command list execution failed");
             return result;
         }
-        vpuJob = std::make_shared<VPU::VPUJob>(ctx);
+        if (freeJobs.empty()) {
+            vpuJob = std::make_shared<VPU::VPUJob>(ctx);
+        } else {
+            vpuJob = std::move(freeJobs.back());
+            freeJobs.pop_back();
+        }
     }
     return ZE_RESULT_SUCCESS;
 }
@@ -10,14 +10,20 @@
 
 #include "cmdlist.hpp"
 
+#include <memory>
+#include <vector>
 #include <ze_api.h>
 
+namespace VPU {
+class VPUJob;
+} // namespace VPU
+
 namespace L0 {
 struct CommandQueue;
 struct Context;
 
 struct ImmediateCommandList : public CommandList {
-    ImmediateCommandList(Context *pCtx, CommandQueue *pCmdQueue);
+    ImmediateCommandList(Context *pCtx, CommandQueue *pCmdQueue, uint32_t maxInFlightJobs = 0);
 
     static ze_result_t create(ze_context_handle_t hContext,
                               ze_device_handle_t hDevice,
@@ -34,6 +40,13 @@ struct ImmediateCommandList : public CommandList {
     ze_result_t checkCommandAppendCondition() override;
     ze_result_t postAppend() override;
 
+    bool isPipelined() const { return maxInFlightJobs > 0; }
+    void recycleRetiredJobs();
+
     CommandQueue *pCommandQueue = nullptr;
+    // Pipelined mode only, 0 means that every append waits for the previous submission
+    uint32_t maxInFlightJobs = 0;
+    std::vector<std::shared_ptr<VPU::VPUJob>> retiredJobs;
+    std::vector<std::shared_ptr<VPU::VPUJob>> freeJobs;
 };
 } // namespace L0
@@ -85,6 +85,18 @@ ze_result_t Metric::getProperties(zet_metric_properties_t *pProperties) {
     return ZE_RESULT_SUCCESS;
 }
 
+static std::vector<zet_value_type_t>
+getResultTypes(const std::vector<std::shared_ptr<Metric>> &metrics) {
+    std::vector<zet_value_type_t> resultTypes;
+    resultTypes.reserve(metrics.size());
+    for (const auto &metric : metrics) {
+        zet_metric_properties_t properties = {};
+        metric->getProperties(&properties);
+        resultTypes.push_back(properties.resultType);
+    }
+    return resultTypes;
+}
+
 MetricGroup::MetricGroup(zet_metric_group_properties_t &propertiesInput,
                          size_t allocationSizeInput,
                          std::vector<std::shared_ptr<Metric>> &metricsInput,
@@ -94,7 +106,8 @@ MetricGroup::MetricGroup(zet_metric_group_properties_t &propertiesInput,
     , allocationSize(allocationSizeInput)
     , metrics(metricsInput)
     , groupIndex(groupIndexInput)
-    , numberOfMetricGroups(numberOfMetricGroupsInput) {}
+    , numberOfMetricGroups(numberOfMetricGroupsInput)
+    , calculator(getResultTypes(metrics), allocationSize) {}
 
 ze_result_t MetricGroup::getProperties(zet_metric_group_properties_t *pProperties) {
     if (pProperties == nullptr) {
@@ -174,11 +187,7 @@ ze_result_t MetricGroup::calculateMetricValues(size_t rawDataSize,
                                                const uint8_t *pRawData,
                                                uint32_t *pMetricValueCount,
                                                zet_typed_value_t *pMetricValues) {
-    size_t sampleCount = rawDataSize / allocationSize;
-
-    uint32_t metricCount = safe_cast<uint32_t>(metrics.size());
-
-    size_t metricValueCount = sampleCount * metricCount;
+    size_t metricValueCount = calculator.getValueCount(rawDataSize);
 
     if (*pMetricValueCount == 0) {
         *pMetricValueCount = static_cast<uint32_t>(metricValueCount);
@@ -186,37 +195,7 @@ ze_result_t MetricGroup::calculateMetricValues(size_t rawDataSize,
     }
 
     *pMetricValueCount = std::min(*pMetricValueCount, static_cast<uint32_t>(metricValueCount));
-
-    for (uint32_t i = 0; i < *pMetricValueCount; i++) {
-        zet_metric_properties_t properties = {};
-        metrics[i % metricCount]->getProperties(&properties);
-
-        pMetricValues[i].type = properties.resultType;
-
-        auto rawData = const_cast<uint8_t *>(pRawData);
-
-        switch (properties.resultType) {
-        case ZET_VALUE_TYPE_UINT32:
-            pMetricValues[i].value.ui32 = *reinterpret_cast<uint32_t *>(rawData);
-            break;
-        case ZET_VALUE_TYPE_UINT64:
-            pMetricValues[i].value.ui64 = *reinterpret_cast<uint64_t *>(rawData);
-            break;
-        case ZET_VALUE_TYPE_FLOAT32:
-            pMetricValues[i].value.fp32 = *reinterpret_cast<float *>(rawData);
-            break;
-        case ZET_VALUE_TYPE_FLOAT64:
-            pMetricValues[i].value.fp64 = *reinterpret_cast<double *>(rawData);
-            break;
-        case ZET_VALUE_TYPE_BOOL8:
-            pMetricValues[i].value.b8 = *reinterpret_cast<uint8_t *>(rawData);
-            break;
-        default:
-            break;
-        }
-
-        pRawData += allocationSize / metrics.size();
-    }
+    calculator.calculateValues(pRawData, *pMetricValueCount, pMetricValues);
 
     return ZE_RESULT_SUCCESS;
 }
@@ -237,43 +216,7 @@ ze_result_t MetricGroup::calculateMaxMetricValues(size_t rawDataSize,
         return ZE_RESULT_ERROR_INVALID_SIZE;
     }
 
-    uint32_t count = 0;
-    calculateMetricValues(rawDataSize, pRawData, &count, nullptr);
-
-    std::vector<zet_typed_value_t> metricValues(count);
-    calculateMetricValues(rawDataSize, pRawData, &count, metricValues.data());
-
-    for (uint8_t i = 0; i < count; i++) {
-        zet_metric_properties_t properties = {};
-        metrics[i % metricCount]->getProperties(&properties);
-
-        pMetricValues[i % metricCount].type = properties.resultType;
-
-        switch (properties.resultType) {
-        case ZET_VALUE_TYPE_UINT32:
-            pMetricValues[i % metricCount].value.ui32 =
-                std::max(pMetricValues[i % metricCount].value.ui32, metricValues[i].value.ui32);
-            break;
-        case ZET_VALUE_TYPE_UINT64:
-            pMetricValues[i % metricCount].value.ui64 =
-                std::max(pMetricValues[i % metricCount].value.ui64, metricValues[i].value.ui64);
-            break;
-        case ZET_VALUE_TYPE_FLOAT32:
-            pMetricValues[i % metricCount].value.fp32 =
-                std::max(pMetricValues[i % metricCount].value.fp32, metricValues[i].value.fp32);
-            break;
-        case ZET_VALUE_TYPE_FLOAT64:
-            pMetricValues[i % metricCount].value.fp64 =
-                std::max(pMetricValues[i % metricCount].value.fp64, metricValues[i].value.fp64);
-            break;
-        case ZET_VALUE_TYPE_BOOL8:
-            pMetricValues[i % metricCount].value.b8 =
-                std::max(pMetricValues[i % metricCount].value.b8, metricValues[i].value.b8);
-            break;
-        default:
-            break;
-        }
-    }
+    calculator.calculateMaxValues(pRawData, calculator.getReportCount(rawDataSize), pMetricValues);
 
     return ZE_RESULT_SUCCESS;
 }
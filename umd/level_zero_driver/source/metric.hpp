@@ -10,6 +10,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "metric_calculator.hpp"
 #include "vpu_driver/source/device/metric_info.hpp"
 
 #include <memory>
@@ -84,6 +85,7 @@ struct MetricGroup : _zet_metric_group_handle_t {
     std::vector<std::shared_ptr<Metric>> metrics;
     uint32_t groupIndex;
     size_t numberOfMetricGroups;
+    MetricCalculator calculator;
 };
 
 struct MetricContext {
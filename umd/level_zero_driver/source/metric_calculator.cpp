@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "metric_calculator.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+namespace L0 {
+
+static size_t getValueSize(zet_value_type_t type) {
+    switch (type) {
+    case ZET_VALUE_TYPE_UINT32:
+    case ZET_VALUE_TYPE_FLOAT32:
+        return sizeof(uint32_t);
+    case ZET_VALUE_TYPE_UINT64:
+    case ZET_VALUE_TYPE_FLOAT64:
+        return sizeof(uint64_t);
+    case ZET_VALUE_TYPE_BOOL8:
+        return sizeof(uint8_t);
+    default:
+        return 0u;
+    }
+}
+
+template <typename T>
+static void
+decodeColumn(const uint8_t *pSrc, size_t pitch, size_t count, uint64_t *__restrict pColumn) {
+    for (size_t i = 0; i < count; i++) {
+        T value;
+        memcpy(&value, pSrc + i * pitch, sizeof(T));
+        pColumn[i] = value;
+    }
+}
+
+template <typename T>
+static T fromSlot(uint64_t slot) {
+    T value;
+    memcpy(&value, &slot, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static uint64_t toSlot(T value) {
+    uint64_t slot = 0;
+    memcpy(&slot, &value, sizeof(T));
+    return slot;
+}
+
+template <typename T>
+static uint64_t reduceMax(const uint64_t *pColumn, size_t count, uint64_t current) {
+    T result = fromSlot<T>(current);
+    for (size_t i = 0; i < count; i++)
+        result = std::max(result, fromSlot<T>(pColumn[i]));
+    return toSlot(result);
+}
+
+MetricCalculator::MetricCalculator(std::vector<zet_value_type_t> valueTypesInput,
+                                   size_t reportSizeInput)
+    : valueTypes(std::move(valueTypesInput))
+    , reportSize(reportSizeInput) {
+    valueSizes.reserve(valueTypes.size());
+    for (auto type : valueTypes)
+        valueSizes.push_back(getValueSize(type));
+
+    if (!valueTypes.empty())
+        metricStride = reportSize / valueTypes.size();
+}
+
+size_t MetricCalculator::getReportCount(size_t rawDataSize) const {
+    return reportSize ? rawDataSize / reportSize : 0u;
+}
+
+void MetricCalculator::decodeBlock(const uint8_t *pReports,
+                                   size_t reportCount,
+                                   uint64_t *columns) const {
+    for (size_t m = 0; m < valueTypes.size(); m++) {
+        const uint8_t *pSrc = pReports + m * metricStride;
+        uint64_t *pColumn = columns + m * reportCount;
+
+        switch (valueSizes[m]) {
+        case sizeof(uint8_t):
+            decodeColumn<uint8_t>(pSrc, reportSize, reportCount, pColumn);
+            break;
+        case sizeof(uint32_t):
+            decodeColumn<uint32_t>(pSrc, reportSize, reportCount, pColumn);
+            break;
+        case sizeof(uint64_t):
+            decodeColumn<uint64_t>(pSrc, reportSize, reportCount, pColumn);
+            break;
+        default:
+            std::fill_n(pColumn, reportCount, 0u);
+            break;
+        }
+    }
+}
+
+void MetricCalculator::calculateValues(const uint8_t *pRawData,
+                                       size_t valueCount,
+                                       zet_typed_value_t *pValues) const {
+    size_t metricCount = getMetricCount();
+    if (metricCount == 0)
+        return;
+
+    size_t reportCount = (valueCount + metricCount - 1) / metricCount;
+    std::vector<uint64_t> columns(std::min(reportCount, blockReports) * metricCount);
+
+    for (size_t first = 0; first < reportCount; first += blockReports) {
+        size_t count = std::min(blockReports, reportCount - first);
+        decodeBlock(pRawData + first * reportSize, count, columns.data());
+
+        // Value slots are zero extended, so a whole zet_value_t is written for every type
+        for (size_t r = 0; r < count; r++) {
+            size_t base = (first + r) * metricCount;
+            size_t metrics = std::min(metricCount, valueCount - base);
+            for (size_t m = 0; m < metrics; m++) {
+                pValues[base + m].type = valueTypes[m];
+                pValues[base + m].value.ui64 = columns[m * count + r];
+            }
+        }
+    }
+}
+
+void MetricCalculator::calculateMaxValues(const uint8_t *pRawData,
+                                          size_t reportCount,
+                                          zet_typed_value_t *pValues) const {
+    size_t metricCount = getMetricCount();
+    std::vector<uint64_t> maxValues(metricCount, 0u);
+    std::vector<uint64_t> columns(std::min(reportCount, blockReports) * metricCount);
+
+    for (size_t first = 0; first < reportCount; first += blockReports) {
+        size_t count = std::min(blockReports, reportCount - first);
+        decodeBlock(pRawData + first * reportSize, count, columns.data());
+
+        for (size_t m = 0; m < metricCount; m++) {
+            const uint64_t *pColumn = columns.data() + m * count;
+            // The first report initializes the maximum, so negative floats are handled
+            uint64_t current = first == 0 ? pColumn[0] : maxValues[m];
+
+            switch (valueTypes[m]) {
+            case ZET_VALUE_TYPE_FLOAT32:
+                maxValues[m] = reduceMax<float>(pColumn, count, current);
+                break;
+            case ZET_VALUE_TYPE_FLOAT64:
+                maxValues[m] = reduceMax<double>(pColumn, count, current);
+                break;
+            default:
+                // Unsigned values compare the same way when zero extended
+                maxValues[m] = reduceMax<uint64_t>(pColumn, count, current);
+                break;
+            }
+        }
+    }
+
+    for (size_t m = 0; m < metricCount; m++) {
+        pValues[m].type = valueTypes[m];
+        pValues[m].value.ui64 = maxValues[m];
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+#include <zet_api.h>
+
+namespace L0 {
+
+/**
+ * Decoder of raw metric reports built once per metric group. Every report holds the values of all
+ * metrics of the group, the value of metric m is stored at m * (reportSize / metricCount) offset.
+ * Reports are decoded in blocks into structure-of-arrays columns of zero extended 64-bit slots, so
+ * every metric is processed by a tight loop over reports without dispatch on its value type.
+ */
+class MetricCalculator {
+  public:
+    MetricCalculator(std::vector<zet_value_type_t> valueTypes, size_t reportSize);
+
+    size_t getMetricCount() const { return valueTypes.size(); }
+    size_t getReportCount(size_t rawDataSize) const;
+    size_t getValueCount(size_t rawDataSize) const {
+        return getReportCount(rawDataSize) * getMetricCount();
+    }
+
+    /* Decode first valueCount values, metrics of the first report are followed by the next one */
+    void calculateValues(const uint8_t *pRawData,
+                         size_t valueCount,
+                         zet_typed_value_t *pValues) const;
+    /* Store maximum of every metric over reportCount reports, zero if there are no reports */
+    void calculateMaxValues(const uint8_t *pRawData,
+                            size_t reportCount,
+                            zet_typed_value_t *pValues) const;
+
+    static constexpr size_t blockReports = 256;
+
+  private:
+    void decodeBlock(const uint8_t *pReports, size_t reportCount, uint64_t *columns) const;
+
+    std::vector<zet_value_type_t> valueTypes;
+    std::vector<size_t> valueSizes;
+    size_t reportSize = 0u;
+    size_t metricStride = 0u;
+};
+
+} // namespace L0
@@ -8,14 +8,17 @@
 #include "metric_streamer.hpp"
 
 #include "context.hpp"
+#include "driver.hpp"
 #include "event.hpp"
 #include "level_zero_driver/include/l0_exception.hpp"
 #include "metric.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/device/vpu_metric_stream_reader.hpp"
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <errno.h>
 #include <uapi/drm/ivpu_accel.h>
 #include <ze_api.h>
@@ -45,15 +48,42 @@ MetricStreamer::MetricStreamer(Context *pContext,
 
     sampleSize = startData.sample_size;
 
+    Driver *pDriver = Driver::getInstance();
+    if (pDriver && pDriver->getEnvVariables().metricStreaming && sampleSize > 0) {
+        // Ring holds four kernel read periods, so the consumer can fall behind the reader thread
+        constexpr size_t STREAM_RING_READ_PERIODS = 4;
+
+        VPU::VPUMetricStreamReader::Config config;
+        config.groupMask = 0x1ULL << metricGroup->getGroupIndex();
+        config.reportSize = sampleSize;
+        config.capacityReports = STREAM_RING_READ_PERIODS * startData.read_period_samples;
+        config.samplingPeriod = std::chrono::nanoseconds(desc->samplingPeriod);
+        config.kernelReadPeriodReports = startData.read_period_samples;
+
+        streamReader = std::make_shared<VPU::VPUMetricStreamReader>(ctx->getDriverApi(), config);
+        streamReader->start();
+    }
+
     if (notifyHandle && desc->notifyEveryNReports) {
         auto notifyEvent = L0::Event::fromHandle(notifyHandle);
 
         notifyEvent->setMetricTrackData(0x1ULL << metricGroup->getGroupIndex(),
-                                        sampleSize * desc->notifyEveryNReports);
+                                        sampleSize * desc->notifyEveryNReports,
+                                        streamReader);
     }
 }
 
 MetricStreamer::~MetricStreamer() {
+    if (streamReader) {
+        streamReader->stop();
+        auto stats = streamReader->getStats();
+        LOG(METRIC,
+            "Metric stream closed, drains: %lu, overflows: %lu, dropped reports: %lu",
+            stats.drainCount,
+            stats.overflowCount,
+            stats.droppedReports);
+    }
+
     drm_ivpu_metric_streamer_stop stopData = {};
     stopData.metric_group_mask = 0x1ULL << metricGroup->getGroupIndex();
     if (ctx->getDriverApi().metricStreamerStop(&stopData) < 0) {
@@ -85,6 +115,38 @@ ze_result_t MetricStreamer::getData(const VPU::VPUDriverApi &drvApi,
 
     return ZE_RESULT_SUCCESS;
 }
+
+ze_result_t MetricStreamer::readStreamData(uint32_t maxReportCount,
+                                           size_t *pRawDataSize,
+                                           uint8_t *pRawData) {
+    auto stats = streamReader->getStats();
+    if (stats.droppedReports > reportedDroppedReports) {
+        LOG_W("Metric stream ring overflowed %lu times, %lu reports dropped since last read",
+              stats.overflowCount,
+              stats.droppedReports - reportedDroppedReports);
+        reportedDroppedReports = stats.droppedReports;
+    }
+
+    size_t availableSize = streamReader->getAvailableSize();
+    if (availableSize == 0 && streamReader->hasFailed())
+        return ZE_RESULT_ERROR_UNKNOWN;
+
+    if (*pRawDataSize == 0) {
+        *pRawDataSize = availableSize;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (pRawData == nullptr) {
+        LOG_W("Input raw data pointer is NULL");
+        *pRawDataSize = std::min(*pRawDataSize, availableSize);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    size_t readSize = std::min(*pRawDataSize, maxReportCount * sampleSize);
+    *pRawDataSize = streamReader->read(pRawData, readSize);
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t
 MetricStreamer::readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData) {
     if (pRawDataSize == nullptr) {
@@ -92,6 +154,9 @@ MetricStreamer::readData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t
         return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
+    if (streamReader)
+        return readStreamData(maxReportCount, pRawDataSize, pRawData);
+
     const VPU::VPUDriverApi &drvApi = ctx->getDriverApi();
     if (*pRawDataSize == 0) {
         size_t dataSize = 0;
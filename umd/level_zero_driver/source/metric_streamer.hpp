@@ -12,12 +12,14 @@
 
 #include "level_zero_driver/include/l0_handler.hpp"
 
+#include <memory>
 #include <ze_api.h>
 #include <zet_api.h>
 
 namespace VPU {
 class VPUDeviceContext;
 class VPUDriverApi;
+class VPUMetricStreamReader;
 } // namespace VPU
 
 struct _zet_metric_streamer_handle_t {};
@@ -48,11 +50,16 @@ struct MetricStreamer : _zet_metric_streamer_handle_t, IContextObject {
                                uint8_t *pRawData);
 
   private:
+    ze_result_t readStreamData(uint32_t maxReportCount, size_t *pRawDataSize, uint8_t *pRawData);
+
     Context *pContext = nullptr;
     MetricGroup *metricGroup = nullptr;
     VPU::VPUDeviceContext *ctx = nullptr;
     uint64_t sampleSize = 0u;
     uint64_t actualBufferSize = 0u;
+    /* Host ring drained by reader thread, set when ZE_INTEL_NPU_METRIC_STREAMING is enabled */
+    std::shared_ptr<VPU::VPUMetricStreamReader> streamReader;
+    uint64_t reportedDroppedReports = 0u;
 };
 
 } // namespace L0
@@ -102,7 +102,8 @@ struct ContextFixture : DeviceFixture {
     }
 
     void TearDown() override {
-        EXPECT_EQ(ctx->getBuffersCount(), 0u);
+        EXPECT_EQ(ctx->getBuffersCount(),
+                  ctx->getCommandBufferCacheCount() + ctx->getFillPatternCacheCount());
         if (context)
             context->destroy();
         DeviceFixture::TearDown();
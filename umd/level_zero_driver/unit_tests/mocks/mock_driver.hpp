@@ -49,6 +49,10 @@ struct Mock<Driver> : public Driver {
     void setAffinityMask(std::string_view value) { envVariables.affinityMask = value; }
     void setPciDeviceOrder(bool value) { envVariables.pciIdDeviceOrder = value; }
     void setSharedForceDeviceAlloc(bool value) { envVariables.sharedForceDeviceAlloc = value; }
+    void setHpiPoolSize(size_t value) { envVariables.hpiPoolSize = value; }
+    void setHpiPoolPrewarm(size_t value) { envVariables.hpiPoolPrewarm = value; }
+    void setDisableElfArena(bool value) { envVariables.disableElfArena = value; }
+    void setGraphBuildThreads(uint32_t value) { envVariables.graphBuildThreads = value; }
     void initializeEnvVariables() { Driver::initializeEnvVariables(); }
     void initializeLogging() { Driver::initializeLogging(); }
 
@@ -378,5 +378,106 @@ TEST_F(CommandListCommitSizeTest, l2lCopyAndL2SCopyCommandsWithEvents) {
     EXPECT_EQ(2u, nnCmdlist->getJob()->getCommandBuffers().size());
 }
 
+TEST_F(CommandListCommitSizeTest, copyRegionIsAppendedAsSingleCommand) {
+    auto getDescriptors = [](const std::shared_ptr<VPU::VPUCommand> &cmd) {
+        auto *desc = reinterpret_cast<const vpu_cmd_copy_descriptor_37xx_t *>(
+            cmd->getDescriptorData());
+        size_t count = cmd->getDescriptorSize() / sizeof(vpu_cmd_copy_descriptor_37xx_t);
+        return std::vector<vpu_cmd_copy_descriptor_37xx_t>(desc, desc + count);
+    };
+    uint64_t srcAddr = ctx->findBufferObject(shareMem2)->getVPUAddr(shareMem2);
+    uint64_t dstAddr = ctx->findBufferObject(shareMem1)->getVPUAddr(shareMem1);
+
+    // Source region starts at 8 + 1 * 32 + 1 * 256 bytes, slice pitch of destination is 0 so its
+    // slices are placed right behind the last row of the region
+    ze_copy_region_t srcRegion = {8, 1, 1, 16, 4, 3};
+    ze_copy_region_t dstRegion = {0, 0, 0, 16, 4, 3};
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              nnCmdlist->appendMemoryCopyRegion(shareMem1,
+                                                &dstRegion,
+                                                16,
+                                                0,
+                                                shareMem2,
+                                                &srcRegion,
+                                                32,
+                                                256,
+                                                nullptr,
+                                                0,
+                                                nullptr));
+    ASSERT_EQ(1u, nnCmdlist->getNumCommands());
+    auto descs = getDescriptors(nnCmdlist->getCommands().back());
+    ASSERT_EQ(12u, descs.size());
+    for (size_t z = 0; z < 3; z++) {
+        for (size_t y = 0; y < 4; y++) {
+            const auto &desc = descs[z * 4 + y];
+            EXPECT_EQ(desc.src_address, srcAddr + 8 + (y + 1) * 32 + (z + 1) * 256);
+            EXPECT_EQ(desc.dst_address, dstAddr + z * 64 + y * 16);
+            EXPECT_EQ(desc.size, 16u);
+        }
+    }
+
+    // Slice pitch has to fit all rows of the region
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE,
+              nnCmdlist->appendMemoryCopyRegion(shareMem1,
+                                                &dstRegion,
+                                                16,
+                                                0,
+                                                shareMem2,
+                                                &srcRegion,
+                                                32,
+                                                64,
+                                                nullptr,
+                                                0,
+                                                nullptr));
+
+    // Row of the region has to fit in the pitch
+    srcRegion.originX = 20;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE,
+              nnCmdlist->appendMemoryCopyRegion(shareMem1,
+                                                &dstRegion,
+                                                16,
+                                                0,
+                                                shareMem2,
+                                                &srcRegion,
+                                                32,
+                                                256,
+                                                nullptr,
+                                                0,
+                                                nullptr));
+
+    // Last slice of the region is outside of the allocation
+    srcRegion.originX = 0;
+    srcRegion.originZ = 2;
+    EXPECT_NE(ZE_RESULT_SUCCESS,
+              nnCmdlist->appendMemoryCopyRegion(shareMem1,
+                                                &dstRegion,
+                                                16,
+                                                0,
+                                                shareMem2,
+                                                &srcRegion,
+                                                32,
+                                                256,
+                                                nullptr,
+                                                0,
+                                                nullptr));
+
+    // Region without rows is not copied
+    srcRegion.originZ = 0;
+    srcRegion.height = dstRegion.height = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS,
+              nnCmdlist->appendMemoryCopyRegion(shareMem1,
+                                                &dstRegion,
+                                                16,
+                                                0,
+                                                shareMem2,
+                                                &srcRegion,
+                                                32,
+                                                256,
+                                                nullptr,
+                                                0,
+                                                nullptr));
+    EXPECT_EQ(1u, nnCmdlist->getNumCommands());
+}
+
 } // namespace ult
 } // namespace L0
@@ -10,6 +10,7 @@
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "gtest/gtest.h"
+#include "level_zero_driver/api/prv/zex_driver.hpp"
 #include "level_zero_driver/source/cmdlist.hpp"
 #include "level_zero_driver/source/cmdqueue.hpp"
 #include "level_zero_driver/source/context.hpp"
@@ -17,6 +18,7 @@
 #include "level_zero_driver/source/event.hpp"
 #include "level_zero_driver/source/eventpool.hpp"
 #include "level_zero_driver/source/ext/graph.hpp"
+#include "level_zero_driver/source/immediate_cmdlist.hpp"
 #include "level_zero_driver/source/metric.hpp"
 #include "level_zero_driver/source/metric_query.hpp"
 #include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
@@ -30,6 +32,7 @@
 #include <array>
 #include <filesystem>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 #include <ze_api.h>
@@ -329,6 +332,69 @@ TEST_F(CommandListApiTest, whenCalledAppendMemoryCopyWithCorrectProgramSequenceS
     EXPECT_TRUE(ctx->freeMemAlloc(srcPtr));
 }
 
+TEST_F(CommandListApiTest, pipelinedImmediateCommandListWaitsOnlyWhenWindowIsFull) {
+    zex_command_queue_pipelined_desc_t pipelinedDesc = {
+        .stype = ZEX_STRUCTURE_TYPE_COMMAND_QUEUE_PIPELINED_DESC,
+        .pNext = nullptr,
+        .maxInFlightJobs = 2};
+    ze_command_queue_desc_t queueDesc = {};
+    queueDesc.pNext = &pipelinedDesc;
+
+    ze_command_list_handle_t hImmediateList = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              L0::ImmediateCommandList::create(context, device, &queueDesc, &hImmediateList));
+    auto immediateList = L0::CommandList::fromHandle(hImmediateList);
+    auto appendCopy = [&]() {
+        return immediateList
+            ->appendMemoryCopy(ptrAlloc2, ptrAlloc, testAllocSize, nullptr, 0, nullptr);
+    };
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, appendCopy());
+    // First job is still running, second one fits into the window
+    osInfc.mockFailNextJobWait();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, appendCopy());
+    // Window is full, append waits for the first job and returns the error of failed wait
+    osInfc.mockFailNextJobWait();
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, appendCopy());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, appendCopy());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immediateList->hostSynchronize(UINT64_MAX));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immediateList->destroy());
+
+    pipelinedDesc.maxInFlightJobs = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT,
+              L0::ImmediateCommandList::create(context, device, &queueDesc, &hImmediateList));
+}
+
+TEST_F(CommandListApiTest, pipelinedImmediateCommandListRecyclesCompletedJobs) {
+    zex_command_queue_pipelined_desc_t pipelinedDesc = {
+        .stype = ZEX_STRUCTURE_TYPE_COMMAND_QUEUE_PIPELINED_DESC,
+        .pNext = nullptr,
+        .maxInFlightJobs = 2};
+    ze_command_queue_desc_t queueDesc = {};
+    queueDesc.pNext = &pipelinedDesc;
+
+    ze_command_list_handle_t hImmediateList = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              L0::ImmediateCommandList::create(context, device, &queueDesc, &hImmediateList));
+    auto immediateList = L0::CommandList::fromHandle(hImmediateList);
+    auto appendCopy = [&]() {
+        return immediateList
+            ->appendMemoryCopy(ptrAlloc2, ptrAlloc, testAllocSize, nullptr, 0, nullptr);
+    };
+
+    // Jobs that completed are reused for the following appends
+    std::set<VPU::VPUJob *> jobs;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(ZE_RESULT_SUCCESS, appendCopy());
+        jobs.insert(immediateList->getJob().get());
+    }
+    EXPECT_EQ(2u, jobs.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immediateList->hostSynchronize(UINT64_MAX));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immediateList->destroy());
+}
+
 TEST_F(CommandListApiTest, eventSyncObjectsAttachedWithMemoryCopyCommand) {
     // Append copy command with sync objects.
     ze_event_handle_t waitOnEvents[] = {event1, event2, event3};
@@ -469,6 +535,43 @@ TEST_F(CommandListGraphApiTest,
     EXPECT_TRUE(ctx->freeMemAlloc(outPtrAlloc));
 }
 
+TEST_F(CommandListGraphApiTest, appendingGraphExecuteReservesInferenceIdsInSingleIoctl) {
+    ze_command_queue_desc_t queueDesc = {};
+    ze_command_list_handle_t hImmediateList = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS,
+              L0::ImmediateCommandList::create(context, device, &queueDesc, &hImmediateList));
+    auto immediateList = L0::CommandList::fromHandle(hImmediateList);
+
+    // The value depends on the buffer size returned by the elf loader
+    const size_t argsAllocSize = 147 * 1024;
+
+    void *inPtrAlloc = ctx->createMemAlloc(argsAllocSize,
+                                           VPU::VPUBufferObject::Type::CachedFw,
+                                           VPU::VPUBufferObject::Location::Shared);
+    void *outPtrAlloc = ctx->createMemAlloc(argsAllocSize,
+                                            VPU::VPUBufferObject::Type::CachedFw,
+                                            VPU::VPUBufferObject::Location::Shared);
+    ASSERT_NE(nullptr, inPtrAlloc);
+    ASSERT_NE(nullptr, outPtrAlloc);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pGraph->setArgumentValue(0, inPtrAlloc));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pGraph->setArgumentValue(1, outPtrAlloc));
+
+    // Mock increments unique_id on every DRM_IVPU_PARAM_UNIQUE_INFERENCE_ID request
+    auto uniqueIdRequests = osInfc.unique_id;
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(ZE_RESULT_SUCCESS,
+                  immediateList->appendGraphExecute(hGraph, nullptr, nullptr, 0u, nullptr));
+    }
+    EXPECT_EQ(1u, osInfc.unique_id - uniqueIdRequests);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immediateList->hostSynchronize(UINT64_MAX));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immediateList->destroy());
+
+    EXPECT_TRUE(ctx->freeMemAlloc(inPtrAlloc));
+    EXPECT_TRUE(ctx->freeMemAlloc(outPtrAlloc));
+}
+
 TEST_F(CommandListGraphApiTest,
        resetCommandListAfterGraphInitThenAppendingGraphExecAndExecuteReturnsSuccess) {
     ze_command_queue_handle_t hCommandQueue = createCommandQueue();
@@ -142,5 +142,27 @@ TEST_F(DriverVersionTest, checkEnvironmentVariableInitialization) {
                            : setenv("ZE_INTEL_NPU_LOGLEVEL", umdLogLevel, 1);
 }
 
+TEST_F(DriverVersionTest, hpiPoolEnvironmentVariablesKeepDefaultOnParseError) {
+    unsetenv("ZE_INTEL_NPU_HPI_POOL_SIZE");
+    unsetenv("ZE_INTEL_NPU_HPI_POOL_PREWARM");
+
+    driver.initializeEnvVariables();
+    EXPECT_EQ(driver.getEnvVariables().hpiPoolSize, Driver::L0EnvVariables::defaultHpiPoolSize);
+    EXPECT_EQ(driver.getEnvVariables().hpiPoolPrewarm, 0u);
+
+    setenv("ZE_INTEL_NPU_HPI_POOL_SIZE", "2", 1);
+    setenv("ZE_INTEL_NPU_HPI_POOL_PREWARM", "4", 1);
+    driver.initializeEnvVariables();
+    EXPECT_EQ(driver.getEnvVariables().hpiPoolSize, 2u);
+    EXPECT_EQ(driver.getEnvVariables().hpiPoolPrewarm, 4u);
+
+    setenv("ZE_INTEL_NPU_HPI_POOL_SIZE", "invalid", 1);
+    driver.initializeEnvVariables();
+    EXPECT_EQ(driver.getEnvVariables().hpiPoolSize, Driver::L0EnvVariables::defaultHpiPoolSize);
+
+    unsetenv("ZE_INTEL_NPU_HPI_POOL_SIZE");
+    unsetenv("ZE_INTEL_NPU_HPI_POOL_PREWARM");
+}
+
 } // namespace ult
 } // namespace L0
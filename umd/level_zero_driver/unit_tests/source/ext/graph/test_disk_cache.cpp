@@ -13,11 +13,20 @@
 #include "level_zero_driver/source/ext/blob_container.hpp"
 #include "level_zero_driver/source/ext/disk_cache.hpp"
 #include "level_zero_driver/source/ext/hash_function.hpp"
+#include "vpu_driver/source/os_interface/os_interface_imp.hpp"
 #include "vpu_driver/unit_tests/mocks/gmock_os_interface_imp.hpp"
 
+#include <chrono>
 #include <cstring>
+#include <fcntl.h>
+#include <filesystem>
 #include <memory>
+#include <stdlib.h>
 #include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
 #include <utility>
 #include <vector>
 #include <ze_graph_ext.h>
@@ -49,6 +58,9 @@ class DiskCacheTest : public ::testing::Test {
     void SetUp() override {
         EXPECT_CALL(osInfc, osiCreateDirectories).WillOnce(::testing::Return(true));
         EXPECT_CALL(osInfc, osiOpenWithSharedLock).WillRepeatedly(nullptr);
+        // Index file is not available, so the cache directory is scanned and the index is stored
+        EXPECT_CALL(osInfc, osiScanDir).Times(1);
+        EXPECT_CALL(osInfc, osiOpenWithExclusiveLock).WillRepeatedly(nullptr);
         cache = std::make_unique<DiskCache>(osInfc);
     }
 
@@ -111,6 +123,7 @@ TEST_F(DiskCacheTest, HitCache) {
 
     EXPECT_CALL(*osFile, size).WillRepeatedly(::testing::Return(fileSize));
     EXPECT_CALL(*osFile, mmap).WillRepeatedly(::testing::Return(mmapPtr.get()));
+    EXPECT_CALL(*osFile, mtime).WillOnce(::testing::Return(0));
 
     EXPECT_CALL(osInfc, osiOpenWithSharedLock).WillOnce(::testing::Return(std::move(osFile)));
 
@@ -131,6 +144,219 @@ TEST_F(DiskCacheTest, GetDigestCheck) {
               std::string("0000000000000000"));
 }
 
+class DiskCacheTmpDirTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        std::string dirTemplate = std::filesystem::temp_directory_path() / "npu_cache_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate.data()), nullptr);
+        cacheDir = dirTemplate;
+        setenv("ZE_INTEL_NPU_CACHE_DIR", cacheDir.c_str(), 1);
+    }
+
+    void TearDown() override {
+        unsetenv("ZE_INTEL_NPU_CACHE_DIR");
+        std::filesystem::remove_all(cacheDir);
+    }
+
+    std::unique_ptr<BlobContainer> makeBlob(size_t size, uint8_t value) {
+        auto buffer = std::make_unique<uint8_t[]>(size);
+        memset(buffer.get(), value, size);
+        return std::make_unique<BlobContainer>(std::move(buffer), size);
+    }
+
+    VPU::OsInterface &osInfc = *VPU::OsInterfaceImp::getInstance();
+    std::filesystem::path cacheDir;
+};
+
+TEST_F(DiskCacheTmpDirTest, IndexKeepsCacheSizeBetweenInstances) {
+    constexpr size_t blobSize = 4096;
+    {
+        DiskCache cache(osInfc);
+        EXPECT_EQ(cache.getCacheSize(), 0u);
+        EXPECT_NE(cache.setBlob("key1", makeBlob(blobSize, 1)), nullptr);
+        EXPECT_NE(cache.setBlob("key2", makeBlob(blobSize, 2)), nullptr);
+        EXPECT_EQ(cache.getCacheSize(), 2 * (blobSize + HashCity::DigestLength));
+    }
+    EXPECT_TRUE(std::filesystem::exists(cacheDir / DiskCache::indexFileName));
+
+    DiskCache cache(osInfc);
+    EXPECT_EQ(cache.getCacheSize(), 2 * (blobSize + HashCity::DigestLength));
+    auto blob = cache.getBlob("key2");
+    ASSERT_NE(blob, nullptr);
+    EXPECT_EQ(blob->size, blobSize);
+    EXPECT_EQ(blob->ptr[0], 2);
+}
+
+TEST_F(DiskCacheTmpDirTest, ChecksumIsValidatedOnlyIfFileChanged) {
+    constexpr size_t blobSize = 4096;
+    DiskCache cache(osInfc);
+    ASSERT_NE(cache.setBlob("key", makeBlob(blobSize, 1)), nullptr);
+
+    // Corrupt the blob, but keep the size and the modification time
+    auto path = cacheDir / "key";
+    struct stat st = {};
+    ASSERT_EQ(stat(path.c_str(), &st), 0);
+    std::filesystem::permissions(path,
+                                 std::filesystem::perms::owner_write,
+                                 std::filesystem::perm_options::add);
+    FILE *file = fopen(path.c_str(), "r+");
+    ASSERT_NE(file, nullptr);
+    EXPECT_EQ(fputc(0xff, file), 0xff);
+    fclose(file);
+
+    struct timespec times[2] = {st.st_atim, st.st_mtim};
+    ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+    EXPECT_NE(cache.getBlob("key"), nullptr);
+
+    // Modification time changed, the checksum is validated and the blob is removed
+    times[1].tv_sec++;
+    ASSERT_EQ(utimensat(AT_FDCWD, path.c_str(), times, 0), 0);
+    EXPECT_EQ(cache.getBlob("key"), nullptr);
+    EXPECT_FALSE(std::filesystem::exists(path));
+    EXPECT_EQ(cache.getCacheSize(), 0u);
+}
+
+TEST_F(DiskCacheTmpDirTest, LeastRecentlyUsedBlobIsRemoved) {
+    constexpr size_t blobSize = 4096;
+    constexpr size_t cachedBlobSize = blobSize + HashCity::DigestLength;
+    DiskCache cache(osInfc);
+    cache.setMaxSize(2 * cachedBlobSize);
+
+    EXPECT_NE(cache.setBlob("key1", makeBlob(blobSize, 1)), nullptr);
+    EXPECT_NE(cache.setBlob("key2", makeBlob(blobSize, 2)), nullptr);
+    EXPECT_NE(cache.getBlob("key1"), nullptr);
+    EXPECT_NE(cache.setBlob("key3", makeBlob(blobSize, 3)), nullptr);
+
+    EXPECT_EQ(cache.getCacheSize(), 2 * cachedBlobSize);
+    EXPECT_TRUE(std::filesystem::exists(cacheDir / "key1"));
+    EXPECT_FALSE(std::filesystem::exists(cacheDir / "key2"));
+    EXPECT_TRUE(std::filesystem::exists(cacheDir / "key3"));
+}
+
+TEST_F(DiskCacheTmpDirTest, IndexKeepsEntriesStoredByOtherProcess) {
+    constexpr size_t blobSize = 4096;
+    DiskCache cache(osInfc);
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        DiskCache otherCache(osInfc);
+        bool stored = otherCache.setBlob("key2", makeBlob(blobSize, 2)) != nullptr;
+        _exit(stored ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), EXIT_SUCCESS);
+
+    // Index stored by this process is merged with the entry of the other process
+    ASSERT_NE(cache.setBlob("key1", makeBlob(blobSize, 1)), nullptr);
+    EXPECT_EQ(cache.getCacheSize(), 2 * (blobSize + HashCity::DigestLength));
+
+    DiskCache reloadedCache(osInfc);
+    EXPECT_EQ(reloadedCache.getCacheSize(), 2 * (blobSize + HashCity::DigestLength));
+}
+
+TEST_F(DiskCacheTmpDirTest, BlobsStoredByOtherProcessCountIntoMaxSize) {
+    constexpr size_t blobSize = 4096;
+    constexpr size_t cachedBlobSize = blobSize + HashCity::DigestLength;
+    DiskCache cache(osInfc);
+    cache.setMaxSize(2 * cachedBlobSize);
+    ASSERT_NE(cache.setBlob("key1", makeBlob(blobSize, 1)), nullptr);
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        DiskCache otherCache(osInfc);
+        bool stored = otherCache.setBlob("key2", makeBlob(blobSize, 2)) != nullptr;
+        _exit(stored ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), EXIT_SUCCESS);
+
+    // Changed index is read before storing, so the least recently used blob is removed
+    ASSERT_NE(cache.setBlob("key3", makeBlob(blobSize, 3)), nullptr);
+    EXPECT_EQ(cache.getCacheSize(), 2 * cachedBlobSize);
+    EXPECT_FALSE(std::filesystem::exists(cacheDir / "key1"));
+    EXPECT_TRUE(std::filesystem::exists(cacheDir / "key2"));
+    EXPECT_TRUE(std::filesystem::exists(cacheDir / "key3"));
+}
+
+TEST_F(DiskCacheTmpDirTest, ConcurrentProcessesCompileBlobOnce) {
+    constexpr size_t blobSize = 4096;
+    constexpr int processCount = 4;
+    int compiledPipe[2];
+    ASSERT_EQ(pipe(compiledPipe), 0);
+
+    std::vector<pid_t> children;
+    for (int i = 0; i < processCount; i++) {
+        pid_t pid = fork();
+        ASSERT_NE(pid, -1);
+        if (pid == 0) {
+            DiskCache cache(osInfc);
+            std::unique_ptr<DiskCache::EntryLock> entryLock;
+            auto blob = cache.getBlobOrLock("key", entryLock);
+            if (blob == nullptr) {
+                // Stub compiler, every compilation is reported to the parent process
+                if (write(compiledPipe[1], "c", 1) != 1)
+                    _exit(EXIT_FAILURE);
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                blob = cache.setBlob("key", makeBlob(blobSize, 1));
+                entryLock.reset();
+            }
+            bool valid = blob != nullptr && blob->size == blobSize && blob->ptr[0] == 1;
+            _exit(valid ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        children.push_back(pid);
+    }
+    close(compiledPipe[1]);
+
+    for (auto pid : children) {
+        int status = 0;
+        ASSERT_EQ(waitpid(pid, &status, 0), pid);
+        EXPECT_TRUE(WIFEXITED(status));
+        EXPECT_EQ(WEXITSTATUS(status), EXIT_SUCCESS);
+    }
+
+    char buffer[processCount] = {};
+    EXPECT_EQ(read(compiledPipe[0], buffer, sizeof(buffer)), 1);
+    close(compiledPipe[0]);
+
+    auto lockPath = cacheDir / (std::string("key") + DiskCache::lockFileSuffix);
+    EXPECT_FALSE(std::filesystem::exists(lockPath));
+}
+
+TEST_F(DiskCacheTmpDirTest, AbandonedLockFileIsTakenOver) {
+    auto lockPath = cacheDir / (std::string("key") + DiskCache::lockFileSuffix);
+    ASSERT_NE(osInfc.osiOpenWithExclusiveLock(lockPath, true), nullptr);
+    ASSERT_TRUE(std::filesystem::exists(lockPath));
+
+    DiskCache cache(osInfc);
+    std::unique_ptr<DiskCache::EntryLock> entryLock;
+    EXPECT_EQ(cache.getBlobOrLock("key", entryLock), nullptr);
+    EXPECT_NE(entryLock, nullptr);
+    EXPECT_TRUE(std::filesystem::exists(lockPath));
+
+    entryLock.reset();
+    EXPECT_FALSE(std::filesystem::exists(lockPath));
+}
+
+TEST_F(DiskCacheTmpDirTest, WaitForLockedEntryTimesOut) {
+    auto lockPath = cacheDir / (std::string("key") + DiskCache::lockFileSuffix);
+    auto lockFile = osInfc.osiOpenWithExclusiveLock(lockPath, true);
+    ASSERT_NE(lockFile, nullptr);
+
+    DiskCache cache(osInfc);
+    cache.setLockTimeout(std::chrono::milliseconds(100));
+    std::unique_ptr<DiskCache::EntryLock> entryLock;
+    EXPECT_EQ(cache.getBlobOrLock("key", entryLock), nullptr);
+    EXPECT_EQ(entryLock, nullptr);
+    EXPECT_TRUE(std::filesystem::exists(lockPath));
+    EXPECT_EQ(cache.getCacheSize(), 0u);
+}
+
 class HashCityTest : public testing::TestWithParam<std::pair<const char *, const char *>> {};
 
 INSTANTIATE_TEST_SUITE_P(
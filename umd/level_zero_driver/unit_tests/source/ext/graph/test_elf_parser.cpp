@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/ext/blob_container.hpp"
+#include "level_zero_driver/source/ext/elf_parser.hpp"
+#include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "level_zero_driver/unit_tests/options.hpp"
+#include "level_zero_driver/unit_tests/utils.hpp"
+#include "vpu_driver/source/command/command_buffer.hpp"
+#include "vpu_driver/source/command/inference_execute.hpp"
+#include "vpu_driver/source/command/job.hpp"
+#include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/unit_tests/test_macros/test.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ze_api.h>
+
+namespace L0 {
+namespace ult {
+
+struct ElfParserFixture : ContextFixture {
+    void SetUp() override {
+        ContextFixture::SetUp();
+
+        ASSERT_FALSE(TestOptions::blobPath.empty()) << "Blob path has not been provided";
+
+        loadBlobFromFile(TestOptions::blobPath, blob);
+        ASSERT_NE(0u, blob.size());
+        blobContainer = std::make_unique<BlobContainer>(blob.data(), blob.size());
+    }
+
+    void TearDown() override {
+        parser.reset();
+        ContextFixture::TearDown();
+    }
+
+    void createParser() {
+        std::string logBuffer;
+        parser = ElfParser::getElfParser(ctx, blobContainer, logBuffer);
+        ASSERT_NE(parser, nullptr) << logBuffer;
+        ASSERT_EQ(parser->initialize(), ZE_RESULT_SUCCESS);
+    }
+
+    std::vector<uint8_t> blob;
+    std::unique_ptr<BlobContainer> blobContainer;
+    std::unique_ptr<ElfParser> parser;
+};
+
+using HostParsedInferencePoolTest = Test<ElfParserFixture>;
+
+TEST_F(HostParsedInferencePoolTest, unusedHeadIsReusedAndCountedAsHit) {
+    createParser();
+    auto &manager = parser->getHpiManager();
+    auto initStats = manager.getStatistics();
+
+    size_t buffersCount = ctx->getBuffersCount();
+    auto hpi = manager.acquire();
+    ASSERT_NE(hpi, nullptr);
+    EXPECT_EQ(hpi, manager.head());
+    hpi.reset();
+    EXPECT_EQ(manager.acquire(), manager.head());
+
+    auto stats = manager.getStatistics();
+    EXPECT_EQ(stats.hits, initStats.hits + 2);
+    EXPECT_EQ(stats.copies, initStats.copies);
+    EXPECT_EQ(manager.getPoolSize(), 0u);
+    EXPECT_EQ(ctx->getBuffersCount(), buffersCount);
+}
+
+TEST_F(HostParsedInferencePoolTest, busyHeadIsCopiedOnceAndPooledCopyIsReused) {
+    createParser();
+    auto &manager = parser->getHpiManager();
+
+    size_t buffersCount = ctx->getBuffersCount();
+    auto head = manager.acquire();
+    auto copy = manager.acquire();
+    ASSERT_NE(copy, nullptr);
+    EXPECT_NE(copy, head);
+    EXPECT_EQ(manager.getPoolSize(), 1u);
+    EXPECT_GT(ctx->getBuffersCount(), buffersCount);
+
+    auto *copyPtr = copy.get();
+    copy.reset();
+    size_t pooledBuffersCount = ctx->getBuffersCount();
+    copy = manager.acquire();
+    EXPECT_EQ(copy.get(), copyPtr);
+    EXPECT_EQ(ctx->getBuffersCount(), pooledBuffersCount);
+
+    auto stats = manager.getStatistics();
+    EXPECT_EQ(stats.copies, 1u);
+    EXPECT_EQ(stats.unpooledCopies, 0u);
+    EXPECT_EQ(manager.getPoolSize(), 1u);
+}
+
+TEST_F(HostParsedInferencePoolTest, copiesAboveHighWaterMarkAreNotPooledAndTrimReleasesPool) {
+    driver.setHpiPoolSize(1);
+    createParser();
+    auto &manager = parser->getHpiManager();
+
+    auto head = manager.acquire();
+    auto pooled = manager.acquire();
+    auto unpooled = manager.acquire();
+    ASSERT_NE(unpooled, nullptr);
+    EXPECT_NE(unpooled, pooled);
+    EXPECT_EQ(manager.getPoolSize(), 1u);
+    EXPECT_EQ(manager.getStatistics().unpooledCopies, 1u);
+
+    unpooled.reset();
+    manager.trim();
+    EXPECT_EQ(manager.getPoolSize(), 1u);
+    EXPECT_EQ(manager.getStatistics().trimmed, 0u);
+
+    pooled.reset();
+    manager.trim();
+    EXPECT_EQ(manager.getPoolSize(), 0u);
+    EXPECT_EQ(manager.getStatistics().trimmed, 1u);
+}
+
+TEST_F(HostParsedInferencePoolTest, prewarmCopiesUpToHighWaterMark) {
+    driver.setHpiPoolSize(2);
+    driver.setHpiPoolPrewarm(8);
+    createParser();
+    auto &manager = parser->getHpiManager();
+
+    EXPECT_EQ(manager.getPoolSize(), 2u);
+    EXPECT_EQ(manager.getStatistics().copies, 2u);
+
+    auto head = manager.acquire();
+    auto first = manager.acquire();
+    auto second = manager.acquire();
+    EXPECT_EQ(manager.getStatistics().copies, 2u);
+    EXPECT_EQ(manager.getStatistics().hits, 4u);
+}
+
+using ElfArenaTest = Test<ElfParserFixture>;
+
+TEST_F(ElfArenaTest, graphInitializationCreatesFewerBuffersWithArena) {
+    uint32_t boCreateCount = osInfc.callCntBoCreate;
+    createParser();
+    uint32_t arenaBoCreateCount = osInfc.callCntBoCreate - boCreateCount;
+    parser.reset();
+
+    driver.setDisableElfArena(true);
+    boCreateCount = osInfc.callCntBoCreate;
+    createParser();
+    uint32_t sectionBoCreateCount = osInfc.callCntBoCreate - boCreateCount;
+
+    EXPECT_GT(arenaBoCreateCount, 0u);
+    EXPECT_LT(arenaBoCreateCount, sectionBoCreateCount);
+}
+
+TEST_F(ElfArenaTest, hpiCopyReusesArenaLayout) {
+    constexpr auto location = VPU::VPUBufferObject::Location::Internal;
+    createParser();
+    auto &manager = parser->getHpiManager();
+    auto head = manager.acquire();
+
+    // Copy includes loader runtime allocations that are not in section table, they do not open
+    // next arena, so every copy gets the same buffers
+    uint32_t boCreateCount = osInfc.callCntBoCreate;
+    int64_t allocatedMemory = VPU::VPUBufferObject::getAllocatedMemory(location);
+    auto copy = manager.acquire();
+    uint32_t arenaBoCreateCount = osInfc.callCntBoCreate - boCreateCount;
+    int64_t arenaMemory = VPU::VPUBufferObject::getAllocatedMemory(location) - allocatedMemory;
+
+    boCreateCount = osInfc.callCntBoCreate;
+    allocatedMemory = VPU::VPUBufferObject::getAllocatedMemory(location);
+    auto secondCopy = manager.acquire();
+    EXPECT_EQ(osInfc.callCntBoCreate - boCreateCount, arenaBoCreateCount);
+    EXPECT_EQ(VPU::VPUBufferObject::getAllocatedMemory(location) - allocatedMemory, arenaMemory);
+    secondCopy.reset();
+    copy.reset();
+    head.reset();
+    parser.reset();
+
+    driver.setDisableElfArena(true);
+    createParser();
+    auto &sectionManager = parser->getHpiManager();
+    head = sectionManager.acquire();
+
+    boCreateCount = osInfc.callCntBoCreate;
+    allocatedMemory = VPU::VPUBufferObject::getAllocatedMemory(location);
+    copy = sectionManager.acquire();
+    uint32_t sectionBoCreateCount = osInfc.callCntBoCreate - boCreateCount;
+    int64_t sectionMemory = VPU::VPUBufferObject::getAllocatedMemory(location) - allocatedMemory;
+
+    EXPECT_LT(arenaBoCreateCount, sectionBoCreateCount);
+    EXPECT_LE(arenaMemory, sectionMemory);
+}
+
+using InferenceExecuteUpdateTest = Test<ElfParserFixture>;
+
+TEST_F(InferenceExecuteUpdateTest, updateReplacesBufferHandlesOfChangedArgumentsOnly) {
+    createParser();
+    std::shared_ptr<ElfParser> sharedParser = std::move(parser);
+
+    // The value depends on the buffer size returned by the elf loader
+    const size_t argsAllocSize = 147 * 1024;
+    std::vector<void *> allocs;
+    for (size_t i = 0; i < 3; i++) {
+        allocs.push_back(ctx->createMemAlloc(argsAllocSize,
+                                             VPU::VPUBufferObject::Type::CachedFw,
+                                             VPU::VPUBufferObject::Location::Shared));
+        ASSERT_NE(nullptr, allocs.back());
+    }
+
+    auto cmd =
+        sharedParser->createInferenceExecuteCommand({allocs[0]}, {allocs[1]}, {}, {}, nullptr);
+    ASSERT_NE(nullptr, cmd);
+    auto job = std::make_unique<VPU::VPUJob>(ctx);
+    ASSERT_TRUE(job->appendCommand(cmd));
+    ASSERT_TRUE(job->closeCommands());
+    auto &cmdBuffer = job->getCommandBuffers().front();
+    const auto &handles = cmdBuffer->getBufferHandles();
+    auto handleCount = [&](const void *ptr) {
+        return std::count(handles.begin(), handles.end(), ctx->findBufferObject(ptr)->getHandle());
+    };
+    size_t associatedCount = cmd->getAssociateBufferObjects().size();
+    EXPECT_EQ(1, handleCount(allocs[0]));
+    EXPECT_EQ(1, handleCount(allocs[1]));
+    EXPECT_EQ(0, handleCount(allocs[2]));
+
+    // Input is swapped, output is set to its current pointer and keeps its buffer object
+    VPU::VPUCommand::ArgumentUpdatesMap updates;
+    updates[0].ptr = allocs[2];
+    updates[1].ptr = allocs[1];
+    EXPECT_TRUE(cmd->setUpdates(updates));
+    EXPECT_TRUE(cmdBuffer->updateCommands());
+    EXPECT_EQ(0, handleCount(allocs[0]));
+    EXPECT_EQ(1, handleCount(allocs[1]));
+    EXPECT_EQ(1, handleCount(allocs[2]));
+    EXPECT_EQ(associatedCount, cmd->getAssociateBufferObjects().size());
+
+    // Buffer object used by both arguments is associated once
+    updates.clear();
+    updates[0].ptr = allocs[1];
+    EXPECT_TRUE(cmd->setUpdates(updates));
+    EXPECT_TRUE(cmdBuffer->updateCommands());
+    EXPECT_EQ(1, handleCount(allocs[1]));
+    EXPECT_EQ(0, handleCount(allocs[2]));
+    EXPECT_EQ(associatedCount - 1, cmd->getAssociateBufferObjects().size());
+
+    // Shared buffer object stays associated while the output still uses it
+    updates[0].ptr = allocs[0];
+    EXPECT_TRUE(cmd->setUpdates(updates));
+    EXPECT_TRUE(cmdBuffer->updateCommands());
+    EXPECT_EQ(1, handleCount(allocs[0]));
+    EXPECT_EQ(1, handleCount(allocs[1]));
+    EXPECT_EQ(associatedCount, cmd->getAssociateBufferObjects().size());
+
+    job.reset();
+    cmd.reset();
+    for (auto *alloc : allocs)
+        EXPECT_TRUE(ctx->freeMemAlloc(alloc));
+}
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/ext/graph_build_queue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace L0 {
+namespace ult {
+
+using namespace std::chrono_literals;
+
+TEST(GraphBuildQueue, destructorCompletesSubmittedBuilds) {
+    std::atomic<uint32_t> builds = 0;
+    {
+        GraphBuildQueue queue(1);
+        for (int i = 0; i < 10; i++)
+            queue.submit([] { return ""; }, [&builds] { builds++; });
+    }
+    EXPECT_EQ(builds, 10u);
+}
+
+TEST(GraphBuildQueue, buildsWithDifferentKeysRunConcurrently) {
+    GraphBuildQueue queue(2);
+    std::promise<void> firstStarted;
+    std::promise<void> secondStarted;
+    auto second = secondStarted.get_future().share();
+
+    queue.submit([] { return "first"; },
+                 [&firstStarted, second] {
+                     firstStarted.set_value();
+                     second.wait();
+                 });
+    queue.submit([] { return "second"; }, [&secondStarted] { secondStarted.set_value(); });
+
+    EXPECT_EQ(firstStarted.get_future().wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(second.wait_for(10s), std::future_status::ready);
+}
+
+TEST(GraphBuildQueue, identicalBuildWaitsWithoutOccupyingWorker) {
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> otherDone;
+    std::atomic<uint32_t> builds = 0;
+    std::atomic<bool> followerRanEarly = false;
+
+    {
+        GraphBuildQueue queue(2);
+        std::promise<void> leaderStarted;
+        queue.submit([] { return "model"; },
+                     [&] {
+                         leaderStarted.set_value();
+                         released.wait();
+                         builds++;
+                     });
+        ASSERT_EQ(leaderStarted.get_future().wait_for(10s), std::future_status::ready);
+
+        for (int i = 0; i < 3; i++) {
+            queue.submit([] { return "model"; },
+                         [&] {
+                             if (builds == 0)
+                                 followerRanEarly = true;
+                             builds++;
+                         });
+        }
+
+        // Parked builds do not block the second worker
+        queue.submit([] { return "other"; }, [&otherDone] { otherDone.set_value(); });
+        EXPECT_EQ(otherDone.get_future().wait_for(10s), std::future_status::ready);
+        EXPECT_EQ(queue.getDeduplicatedCount(), 3u);
+
+        release.set_value();
+    }
+
+    EXPECT_EQ(builds, 4u);
+    EXPECT_FALSE(followerRanEarly);
+}
+
+} // namespace ult
+} // namespace L0
@@ -12,12 +12,14 @@
 #include "level_zero_driver/source/device.hpp"
 #include "level_zero_driver/source/driver_handle.hpp"
 #include "level_zero_driver/source/metric.hpp"
+#include "level_zero_driver/source/metric_calculator.hpp"
 #include "level_zero_driver/source/metric_query.hpp"
 #include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
 #include "level_zero_driver/unit_tests/mocks/mock_metrics.hpp"
 #include "umd_common.hpp"
 #include "vpu_driver/unit_tests/test_macros/test.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string.h>
 #include <string>
@@ -721,6 +723,114 @@ TEST_F(MetricGroupCalculateTest, calculateMetricValuesReturnsExpectedResults) {
     }
 }
 
+TEST_F(MetricGroupCalculateTest, calculateMaxMetricValuesReturnsMaximumOfEveryMetric) {
+    auto metricGroup = L0::MetricGroup::fromHandle(metricGroups[0]);
+    uint32_t metricCount = 0;
+    ASSERT_EQ(metricGroup->getMetric(&metricCount, nullptr), ZE_RESULT_SUCCESS);
+
+    // Two reports where the second one holds the maximum of the first metric
+    std::vector<uint8_t> reports(2 * metricGroup->getAllocationSize());
+    memcpy(reports.data(), rawData.data(), metricGroup->getAllocationSize());
+    memcpy(reports.data() + metricGroup->getAllocationSize(),
+           rawData.data(),
+           metricGroup->getAllocationSize());
+    uint64_t firstValue = 0;
+    memcpy(&firstValue, reports.data(), sizeof(firstValue));
+    firstValue++;
+    memcpy(reports.data() + metricGroup->getAllocationSize(), &firstValue, sizeof(firstValue));
+
+    uint32_t valueCount = 0;
+    std::vector<zet_typed_value_t> values(2 * metricCount);
+    EXPECT_EQ(metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                 reports.size(),
+                                                 reports.data(),
+                                                 &valueCount,
+                                                 nullptr),
+              ZE_RESULT_SUCCESS);
+    ASSERT_EQ(valueCount, 2 * metricCount);
+    EXPECT_EQ(metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                 reports.size(),
+                                                 reports.data(),
+                                                 &valueCount,
+                                                 values.data()),
+              ZE_RESULT_SUCCESS);
+
+    std::vector<zet_typed_value_t> maxValues(metricCount);
+    valueCount = metricCount;
+    EXPECT_EQ(
+        metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES,
+                                           reports.size(),
+                                           reports.data(),
+                                           &valueCount,
+                                           maxValues.data()),
+        ZE_RESULT_SUCCESS);
+
+    for (uint32_t i = 0; i < metricCount; i++) {
+        EXPECT_EQ(maxValues[i].type, ZET_VALUE_TYPE_UINT64);
+        EXPECT_EQ(maxValues[i].value.ui64,
+                  std::max(values[i].value.ui64, values[metricCount + i].value.ui64));
+    }
+    EXPECT_EQ(maxValues[0].value.ui64, firstValue);
+}
+
+TEST(MetricCalculator, decodesMixedValueTypesInBlocks) {
+    // Every metric occupies 8 bytes of the report, smaller values use the lowest bytes
+    MetricCalculator calculator({ZET_VALUE_TYPE_UINT32,
+                                 ZET_VALUE_TYPE_FLOAT32,
+                                 ZET_VALUE_TYPE_FLOAT64,
+                                 ZET_VALUE_TYPE_BOOL8},
+                                32);
+    const size_t reportCount = MetricCalculator::blockReports + 3;
+
+    std::vector<uint8_t> rawData(reportCount * 32 + 16);
+    for (size_t r = 0; r < reportCount; r++) {
+        uint8_t *report = rawData.data() + r * 32;
+        uint32_t ui32 = static_cast<uint32_t>(r * 3);
+        float fp32 = -static_cast<float>(r) - 0.5f;
+        double fp64 = static_cast<double>(r) / 4;
+        uint8_t b8 = r % 2;
+        memcpy(report, &ui32, sizeof(ui32));
+        memcpy(report + 8, &fp32, sizeof(fp32));
+        memcpy(report + 16, &fp64, sizeof(fp64));
+        memcpy(report + 24, &b8, sizeof(b8));
+    }
+
+    // Incomplete report at the end of raw data is ignored
+    ASSERT_EQ(calculator.getValueCount(rawData.size()), reportCount * 4);
+
+    // Last report is requested partially
+    std::vector<zet_typed_value_t> values(reportCount * 4 - 2);
+    calculator.calculateValues(rawData.data(), values.size(), values.data());
+    for (size_t i = 0; i < values.size(); i++) {
+        size_t r = i / 4;
+        switch (i % 4) {
+        case 0:
+            ASSERT_EQ(values[i].type, ZET_VALUE_TYPE_UINT32);
+            ASSERT_EQ(values[i].value.ui32, r * 3);
+            break;
+        case 1:
+            ASSERT_EQ(values[i].type, ZET_VALUE_TYPE_FLOAT32);
+            ASSERT_EQ(values[i].value.fp32, -static_cast<float>(r) - 0.5f);
+            break;
+        case 2:
+            ASSERT_EQ(values[i].type, ZET_VALUE_TYPE_FLOAT64);
+            ASSERT_EQ(values[i].value.fp64, static_cast<double>(r) / 4);
+            break;
+        case 3:
+            ASSERT_EQ(values[i].type, ZET_VALUE_TYPE_BOOL8);
+            ASSERT_EQ(values[i].value.b8, r % 2);
+            break;
+        }
+    }
+
+    std::vector<zet_typed_value_t> maxValues(4);
+    calculator.calculateMaxValues(rawData.data(), reportCount, maxValues.data());
+    EXPECT_EQ(maxValues[0].value.ui32, (reportCount - 1) * 3);
+    EXPECT_EQ(maxValues[1].value.fp32, -0.5f);
+    EXPECT_EQ(maxValues[2].value.fp64, static_cast<double>(reportCount - 1) / 4);
+    EXPECT_EQ(maxValues[3].value.b8, 1);
+}
+
 struct MultiDeviceMetricTest : public Test<MultiDeviceFixture> {
     ze_context_handle_t hContext = nullptr;
 };
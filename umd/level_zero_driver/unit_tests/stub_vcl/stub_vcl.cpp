@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Minimal libnpu_driver_compiler.so replacement. Compilation returns the model IR as the blob, but
+// creating a compiler handle costs STUB_VCL_CREATE_COST_US microseconds to mimic the device and
+// plugin setup done by the real compiler.
+
+#include "stub_vcl.hpp"
+
+#include "npu_driver_compiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct StubCompiler {
+    vcl_device_desc_t device;
+    std::string log;
+};
+
+struct StubProfiling {
+    std::vector<uint8_t> data;
+};
+
+std::atomic<uint64_t> createCount = 0;
+std::atomic<uint64_t> decodeCount = 0;
+std::atomic<uint64_t> compileCount = 0;
+
+std::mutex compileMutex;
+std::condition_variable compileCv;
+bool compileBlocked = false;
+
+std::mutex logMutex;
+std::string logMessage;
+bool logClearedOnRead = true;
+
+std::chrono::microseconds createCost() {
+    static std::chrono::microseconds cost = [] {
+        const char *env = getenv("STUB_VCL_CREATE_COST_US");
+        return std::chrono::microseconds(env ? strtoul(env, nullptr, 10) : 2000);
+    }();
+    return cost;
+}
+
+} // namespace
+
+extern "C" {
+
+uint64_t stubVclCompilerCreateCount() {
+    return createCount.load();
+}
+
+uint64_t stubVclCompileCount() {
+    return compileCount.load();
+}
+
+void stubVclBlockCompilation(bool block) {
+    {
+        std::lock_guard<std::mutex> lock(compileMutex);
+        compileBlocked = block;
+    }
+    compileCv.notify_all();
+}
+
+void stubVclSetCompilerLog(const char *message, bool clearedOnRead) {
+    std::lock_guard<std::mutex> lock(logMutex);
+    logMessage = message;
+    logClearedOnRead = clearedOnRead;
+}
+
+uint64_t stubVclProfilingDecodeCount() {
+    return decodeCount.load();
+}
+
+vcl_result_t vclGetVersion(vcl_version_info_t *compilerVersion,
+                           vcl_version_info_t *profilingVersion) {
+    if (compilerVersion == nullptr || profilingVersion == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    *compilerVersion = {VCL_COMPILER_VERSION_MAJOR, VCL_COMPILER_VERSION_MINOR};
+    *profilingVersion = {VCL_PROFILING_VERSION_MAJOR, VCL_PROFILING_VERSION_MINOR};
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclCompilerCreate(vcl_compiler_desc_t *compilerDesc,
+                               vcl_device_desc_t *deviceDesc,
+                               vcl_compiler_handle_t *compiler,
+                               vcl_log_handle_t *logHandle) {
+    if (deviceDesc == nullptr || compiler == nullptr || logHandle == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    std::this_thread::sleep_for(createCost());
+    createCount++;
+
+    auto *stub = new StubCompiler{*deviceDesc};
+    *compiler = reinterpret_cast<vcl_compiler_handle_t>(stub);
+    *logHandle = reinterpret_cast<vcl_log_handle_t>(stub);
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclCompilerDestroy(vcl_compiler_handle_t compiler) {
+    delete reinterpret_cast<StubCompiler *>(compiler);
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclCompilerGetProperties(vcl_compiler_handle_t compiler,
+                                      vcl_compiler_properties_t *properties) {
+    if (compiler == nullptr || properties == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    properties->id = "stub_vcl";
+    properties->version = {VCL_COMPILER_VERSION_MAJOR, VCL_COMPILER_VERSION_MINOR};
+    properties->supportedOpsets = 0;
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclAllocatedExecutableCreate2(vcl_compiler_handle_t compiler,
+                                           vcl_executable_desc_t desc,
+                                           vcl_allocator2_t *allocator,
+                                           uint8_t **blobBuffer,
+                                           uint64_t *blobSize) {
+    if (compiler == nullptr || allocator == nullptr || blobBuffer == nullptr ||
+        blobSize == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    compileCount++;
+    {
+        std::unique_lock<std::mutex> lock(compileMutex);
+        compileCv.wait(lock, [] { return !compileBlocked; });
+    }
+
+    *blobSize = desc.modelIRSize;
+    *blobBuffer = allocator->allocate(allocator, *blobSize);
+    if (*blobBuffer == nullptr)
+        return VCL_RESULT_ERROR_OUT_OF_MEMORY;
+
+    if (desc.modelIRSize > 0)
+        memcpy(*blobBuffer, desc.modelIRData, desc.modelIRSize);
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    reinterpret_cast<StubCompiler *>(compiler)->log += logMessage;
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclProfilingCreate(p_vcl_profiling_input_t profilingInput,
+                                vcl_profiling_handle_t *profilingHandle,
+                                vcl_log_handle_t *logHandle) {
+    if (profilingInput == nullptr || profilingHandle == nullptr || logHandle == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    auto *stub = new StubProfiling;
+    stub->data.assign(profilingInput->profData,
+                      profilingInput->profData + profilingInput->profSize);
+    *profilingHandle = reinterpret_cast<vcl_profiling_handle_t>(stub);
+    *logHandle = nullptr;
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclGetDecodedProfilingBuffer(vcl_profiling_handle_t profilingHandle,
+                                          vcl_profiling_request_type_t requestType,
+                                          p_vcl_profiling_output_t profilingOutput) {
+    if (profilingHandle == nullptr || profilingOutput == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    decodeCount++;
+    auto *stub = reinterpret_cast<StubProfiling *>(profilingHandle);
+    profilingOutput->data = stub->data.data();
+    profilingOutput->size = stub->data.size();
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclProfilingDestroy(vcl_profiling_handle_t profilingHandle) {
+    delete reinterpret_cast<StubProfiling *>(profilingHandle);
+    return VCL_RESULT_SUCCESS;
+}
+
+vcl_result_t vclLogHandleGetString(vcl_log_handle_t logHandle, size_t *logSize, char *log) {
+    if (logHandle == nullptr || logSize == nullptr)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    std::lock_guard<std::mutex> lock(logMutex);
+    auto &compilerLog = reinterpret_cast<StubCompiler *>(logHandle)->log;
+    if (log == nullptr) {
+        *logSize = compilerLog.empty() ? 0 : compilerLog.size() + 1;
+        return VCL_RESULT_SUCCESS;
+    }
+
+    if (*logSize == 0)
+        return VCL_RESULT_ERROR_INVALID_ARGUMENT;
+
+    size_t size = std::min(*logSize - 1, compilerLog.size());
+    memcpy(log, compilerLog.data(), size);
+    log[size] = '\0';
+    if (logClearedOnRead)
+        compilerLog.clear();
+    return VCL_RESULT_SUCCESS;
+}
+
+} // extern "C"
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Test controls exported by the stub compiler library
+extern "C" {
+
+uint64_t stubVclCompilerCreateCount();
+
+// Number of started compilations, a blocked compilation waits until it is unblocked
+uint64_t stubVclCompileCount();
+void stubVclBlockCompilation(bool block);
+
+// Every compilation appends message to the log of the compiler handle
+void stubVclSetCompilerLog(const char *message, bool clearedOnRead);
+
+// Decoded profiling buffer is a copy of the raw profiling data
+uint64_t stubVclProfilingDecodeCount();
+}
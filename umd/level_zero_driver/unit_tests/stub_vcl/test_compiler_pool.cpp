@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/ext/blob_container.hpp"
+#include "level_zero_driver/source/ext/compiler.hpp"
+#include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "stub_vcl.hpp"
+
+#include <memory>
+#include <string>
+#include <ze_api.h>
+#include <ze_graph_ext.h>
+
+namespace L0 {
+namespace ult {
+
+struct CompilerPoolTest : public ContextFixture {
+    void SetUp() override {
+        ContextFixture::SetUp();
+        stubVclSetCompilerLog("", true);
+    }
+
+    void TearDown() override {
+        stubVclSetCompilerLog("", true);
+        ContextFixture::TearDown();
+    }
+
+    ze_result_t compile(std::string &log) {
+        const uint8_t model[64] = {};
+        ze_graph_desc_2_t desc = {};
+        desc.format = ZE_GRAPH_FORMAT_NGRAPH_LITE;
+        desc.inputSize = sizeof(model);
+        desc.pInput = model;
+        desc.pBuildFlags = "";
+
+        std::unique_ptr<BlobContainer> blob;
+        return Compiler::getCompiledBlob(ctx, desc, blob, log);
+    }
+};
+
+TEST_F(CompilerPoolTest, compilerHandleIsReusedByNextCompilation) {
+    std::string log;
+    ASSERT_EQ(compile(log), ZE_RESULT_SUCCESS);
+
+    uint64_t createCount = stubVclCompilerCreateCount();
+    ASSERT_EQ(compile(log), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(stubVclCompilerCreateCount(), createCount);
+    EXPECT_TRUE(log.empty());
+}
+
+TEST_F(CompilerPoolTest, compilerHandleWithLogClearedOnReadIsReused) {
+    stubVclSetCompilerLog("compiler message", true);
+
+    std::string firstLog;
+    ASSERT_EQ(compile(firstLog), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(firstLog, "compiler message\n");
+
+    uint64_t createCount = stubVclCompilerCreateCount();
+    std::string secondLog;
+    ASSERT_EQ(compile(secondLog), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(secondLog, "compiler message\n");
+    EXPECT_EQ(stubVclCompilerCreateCount(), createCount);
+}
+
+TEST_F(CompilerPoolTest, compilerHandleWithGrowingLogIsReusedWithoutPreviousMessages) {
+    stubVclSetCompilerLog("compiler message", false);
+
+    std::string firstLog;
+    ASSERT_EQ(compile(firstLog), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(firstLog, "compiler message\n");
+
+    uint64_t createCount = stubVclCompilerCreateCount();
+    std::string secondLog;
+    ASSERT_EQ(compile(secondLog), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(secondLog, "compiler message\n");
+    EXPECT_EQ(stubVclCompilerCreateCount(), createCount);
+}
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/event.hpp"
+#include "level_zero_driver/source/eventpool.hpp"
+#include "level_zero_driver/source/ext/graph.hpp"
+#include "level_zero_driver/source/ext/graph_build_queue.hpp"
+#include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "level_zero_driver/unit_tests/options.hpp"
+#include "level_zero_driver/unit_tests/utils.hpp"
+#include "stub_vcl.hpp"
+
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+#include <ze_api.h>
+#include <ze_graph_ext.h>
+
+namespace L0 {
+namespace ult {
+
+using namespace std::chrono_literals;
+
+// Stub compiler returns the model as the compiled blob, so the model is the test blob
+struct GraphCreateAsyncTest : public ContextFixture {
+    void SetUp() override {
+        driver.setGraphBuildThreads(2);
+        ContextFixture::SetUp();
+
+        ASSERT_FALSE(TestOptions::blobPath.empty()) << "Blob path has not been provided";
+        loadBlobFromFile(TestOptions::blobPath, blob);
+        ASSERT_NE(0u, blob.size());
+
+        graphDesc.inputSize = blob.size();
+        graphDesc.pInput = blob.data();
+
+        ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+                                              nullptr,
+                                              ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+                                              2};
+        ze_event_pool_handle_t hEventPool = nullptr;
+        ASSERT_EQ(EventPool::create(context, &eventPoolDesc, 0, nullptr, &hEventPool),
+                  ZE_RESULT_SUCCESS);
+        eventPool = EventPool::fromHandle(hEventPool);
+        for (uint32_t i = 0; i < 2; i++) {
+            ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC,
+                                         nullptr,
+                                         i,
+                                         0,
+                                         ZE_EVENT_SCOPE_FLAG_HOST};
+            ze_event_handle_t hEvent = nullptr;
+            ASSERT_EQ(eventPool->createEvent(&eventDesc, &hEvent), ZE_RESULT_SUCCESS);
+            events.push_back(Event::fromHandle(hEvent));
+        }
+    }
+
+    void TearDown() override {
+        stubVclBlockCompilation(false);
+        for (auto *graph : graphs)
+            graph->destroy();
+        for (auto *event : events)
+            event->destroy();
+        if (eventPool)
+            eventPool->destroy();
+        ContextFixture::TearDown();
+    }
+
+    Graph *createAsync(Event *event) {
+        ze_graph_handle_t hGraph = nullptr;
+        EXPECT_EQ(Graph::createAsync(context, device, &graphDesc, event, &hGraph),
+                  ZE_RESULT_SUCCESS);
+        EXPECT_NE(hGraph, nullptr);
+        graphs.push_back(Graph::fromHandle(hGraph));
+        return graphs.back();
+    }
+
+    static bool waitFor(const std::function<bool()> &condition) {
+        auto timeout = std::chrono::steady_clock::now() + 10s;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > timeout)
+                return false;
+            std::this_thread::sleep_for(1ms);
+        }
+        return true;
+    }
+
+    std::vector<uint8_t> blob;
+    ze_graph_desc_2_t graphDesc = {.stype = ZE_STRUCTURE_TYPE_GRAPH_DESC_2,
+                                   .pNext = nullptr,
+                                   .format = ZE_GRAPH_FORMAT_NGRAPH_LITE,
+                                   .inputSize = 0,
+                                   .pInput = nullptr,
+                                   .pBuildFlags = "",
+                                   .flags = 0};
+    EventPool *eventPool = nullptr;
+    std::vector<Event *> events;
+    std::vector<Graph *> graphs;
+};
+
+TEST_F(GraphCreateAsyncTest, graphIsNotReadyUntilBuildCompletesAndSignalsEvent) {
+    stubVclBlockCompilation(true);
+    Graph *graph = createAsync(events[0]);
+
+    ze_graph_properties_t properties = {};
+    EXPECT_EQ(graph->getBuildStatus(), ZE_RESULT_NOT_READY);
+    EXPECT_EQ(graph->getProperties(&properties), ZE_RESULT_NOT_READY);
+    EXPECT_EQ(events[0]->queryStatus(), ZE_RESULT_NOT_READY);
+
+    stubVclBlockCompilation(false);
+    EXPECT_EQ(events[0]->hostSynchronize(UINT64_MAX), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(graph->getBuildStatus(), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(graph->getProperties(&properties), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(properties.numGraphArgs, 2u);
+}
+
+TEST_F(GraphCreateAsyncTest, failedBuildStatusIsReturnedByGraphFunctions) {
+    std::vector<uint8_t> malformedModel(blob.size(), 0xfe);
+    graphDesc.pInput = malformedModel.data();
+    Graph *graph = createAsync(events[0]);
+
+    EXPECT_EQ(events[0]->hostSynchronize(UINT64_MAX), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(graph->getBuildStatus(), ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+
+    ze_graph_properties_t properties = {};
+    size_t size = 0;
+    EXPECT_EQ(graph->getProperties(&properties), ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+    EXPECT_EQ(graph->getNativeBinary(&size, nullptr), ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+}
+
+TEST_F(GraphCreateAsyncTest, identicalBuildWaitsForBuildInFlight) {
+    auto &queue = driver.getGraphBuildQueue();
+    uint64_t compileCount = stubVclCompileCount();
+
+    stubVclBlockCompilation(true);
+    Graph *first = createAsync(events[0]);
+    Graph *second = createAsync(events[1]);
+    ASSERT_TRUE(waitFor([&] {
+        return queue.getDeduplicatedCount() == 1 && stubVclCompileCount() == compileCount + 1;
+    }));
+    EXPECT_EQ(first->getBuildStatus(), ZE_RESULT_NOT_READY);
+    EXPECT_EQ(second->getBuildStatus(), ZE_RESULT_NOT_READY);
+
+    stubVclBlockCompilation(false);
+    EXPECT_EQ(events[0]->hostSynchronize(UINT64_MAX), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(events[1]->hostSynchronize(UINT64_MAX), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(first->getBuildStatus(), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(second->getBuildStatus(), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(queue.getDeduplicatedCount(), 1u);
+    EXPECT_EQ(stubVclCompileCount(), compileCount + 1);
+}
+
+TEST_F(GraphCreateAsyncTest, eventDestroyedDuringBuildWaitsForBuild) {
+    stubVclBlockCompilation(true);
+    Graph *graph = createAsync(events[0]);
+
+    std::thread unblock([] {
+        std::this_thread::sleep_for(10ms);
+        stubVclBlockCompilation(false);
+    });
+    events[0]->destroy();
+    events.erase(events.begin());
+    EXPECT_EQ(graph->getBuildStatus(), ZE_RESULT_SUCCESS);
+    unblock.join();
+}
+
+} // namespace ult
+} // namespace L0
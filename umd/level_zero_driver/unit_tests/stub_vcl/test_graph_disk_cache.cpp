@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/ext/disk_cache.hpp"
+#include "level_zero_driver/source/ext/graph.hpp"
+#include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "level_zero_driver/unit_tests/options.hpp"
+#include "level_zero_driver/unit_tests/utils.hpp"
+#include "stub_vcl.hpp"
+#include "vpu_driver/source/os_interface/os_interface_imp.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <ze_api.h>
+#include <ze_graph_ext.h>
+
+namespace L0 {
+namespace ult {
+
+using namespace std::chrono_literals;
+
+// Driver uses a disk cache in a temporary directory, the stub compiler returns the model as blob
+struct GraphDiskCacheTest : public ContextFixture {
+    void SetUp() override {
+        ContextFixture::SetUp();
+
+        ASSERT_FALSE(TestOptions::blobPath.empty()) << "Blob path has not been provided";
+        loadBlobFromFile(TestOptions::blobPath, blob);
+        ASSERT_NE(0u, blob.size());
+        graphDesc.inputSize = blob.size();
+        graphDesc.pInput = blob.data();
+
+        std::string dirTemplate = std::filesystem::temp_directory_path() / "npu_cache_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate.data()), nullptr);
+        cacheDir = dirTemplate;
+        setenv("ZE_INTEL_NPU_CACHE_DIR", cacheDir.c_str(), 1);
+        driver.diskCache = std::make_unique<DiskCache>(*VPU::OsInterfaceImp::getInstance());
+    }
+
+    void TearDown() override {
+        stubVclBlockCompilation(false);
+        for (auto *graph : graphs)
+            graph->destroy();
+        // Index of the cache is stored to the cache directory when the cache is destroyed
+        driver.diskCache.reset();
+        unsetenv("ZE_INTEL_NPU_CACHE_DIR");
+        std::filesystem::remove_all(cacheDir);
+        ContextFixture::TearDown();
+    }
+
+    ze_result_t createGraph(Graph *&graph) {
+        ze_graph_handle_t hGraph = nullptr;
+        ze_result_t result = Graph::create(context, device, &graphDesc, &hGraph);
+        if (result == ZE_RESULT_SUCCESS)
+            graph = Graph::fromHandle(hGraph);
+        return result;
+    }
+
+    ze_graph_properties_flags_t getFlags(Graph *graph) {
+        ze_graph_properties_t properties = {};
+        EXPECT_EQ(graph->getProperties(&properties), ZE_RESULT_SUCCESS);
+        return properties.flags;
+    }
+
+    size_t countLockFiles() {
+        size_t count = 0;
+        for (const auto &entry : std::filesystem::directory_iterator(cacheDir))
+            if (entry.path().extension() == DiskCache::lockFileSuffix)
+                count++;
+        return count;
+    }
+
+    std::vector<uint8_t> blob;
+    ze_graph_desc_2_t graphDesc = {.stype = ZE_STRUCTURE_TYPE_GRAPH_DESC_2,
+                                   .pNext = nullptr,
+                                   .format = ZE_GRAPH_FORMAT_NGRAPH_LITE,
+                                   .inputSize = 0,
+                                   .pInput = nullptr,
+                                   .pBuildFlags = "",
+                                   .flags = 0};
+    std::filesystem::path cacheDir;
+    std::vector<Graph *> graphs;
+};
+
+TEST_F(GraphDiskCacheTest, compiledBlobIsStoredAndLoadedByNextGraph) {
+    uint64_t compileCount = stubVclCompileCount();
+    Graph *compiled = nullptr;
+    ASSERT_EQ(createGraph(compiled), ZE_RESULT_SUCCESS);
+    graphs.push_back(compiled);
+    EXPECT_TRUE(getFlags(compiled) & ZE_GRAPH_PROPERTIES_FLAG_COMPILED);
+    EXPECT_EQ(countLockFiles(), 0u);
+    EXPECT_GT(driver.getDiskCache().getCacheSize(), 0u);
+
+    Graph *loaded = nullptr;
+    ASSERT_EQ(createGraph(loaded), ZE_RESULT_SUCCESS);
+    graphs.push_back(loaded);
+    EXPECT_TRUE(getFlags(loaded) & ZE_GRAPH_PROPERTIES_FLAG_LOADED_FROM_CACHE);
+    EXPECT_EQ(stubVclCompileCount(), compileCount + 1);
+}
+
+TEST_F(GraphDiskCacheTest, entryIsLockedUntilCompiledBlobIsStored) {
+    uint64_t compileCount = stubVclCompileCount();
+    stubVclBlockCompilation(true);
+
+    Graph *first = nullptr;
+    ze_result_t firstResult = ZE_RESULT_ERROR_UNKNOWN;
+    std::thread firstThread([&] { firstResult = createGraph(first); });
+    auto timeout = std::chrono::steady_clock::now() + 10s;
+    while (stubVclCompileCount() == compileCount && std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(stubVclCompileCount(), compileCount + 1);
+    EXPECT_EQ(countLockFiles(), 1u);
+
+    // Second graph waits for the lock instead of compiling the same blob
+    Graph *second = nullptr;
+    ze_result_t secondResult = ZE_RESULT_ERROR_UNKNOWN;
+    std::thread secondThread([&] { secondResult = createGraph(second); });
+    std::this_thread::sleep_for(100ms);
+    stubVclBlockCompilation(false);
+    firstThread.join();
+    secondThread.join();
+
+    ASSERT_EQ(firstResult, ZE_RESULT_SUCCESS);
+    graphs.push_back(first);
+    ASSERT_EQ(secondResult, ZE_RESULT_SUCCESS);
+    graphs.push_back(second);
+    EXPECT_TRUE(getFlags(first) & ZE_GRAPH_PROPERTIES_FLAG_COMPILED);
+    EXPECT_TRUE(getFlags(second) & ZE_GRAPH_PROPERTIES_FLAG_LOADED_FROM_CACHE);
+    EXPECT_EQ(stubVclCompileCount(), compileCount + 1);
+    EXPECT_EQ(countLockFiles(), 0u);
+}
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "gtest/gtest.h"
+#include "level_zero_driver/source/ext/blob_container.hpp"
+#include "level_zero_driver/source/ext/profiling_data.hpp"
+#include "level_zero_driver/unit_tests/fixtures/device_fixture.hpp"
+#include "stub_vcl.hpp"
+#include "umd_common.hpp"
+#include "vpu_driver/source/command/command_buffer.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+
+#include <memory>
+#include <vector>
+#include <ze_api.h>
+#include <ze_graph_profiling_ext.h>
+
+namespace L0 {
+namespace ult {
+
+struct ProfilingQueryTest : public ContextFixture {
+    void SetUp() override {
+        ContextFixture::SetUp();
+
+        auto bo = ctx->createUntrackedBufferObject(queryCount * getFwDataCacheAlign(querySize),
+                                                   VPU::VPUBufferObject::Type::CachedFw);
+        ASSERT_NE(bo, nullptr);
+        pool = std::make_unique<GraphProfilingPool>(querySize,
+                                                    queryCount,
+                                                    &blobContainer,
+                                                    std::move(bo),
+                                                    [](GraphProfilingPool *) {});
+
+        ze_graph_profiling_query_handle_t hQuery = nullptr;
+        ASSERT_EQ(pool->createProfilingQuery(0, &hQuery), ZE_RESULT_SUCCESS);
+        query = GraphProfilingQuery::fromHandle(hQuery);
+        ASSERT_EQ(pool->createProfilingQuery(1, &hQuery), ZE_RESULT_SUCCESS);
+        otherQuery = GraphProfilingQuery::fromHandle(hQuery);
+    }
+
+    void TearDown() override {
+        if (query)
+            query->destroy();
+        if (otherQuery)
+            otherQuery->destroy();
+        pool.reset();
+        ContextFixture::TearDown();
+    }
+
+    void writeRawData(uint8_t value) { memset(query->getQueryPtr(), value, querySize); }
+
+    std::vector<uint8_t> readData(ze_graph_profiling_type_t type) {
+        uint32_t size = 0;
+        EXPECT_EQ(query->getData(type, &size, nullptr), ZE_RESULT_SUCCESS);
+        std::vector<uint8_t> data(size);
+        EXPECT_EQ(query->getData(type, &size, data.data()), ZE_RESULT_SUCCESS);
+        return data;
+    }
+
+    static constexpr uint32_t querySize = 256;
+    static constexpr uint32_t queryCount = 2;
+    uint8_t blob[64] = {};
+    BlobContainer blobContainer{blob, sizeof(blob)};
+    std::unique_ptr<GraphProfilingPool> pool;
+    GraphProfilingQuery *query = nullptr;
+    GraphProfilingQuery *otherQuery = nullptr;
+};
+
+TEST_F(ProfilingQueryTest, sizeQueryDecodesDataWhichIsReusedByDataQuery) {
+    writeRawData(0x11);
+
+    uint64_t decodeCount = stubVclProfilingDecodeCount();
+    uint32_t size = 0;
+    ASSERT_EQ(query->getData(ZE_GRAPH_PROFILING_LAYER_LEVEL, &size, nullptr), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(size, querySize);
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + queryCount);
+
+    std::vector<uint8_t> data(size);
+    ASSERT_EQ(query->getData(ZE_GRAPH_PROFILING_LAYER_LEVEL, &size, data.data()),
+              ZE_RESULT_SUCCESS);
+    EXPECT_EQ(data, std::vector<uint8_t>(querySize, 0x11));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + queryCount);
+}
+
+TEST_F(ProfilingQueryTest, layerAndTaskLevelDataAreDecodedSeparately) {
+    writeRawData(0x11);
+
+    uint64_t decodeCount = stubVclProfilingDecodeCount();
+    readData(ZE_GRAPH_PROFILING_LAYER_LEVEL);
+    readData(ZE_GRAPH_PROFILING_TASK_LEVEL);
+    readData(ZE_GRAPH_PROFILING_LAYER_LEVEL);
+    readData(ZE_GRAPH_PROFILING_TASK_LEVEL);
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + 2 * queryCount);
+}
+
+TEST_F(ProfilingQueryTest, completedQueriesOfPoolAreDecodedInOneBatch) {
+    writeRawData(0x11);
+    memset(otherQuery->getQueryPtr(), 0x55, querySize);
+
+    // Reading the first query decodes every completed query of the pool
+    uint64_t decodeCount = stubVclProfilingDecodeCount();
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x11));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + queryCount);
+
+    uint32_t size = 0;
+    ASSERT_EQ(otherQuery->getData(ZE_GRAPH_PROFILING_LAYER_LEVEL, &size, nullptr),
+              ZE_RESULT_SUCCESS);
+    std::vector<uint8_t> data(size);
+    ASSERT_EQ(otherQuery->getData(ZE_GRAPH_PROFILING_LAYER_LEVEL, &size, data.data()),
+              ZE_RESULT_SUCCESS);
+    EXPECT_EQ(data, std::vector<uint8_t>(querySize, 0x55));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + queryCount);
+
+    // Query of running inference is left out of the batch
+    auto fence = std::make_shared<VPU::VPUSubmissionFence>(nullptr);
+    otherQuery->onSubmit(fence);
+    query->onSubmit(nullptr);
+    writeRawData(0x22);
+    EXPECT_EQ(pool->decodeQueries(ZE_GRAPH_PROFILING_LAYER_LEVEL), ZE_RESULT_SUCCESS);
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + queryCount + 1);
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x22));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + queryCount + 1);
+
+    EXPECT_EQ(pool->decodeQueries(ZE_GRAPH_PROFILING_RAW), ZE_RESULT_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(ProfilingQueryTest, decodedDataIsCachedOnlyAfterSubmittedExecutionCompletes) {
+    writeRawData(0x11);
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x11));
+
+    // Raw data is written while the inference runs, every read decodes the current data
+    uint64_t decodeCount = stubVclProfilingDecodeCount();
+    auto fence = std::make_shared<VPU::VPUSubmissionFence>(nullptr);
+    query->onSubmit(fence);
+    writeRawData(0x22);
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x22));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + 1);
+    writeRawData(0x33);
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x33));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + 2);
+
+    fence->signal();
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x33));
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x33));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + 3);
+
+    // Next submission drops the cached data
+    query->onSubmit(nullptr);
+    writeRawData(0x44);
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_LAYER_LEVEL), std::vector<uint8_t>(querySize, 0x44));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount + 4);
+}
+
+TEST_F(ProfilingQueryTest, rawDataIsNotDecoded) {
+    writeRawData(0x11);
+
+    uint64_t decodeCount = stubVclProfilingDecodeCount();
+    EXPECT_EQ(readData(ZE_GRAPH_PROFILING_RAW), std::vector<uint8_t>(querySize, 0x11));
+    EXPECT_EQ(stubVclProfilingDecodeCount(), decodeCount);
+}
+
+} // namespace ult
+} // namespace L0
@@ -13,7 +13,7 @@
 
 #include <algorithm>
 #include <memory>
-#include <sys/types.h>
+#include <utility>
 #include <vector>
 
 namespace VPU {
@@ -53,8 +53,16 @@ void VPUCommand::appendAssociateBufferObject(const std::shared_ptr<VPUBufferObje
     }
 }
 
-void VPUCommand::eraseAssociatedBufferObjects(size_t pos) {
-    bufferObjects.erase(bufferObjects.begin() + static_cast<ssize_t>(pos), bufferObjects.end());
+void VPUCommand::insertAssociateBufferObject(std::shared_ptr<VPUBufferObject> bo) {
+    bufferObjects.emplace_back(std::move(bo));
+}
+
+void VPUCommand::removeAssociatedBufferObject(size_t pos) {
+    if (pos >= bufferObjects.size())
+        return;
+
+    bufferObjects[pos] = std::move(bufferObjects.back());
+    bufferObjects.pop_back();
 }
 
 } // namespace VPU
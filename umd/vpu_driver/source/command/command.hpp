@@ -26,6 +26,7 @@ namespace VPU {
 class VPUCommandBuffer;
 class VPUDeviceContext;
 class VPUBufferObject;
+class VPUSubmissionFence;
 
 struct VPUDescriptor {
     std::vector<uint8_t> data = {};
@@ -98,6 +99,8 @@ class VPUCommand {
     }
 
     virtual bool update(VPUCommandBuffer *commandBuffer) { return true; }
+    /* Command buffer with the command is submitted, fence is signaled on observed completion */
+    virtual void onSubmitted(const std::shared_ptr<VPUSubmissionFence> &fence) {}
 
   protected:
     bool appendAssociateBufferObject(VPUDeviceContext *ctx, const void *assocPtr);
@@ -105,7 +108,10 @@ class VPUCommand {
         const std::vector<std::shared_ptr<VPUBufferObject>> &bufferObjectsInput);
     void appendAssociateBufferObject(VPUDeviceContext *ctx, VPUBufferObject *bo);
     void appendAssociateBufferObject(const std::shared_ptr<VPUBufferObject> bo);
-    void eraseAssociatedBufferObjects(size_t pos);
+    /* Append buffer object without checking if it is already associated */
+    void insertAssociateBufferObject(std::shared_ptr<VPUBufferObject> bo);
+    /* Remove buffer object at pos, the last associated buffer object takes its position */
+    void removeAssociatedBufferObject(size_t pos);
 
     void setDescriptor(VPUDescriptor &&d) { descriptor = std::move(d); }
     virtual const vpu_cmd_header_t *getHeader() const { return nullptr; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,20 @@ VPUCommandBuffer::VPUCommandBuffer(VPUDeviceContext *ctx,
     bufferHandles.emplace_back(buffer->getHandle());
 }
 
+VPUCommandBuffer::~VPUCommandBuffer() {
+    if (ctx == nullptr)
+        return;
+
+    bool completed = !submitted;
+    auto submissionFence = std::atomic_load(&fence);
+    // Check without blocking, so finished buffer is not kept busy until queue retires it
+    if (submissionFence != nullptr && (submissionFence->isSignaled() || wait(0))) {
+        submissionFence->signal();
+        completed = true;
+    }
+    ctx->commandBufferCacheRelease(buffer, completed);
+}
+
 std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     VPUDeviceContext *ctx,
     const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
@@ -66,8 +80,7 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     size_t descOffset = getFwDataCacheAlign(cmdOffset + cmdSize);
     size_t cmdBufferSize = descOffset + descriptorSize + ctx->getExtraDmaDescriptorSize();
 
-    std::shared_ptr<VPUBufferObject> buffer =
-        ctx->createUntrackedBufferObject(cmdBufferSize, VPUBufferObject::Type::CachedFw);
+    std::shared_ptr<VPUBufferObject> buffer = ctx->commandBufferCacheAcquire(cmdBufferSize);
 
     if (buffer == nullptr) {
         LOG_E("Failed to allocate buffer object for command buffer");
@@ -75,7 +88,7 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     }
 
     auto cmdBuffer = std::make_unique<VPUCommandBuffer>(ctx, buffer, begin, end);
-    if (!cmdBuffer->initHeader(cmdSize)) {
+    if (!cmdBuffer->initHeader(cmdSize, cmdBufferSize)) {
         LOG_E("Failed to initialize VPUCommandBuffer");
         return nullptr;
     }
@@ -113,8 +126,8 @@ std::unique_ptr<VPUCommandBuffer> VPUCommandBuffer::allocateCommandBuffer(
     return cmdBuffer;
 }
 
-bool VPUCommandBuffer::initHeader(size_t cmdSize) {
-    if (buffer == nullptr) {
+bool VPUCommandBuffer::initHeader(size_t cmdSize, size_t bufferSize) {
+    if (buffer == nullptr || buffer->getAllocSize() < bufferSize) {
         LOG_E("Invalid command buffer pointer is passed");
         return false;
     }
@@ -122,8 +135,9 @@ bool VPUCommandBuffer::initHeader(size_t cmdSize) {
     vpu_cmd_buffer_header_t *bb = reinterpret_cast<vpu_cmd_buffer_header_t *>(
         buffer->getBasePointer() + offsetof(CommandHeader, header));
 
-    // Init memory - required for backward/forward compatibility with the firmware
-    memset(buffer->getBasePointer(), 0, buffer->getAllocSize());
+    // Init memory - required for backward/forward compatibility with the firmware. Buffer may come
+    // from command buffer cache so only the part used by this command buffer is cleared
+    memset(buffer->getBasePointer(), 0, bufferSize);
 
     /* By default command offset is set to CommandHeader.commandList where user commands begins,
      * when internal synchronization is used offset is changed to CommandHeader.internalSync where
@@ -137,10 +151,39 @@ bool VPUCommandBuffer::initHeader(size_t cmdSize) {
     return true;
 }
 
-void VPUCommandBuffer::addUniqueBoHandle(uint32_t handle) {
-    auto it = std::find(bufferHandles.begin(), bufferHandles.end(), handle);
-    if (it == bufferHandles.end())
+void VPUCommandBuffer::addBoHandle(uint32_t handle) {
+    // Handle of command buffer is always kept at index 0
+    if (handle == bufferHandles.front())
+        return;
+
+    auto [it, inserted] = bufferHandleRefs.try_emplace(
+        handle,
+        BufferHandleRef{static_cast<uint32_t>(bufferHandles.size()), 0});
+    if (inserted)
         bufferHandles.emplace_back(handle);
+    it->second.refCount++;
+}
+
+void VPUCommandBuffer::removeBoHandle(uint32_t handle) {
+    auto it = bufferHandleRefs.find(handle);
+    if (it == bufferHandleRefs.end() || --it->second.refCount > 0)
+        return;
+
+    // Order of handles does not matter, move the last handle in place of the removed one
+    uint32_t index = it->second.index;
+    bufferHandleRefs.erase(it);
+    bufferHandles[index] = bufferHandles.back();
+    bufferHandles.pop_back();
+    if (index < bufferHandles.size())
+        bufferHandleRefs.at(bufferHandles[index]).index = index;
+}
+
+uint32_t VPUCommandBuffer::getPreemptionBufferIndex() const {
+    if (!preemptionBuffer)
+        return 0;
+
+    auto it = bufferHandleRefs.find(preemptionBuffer->getHandle());
+    return it == bufferHandleRefs.end() ? 0 : it->second.index;
 }
 
 bool VPUCommandBuffer::addCommand(VPUCommand *cmd, size_t &cmdOffset, size_t &descOffset) {
@@ -160,7 +203,7 @@ bool VPUCommandBuffer::addCommand(VPUCommand *cmd, size_t &cmdOffset, size_t &de
     }
 
     for (const auto &bo : cmd->getAssociateBufferObjects()) {
-        addUniqueBoHandle(bo->getHandle());
+        addBoHandle(bo->getHandle());
     }
 
     if (descOffset && cmd->getDescriptorSize() > 0) {
@@ -194,10 +237,19 @@ bool VPUCommandBuffer::addWaitAtHead(std::shared_ptr<VPUBufferObject> waitBo, bo
     vpu_cmd_buffer_header_t *cmdHeader = reinterpret_cast<vpu_cmd_buffer_header_t *>(
         buffer->getBasePointer() + offsetof(CommandHeader, header));
 
+    // Slots at the head are reused, drop the handle of the previously waited buffer
+    if (waitBoGuard) {
+        for (; waitBoHandleRefs > 0; waitBoHandleRefs--)
+            removeBoHandle(waitBoGuard->getHandle());
+        waitBoGuard = nullptr;
+    }
+
     if (!waitBo) {
         cmdHeader->cmd_offset =
             offsetof(CommandHeader, commandList) - offsetof(CommandHeader, header);
-        waitBoGuard = nullptr;
+        memset(buffer->getBasePointer() + offsetof(CommandHeader, internalSync),
+               0,
+               sizeof(CommandHeader::internalSync));
         return true;
     }
 
@@ -211,10 +263,12 @@ bool VPUCommandBuffer::addWaitAtHead(std::shared_ptr<VPUBufferObject> waitBo, bo
         LOG_E("Failed to initialize synchronization wait command");
         return false;
     }
+    waitBoGuard = waitBo;
     if (!addCommand(waitCmd.get(), cmdOffset, descOffset)) {
         LOG_E("Failed to append synchronization wait command to buffer");
         return false;
     }
+    waitBoHandleRefs++;
 
     if (resetFence) {
         auto resetFenceCmd = VPUEventResetCommand::create(waitFence, waitBo);
@@ -223,6 +277,7 @@ bool VPUCommandBuffer::addWaitAtHead(std::shared_ptr<VPUBufferObject> waitBo, bo
             LOG_E("Failed to append synchronization reset command to buffer");
             return false;
         }
+        waitBoHandleRefs++;
     } else {
         auto nopCmd = VPUNopCommand::create(ctx->getDeviceCapabilities(), sizeof(vpu_cmd_fence_t));
         if (!addCommand(nopCmd.get(), cmdOffset, descOffset)) {
@@ -230,7 +285,6 @@ bool VPUCommandBuffer::addWaitAtHead(std::shared_ptr<VPUBufferObject> waitBo, bo
             return false;
         }
     }
-    waitBoGuard = std::move(waitBo);
 
     cmdHeader->cmd_offset = offsetof(CommandHeader, internalSync) - offsetof(CommandHeader, header);
     return true;
@@ -250,6 +304,20 @@ bool VPUCommandBuffer::addSelfSignalAtTail() {
     return true;
 }
 
+bool VPUCommandBuffer::removeSelfSignalAtTail() {
+    auto commandHeader = reinterpret_cast<CommandHeader *>(buffer->getBasePointer());
+    size_t descOffset = 0;
+    size_t cmdOffset = offsetof(CommandHeader, header) + commandHeader->header.cmd_buffer_size -
+                       sizeof(vpu_cmd_fence_t);
+
+    auto nopCmd = VPUNopCommand::create(ctx->getDeviceCapabilities(), sizeof(vpu_cmd_fence_t));
+    if (!addCommand(nopCmd.get(), cmdOffset, descOffset)) {
+        LOG_E("Failed to append NOP command at the end of buffer");
+        return false;
+    }
+    return true;
+}
+
 bool VPUCommandBuffer::setSyncFenceAddr(VPUCommand *cmd) {
     if (syncFenceVpuAddr != 0) {
         LOG_E("Synchronize Fence VPU Address is already set");
@@ -266,29 +334,63 @@ bool VPUCommandBuffer::setSyncFenceAddr(VPUCommand *cmd) {
     return true;
 }
 
-void VPUCommandBuffer::useBusyWait() {
-    if (!addSelfSignalAtTail())
+void VPUCommandBuffer::useBusyWait(std::shared_ptr<VPUWaitPolicy> policy) {
+    if (policy == nullptr || !addSelfSignalAtTail())
         return;
 
     resetFenceValue();
     useBusyWaitFlag = true;
+    waitPolicy = std::move(policy);
+    submitTime = waitPolicy->now();
 }
 
 bool VPUCommandBuffer::waitForCompletion(int64_t timeout_abs_ns) {
-    if (useBusyWaitFlag)
-        busyWait(timeout_abs_ns, VPUDeviceContext::getCpuTscFreqMHz());
+    auto tracked = std::atomic_load(&completion);
+    auto blockingWait = [this, &tracked](int64_t absNs) {
+        return tracked ? ctx->getCompletionService().wait(*tracked, absNs, jobStatus)
+                       : wait(absNs);
+    };
+
+    // Only waits that observe the completion as it happens are used to learn job duration
+    auto now = std::chrono::steady_clock::now();
+    bool learn = useBusyWaitFlag && !isFenceSignaled() &&
+                 timeout_abs_ns > now.time_since_epoch().count();
+
+    bool result = false;
+    if (learn) {
+        auto window = waitPolicy->getSpinWindow(submitTime);
+        if (window.duration > std::chrono::nanoseconds::zero()) {
+            int64_t spinStart = std::min((now + window.delay).time_since_epoch().count(),
+                                         timeout_abs_ns);
+            int64_t spinEnd = std::min((now + window.delay + window.duration)
+                                           .time_since_epoch()
+                                           .count(),
+                                       timeout_abs_ns);
+            if (window.delay > std::chrono::nanoseconds::zero())
+                result = blockingWait(spinStart);
+            if (!result)
+                busyWait(spinEnd, VPUDeviceContext::getCpuTscFreqMHz());
+        }
+    }
 
-    bool result = wait(timeout_abs_ns);
+    if (!result)
+        result = blockingWait(timeout_abs_ns);
 
     if (!result)
         return false;
 
+    if (learn)
+        waitPolicy->recordCompletion(submitTime);
+
+    std::atomic_store(&completion, {});
+    if (auto submissionFence = std::atomic_exchange(&fence, {}))
+        submissionFence->signal();
     useBusyWaitFlag = false;
+    submitted = false;
     inferenceScratchBuffer.reset();
 
-    if (preemptionBuffer && preemptionBufferIndex.has_value()) {
-        bufferHandles.erase(bufferHandles.begin() + preemptionBufferIndex.value());
-        preemptionBufferIndex.reset();
+    if (preemptionBuffer) {
+        removeBoHandle(preemptionBuffer->getHandle());
         preemptionBuffer.reset();
     }
     return true;
@@ -310,11 +412,9 @@ bool VPUCommandBuffer::wait(int64_t timeout_abs_ns) {
 }
 
 void VPUCommandBuffer::busyWait(int64_t timeout_abs_ns, uint32_t tscFreqMHz) {
-    /* Maximum period of busy waiting is 15ms then we enter normal wait */
     auto timeoutNs =
-        std::min(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timeout_abs_ns)) -
-                     std::chrono::steady_clock::now(),
-                 std::chrono::nanoseconds(15'000'000));
+        std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timeout_abs_ns)) -
+        std::chrono::steady_clock::now();
 
     if (timeoutNs <= std::chrono::nanoseconds::zero())
         return;
@@ -341,6 +441,11 @@ void VPUCommandBuffer::busyWait(int64_t timeout_abs_ns, uint32_t tscFreqMHz) {
     return;
 }
 
+bool VPUCommandBuffer::isFenceSignaled() const {
+    auto *cmdHeader = reinterpret_cast<const CommandHeader *>(buffer->getBasePointer());
+    return cmdHeader && cmdHeader->fenceValue == VPUEventCommand::State::STATE_DEVICE_SIGNAL;
+}
+
 void VPUCommandBuffer::resetFenceValue() {
     if (buffer == nullptr)
         return;
@@ -474,25 +579,13 @@ void VPUCommandBuffer::printCommandBuffer(const char *description) const {
     LOG(VPU_CMD, "Stop command buffer printing");
 }
 
-bool VPUCommandBuffer::replaceBufferHandles(const std::vector<uint32_t> &oldHandles,
+void VPUCommandBuffer::replaceBufferHandles(const std::vector<uint32_t> &oldHandles,
                                             const std::vector<uint32_t> &newHandles) {
-    if (oldHandles.size() != newHandles.size()) {
-        LOG_E("Incorrect number of handles passed to replaceBufferHandles");
-        return false;
-    }
-
-    bufferHandles.erase(std::remove_if(bufferHandles.begin(),
-                                       bufferHandles.end(),
-                                       [&oldHandles](auto x) {
-                                           return std::find(oldHandles.begin(),
-                                                            oldHandles.end(),
-                                                            x) != oldHandles.end();
-                                       }),
-                        bufferHandles.end());
-    for (auto &handle : newHandles) {
-        addUniqueBoHandle(handle);
-    }
-    return true;
+    // Add first, so handle that is in both lists keeps its position
+    for (auto handle : newHandles)
+        addBoHandle(handle);
+    for (auto handle : oldHandles)
+        removeBoHandle(handle);
 }
 
 bool VPUCommandBuffer::updateCommands() {
@@ -518,6 +611,14 @@ bool VPUCommandBuffer::updateCommands() {
     return true;
 }
 
+void VPUCommandBuffer::setSubmitted(std::shared_ptr<VPUSubmissionFence> submissionFence) {
+    for (auto it = commandsBegin; it != commandsEnd; it++)
+        (*it)->onSubmitted(submissionFence);
+
+    submitted = true;
+    std::atomic_store(&fence, std::move(submissionFence));
+}
+
 void VPUCommandBuffer::addPreemptionBuffer(std::shared_ptr<VPUBufferObject> bo) {
     if (preemptionBuffer) {
         LOG_E("Preemption buffer is already set, cannot add another one");
@@ -529,8 +630,7 @@ void VPUCommandBuffer::addPreemptionBuffer(std::shared_ptr<VPUBufferObject> bo)
     }
 
     preemptionBuffer = std::move(bo);
-    preemptionBufferIndex = static_cast<uint32_t>(bufferHandles.size());
-    bufferHandles.emplace_back(preemptionBuffer->getHandle());
+    addBoHandle(preemptionBuffer->getHandle());
 }
 
 } // namespace VPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,10 +12,14 @@
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/command/event_command.hpp"
+#include "vpu_driver/source/device/vpu_completion_service.hpp"
+#include "vpu_driver/source/device/vpu_wait_policy.hpp"
 
+#include <atomic>
+#include <chrono> // IWYU pragma: keep
 #include <memory>
-#include <optional>
 #include <uapi/drm/ivpu_accel.h>
+#include <unordered_map>
 #include <vector>
 
 namespace VPU {
@@ -23,12 +27,43 @@ class VPUBufferObject;
 class VPUCommand;
 class VPUDeviceContext;
 
+/**
+ * Completion state of single command buffer submission, shared by the command buffer and the
+ * queue that submitted it. The command buffer object is referenced until completion is observed,
+ * so the command buffer cache can't hand it to another job while this submission may still run.
+ */
+class VPUSubmissionFence {
+  public:
+    explicit VPUSubmissionFence(std::shared_ptr<VPUBufferObject> bo)
+        : bo(std::move(bo)) {}
+
+    bool isSignaled() const { return signaled.load(); }
+
+    /**
+     * Return buffer object to wait on, nullptr once the fence is signaled
+     */
+    std::shared_ptr<VPUBufferObject> getBuffer() const { return std::atomic_load(&bo); }
+
+    void signal() {
+        signaled = true;
+        std::atomic_store(&bo, std::shared_ptr<VPUBufferObject>());
+    }
+
+  private:
+    std::atomic<bool> signaled = false;
+    std::shared_ptr<VPUBufferObject> bo;
+};
+
 class VPUCommandBuffer {
   public:
     VPUCommandBuffer(VPUDeviceContext *ctx,
                      std::shared_ptr<VPUBufferObject> buffer,
                      const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
                      const std::vector<std::shared_ptr<VPUCommand>>::iterator &end);
+    ~VPUCommandBuffer();
+
+    VPUCommandBuffer(const VPUCommandBuffer &) = delete;
+    VPUCommandBuffer &operator=(const VPUCommandBuffer &) = delete;
 
     /**
      * Allocate and return VPUCommandBuffer
@@ -76,7 +111,11 @@ class VPUCommandBuffer {
      */
     uint64_t getFenceAddr() const { return syncFenceVpuAddr; }
 
-    bool replaceBufferHandles(const std::vector<uint32_t> &oldHandles,
+    /**
+     * Drop a reference to each of oldHandles and add a reference to each of newHandles. Handle is
+     * removed from the buffer handles when the last reference is dropped.
+     */
+    void replaceBufferHandles(const std::vector<uint32_t> &oldHandles,
                               const std::vector<uint32_t> &newHandles);
 
     bool updateCommands();
@@ -84,18 +123,56 @@ class VPUCommandBuffer {
     void resetFenceValue();
 
     uint32_t getCommandBufferOffset() const { return offsetof(CommandHeader, header); }
+    /**
+     * Patch synchronization slots at the head of the buffer to wait for fence in waitBo. Passing
+     * nullptr restores the slots to the state after allocation.
+     */
     bool addWaitAtHead(std::shared_ptr<VPUBufferObject> waitBo, bool resetFence = false);
     bool addSelfSignalAtTail();
 
+    /**
+     * Replace the signal in the tail slot with NOP command, as it is after allocation
+     */
+    bool removeSelfSignalAtTail();
+
     void addPreemptionBuffer(std::shared_ptr<VPUBufferObject> bo);
-    uint32_t getPreemptionBufferIndex() const { return preemptionBufferIndex.value_or(0); }
-    void useBusyWait();
+    uint32_t getPreemptionBufferIndex() const;
+    /**
+     * Signal fence in command buffer memory at the end of the job, so the waiter can busy wait
+     * on it. Spin time of waitForCompletion is decided by waitPolicy, which learns from the
+     * observed duration of this job.
+     */
+    void useBusyWait(std::shared_ptr<VPUWaitPolicy> policy);
+
+    /**
+     * Mark command buffer as submitted to device. Buffer memory is returned to the command buffer
+     * cache as busy until completion is observed by waitForCompletion. The fence of submission is
+     * signaled when completion is observed.
+     */
+    void setSubmitted(std::shared_ptr<VPUSubmissionFence> submissionFence = nullptr);
+
+    /**
+     * Return true if command buffer was submitted and its completion was not observed yet, either
+     * by waitForCompletion or by the queue that retired the submission
+     */
+    bool isSubmitted() const {
+        auto submissionFence = std::atomic_load(&fence);
+        return submitted && !(submissionFence && submissionFence->isSignaled());
+    }
+
+    /**
+     * Set completion tracked by completion service for the last submission. When set,
+     * waitForCompletion waits for notification from completion service instead of BO wait.
+     */
+    void setCompletion(std::shared_ptr<const VPUCompletionService::Completion> tracked) {
+        std::atomic_store(&completion, std::move(tracked));
+    }
 
   private:
     /**
      * Initialize command buffer header
      */
-    bool initHeader(size_t cmdSize);
+    bool initHeader(size_t cmdSize, size_t bufferSize);
 
     /**
      * Add VPUCommand details to the command list
@@ -106,9 +183,11 @@ class VPUCommandBuffer {
      * Set fence address that is used for command buffer recognition
      */
     bool setSyncFenceAddr(VPUCommand *cmd);
-    void addUniqueBoHandle(uint32_t handle);
+    void addBoHandle(uint32_t handle);
+    void removeBoHandle(uint32_t handle);
     bool wait(int64_t timeout_abs_ns);
     void busyWait(int64_t timeout_abs_ns, uint32_t tscFreqMHz);
+    bool isFenceSignaled() const;
 
   public:
     /* CommandHeader address has to be aligned to 64 bytes (FW cache line size) */
@@ -137,6 +216,7 @@ class VPUCommandBuffer {
      * from previous command buffer when full synchronization requested
      */
     std::shared_ptr<VPUBufferObject> waitBoGuard;
+    uint32_t waitBoHandleRefs = 0;
     uint32_t jobStatus;
     std::vector<std::shared_ptr<VPUCommand>>::iterator commandsBegin;
     std::vector<std::shared_ptr<VPUCommand>>::iterator commandsEnd;
@@ -144,13 +224,24 @@ class VPUCommandBuffer {
     uint64_t syncFenceVpuAddr = 0;
     std::vector<uint32_t> bufferHandles;
 
+    struct BufferHandleRef {
+        uint32_t index;
+        uint32_t refCount;
+    };
+    /* Position in bufferHandles and number of commands using the handle, key - handle */
+    std::unordered_map<uint32_t, BufferHandleRef> bufferHandleRefs;
+
     // The inference execute command may require a shared scratch buffer
     size_t inferenceScratchSize = 0;
     std::shared_ptr<VPUBufferObject> inferenceScratchBuffer;
 
     std::shared_ptr<VPUBufferObject> preemptionBuffer;
-    std::optional<uint32_t> preemptionBufferIndex = std::nullopt;
     bool useBusyWaitFlag = false;
+    std::shared_ptr<VPUWaitPolicy> waitPolicy;
+    std::chrono::steady_clock::time_point submitTime;
+    bool submitted = false;
+    std::shared_ptr<VPUSubmissionFence> fence;
+    std::shared_ptr<const VPUCompletionService::Completion> completion;
 };
 
 } // namespace VPU
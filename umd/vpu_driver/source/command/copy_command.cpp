@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,10 +7,12 @@
 
 #include "vpu_driver/source/command/copy_command.hpp"
 
+#include "vpu_driver/source/command/barrier_command.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <algorithm>
 #include <utility>
 
 namespace VPU {
@@ -48,6 +50,116 @@ std::shared_ptr<VPUCopyCommand> VPUCopyCommand::create(VPUDeviceContext *ctx,
                                             std::move(descriptor));
 }
 
+std::shared_ptr<VPUCopyCommand> VPUCopyCommand::create(VPUDeviceContext *ctx,
+                                                       const void *srcPtr,
+                                                       const std::shared_ptr<VPUBufferObject> srcBo,
+                                                       void *dstPtr,
+                                                       std::shared_ptr<VPUBufferObject> dstBo,
+                                                       const VPUCopyRegion &region) {
+    if (!ctx || !srcPtr || !dstPtr || !srcBo || !dstBo) {
+        LOG_E("nullptr in arguments. Copy command creation failed! ");
+        return nullptr;
+    }
+
+    if (region.width == 0 || region.height == 0 || region.depth == 0) {
+        LOG_E("Empty copy region");
+        return nullptr;
+    }
+
+    // Whole region has to be located in single buffer object, it is enough to check last byte
+    const uint8_t *srcBegin = static_cast<const uint8_t *>(srcPtr);
+    uint8_t *dstBegin = static_cast<uint8_t *>(dstPtr);
+    size_t srcLast = (region.depth - 1) * region.srcSlicePitch +
+                     (region.height - 1) * region.srcPitch + region.width - 1;
+    size_t dstLast = (region.depth - 1) * region.dstSlicePitch +
+                     (region.height - 1) * region.dstPitch + region.width - 1;
+    if (!srcBo->isInRange(srcBegin) || !srcBo->isInRange(srcBegin + srcLast)) {
+        LOG_E("Source region %p outside allocated memory", srcPtr);
+        return nullptr;
+    }
+
+    if (!dstBo->isInRange(dstBegin) || !dstBo->isInRange(dstBegin + dstLast)) {
+        LOG_E("Destination region %p outside allocated memory", dstPtr);
+        return nullptr;
+    }
+
+    VPUDescriptor descriptor;
+    uint64_t srcAddr = srcBo->getVPUAddr(srcBegin);
+    uint64_t dstAddr = dstBo->getVPUAddr(dstBegin);
+    uint64_t rangeSrc = srcAddr;
+    uint64_t rangeDst = dstAddr;
+    size_t rangeSize = 0;
+    for (size_t z = 0; z < region.depth; z++) {
+        for (size_t y = 0; y < region.height; y++) {
+            uint64_t rowSrc = srcAddr + z * region.srcSlicePitch + y * region.srcPitch;
+            uint64_t rowDst = dstAddr + z * region.dstSlicePitch + y * region.dstPitch;
+            if (rowSrc == rangeSrc + rangeSize && rowDst == rangeDst + rangeSize) {
+                rangeSize += region.width;
+                continue;
+            }
+
+            if (!ctx->getCopyCommandDescriptor(rangeSrc, rangeDst, rangeSize, descriptor))
+                return nullptr;
+            rangeSrc = rowSrc;
+            rangeDst = rowDst;
+            rangeSize = region.width;
+        }
+    }
+
+    if (!ctx->getCopyCommandDescriptor(rangeSrc, rangeDst, rangeSize, descriptor))
+        return nullptr;
+
+    LOG(VPU_CMD,
+        "Copy region %lux%lux%lu merged into %u descriptors",
+        region.width,
+        region.height,
+        region.depth,
+        descriptor.numDescriptors);
+    return std::make_shared<VPUCopyCommand>(std::move(srcBo),
+                                            std::move(dstBo),
+                                            region.width * region.height * region.depth,
+                                            std::move(descriptor));
+}
+
+std::vector<std::shared_ptr<VPUCommand>>
+VPUCopyCommand::createFillSequence(VPUDeviceContext *ctx,
+                                   const std::shared_ptr<VPUBufferObject> &patternBo,
+                                   void *dstPtr,
+                                   const std::shared_ptr<VPUBufferObject> &dstBo,
+                                   size_t size) {
+    if (!ctx || !patternBo || !dstPtr || !dstBo) {
+        LOG_E("nullptr in arguments. Fill sequence creation failed! ");
+        return {};
+    }
+
+    if (size > 0 && !dstBo->isInRange(static_cast<uint8_t *>(dstPtr) + size - 1)) {
+        LOG_E("Fill of %lu bytes at %p exceeds allocated memory", size, dstPtr);
+        return {};
+    }
+
+    std::vector<std::shared_ptr<VPUCommand>> commands;
+    size_t filled = std::min(size, patternBo->getAllocSize());
+    auto cmd = create(ctx, patternBo->getBasePointer(), patternBo, dstPtr, dstBo, filled);
+    if (cmd == nullptr)
+        return {};
+    commands.push_back(std::move(cmd));
+
+    uint8_t *dstBegin = static_cast<uint8_t *>(dstPtr);
+    while (filled < size) {
+        size_t copySize = std::min(filled, size - filled);
+        cmd = create(ctx, dstBegin, dstBo, dstBegin + filled, dstBo, copySize);
+        if (cmd == nullptr)
+            return {};
+
+        commands.push_back(VPUBarrierCommand::create());
+        commands.push_back(std::move(cmd));
+        filled += copySize;
+    }
+
+    LOG(VPU_CMD, "Fill of %lu bytes split into %lu copy commands", size, commands.size() / 2 + 1);
+    return commands;
+}
+
 VPUCopyCommand::VPUCopyCommand(const std::shared_ptr<VPUBufferObject> srcBo,
                                std::shared_ptr<VPUBufferObject> dstBo,
                                size_t size,
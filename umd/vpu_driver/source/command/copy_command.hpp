@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,20 @@ namespace VPU {
 class VPUBufferObject;
 class VPUDeviceContext;
 
+/**
+ * Strided 3D region of memory, width is in bytes. Rows of the region are placed pitch bytes apart
+ * and slices are placed slicePitch bytes apart, both for source and destination.
+ */
+struct VPUCopyRegion {
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t srcPitch;
+    size_t srcSlicePitch;
+    size_t dstPitch;
+    size_t dstSlicePitch;
+};
+
 class VPUCopyCommand : public VPUCommand {
   public:
     VPUCopyCommand(const std::shared_ptr<VPUBufferObject> srcBo,
@@ -37,6 +51,30 @@ class VPUCopyCommand : public VPUCommand {
                                                   std::shared_ptr<VPUBufferObject> dstBo,
                                                   size_t size);
 
+    /**
+     * Create single copy command for the region that starts at srcPtr and dstPtr. Rows that are
+     * contiguous in both source and destination are merged into one descriptor.
+     */
+    static std::shared_ptr<VPUCopyCommand> create(VPUDeviceContext *ctx,
+                                                  const void *srcPtr,
+                                                  const std::shared_ptr<VPUBufferObject> srcBo,
+                                                  void *dstPtr,
+                                                  std::shared_ptr<VPUBufferObject> dstBo,
+                                                  const VPUCopyRegion &region);
+
+    /**
+     * Create commands that fill size bytes at dstPtr with repeated content of patternBo. Only the
+     * first copy reads patternBo, every next copy duplicates already filled part of destination
+     * right behind it. Copies are separated by barriers, so the number of commands grows
+     * logarithmically with size. Returns empty vector on failure.
+     */
+    static std::vector<std::shared_ptr<VPUCommand>>
+    createFillSequence(VPUDeviceContext *ctx,
+                       const std::shared_ptr<VPUBufferObject> &patternBo,
+                       void *dstPtr,
+                       const std::shared_ptr<VPUBufferObject> &dstBo,
+                       size_t size);
+
     const vpu_cmd_header_t *getHeader() const override {
         return reinterpret_cast<const vpu_cmd_header_t *>(
             std::any_cast<vpu_cmd_copy_buffer_t>(&command));
@@ -46,6 +84,9 @@ class VPUCopyCommand : public VPUCommand {
         std::any_cast<vpu_cmd_copy_buffer_t>(&command)->desc_start_offset = vpuAddr;
     }
 
+    /**
+     * Append descriptors that copy size bytes from srcAddr to dstAddr to the descriptor.
+     */
     template <class T>
     static bool
     fillDescriptor(uint64_t srcAddr, uint64_t dstAddr, size_t size, VPUDescriptor &descriptor) {
@@ -59,13 +100,14 @@ class VPUCopyCommand : public VPUCommand {
             return false;
         }
 
-        descriptor.numDescriptors =
+        uint32_t firstDescriptor = descriptor.numDescriptors;
+        descriptor.numDescriptors +=
             safe_cast<uint32_t>((size + COPY_SIZE_LIMIT - 1) / COPY_SIZE_LIMIT);
         descriptor.data.resize(sizeof(T) * descriptor.numDescriptors, 0);
 
         T *copyDescs = reinterpret_cast<T *>(descriptor.data.data());
         size_t sizeLeft = size;
-        for (size_t i = 0; i < descriptor.numDescriptors; i++) {
+        for (size_t i = firstDescriptor; i < descriptor.numDescriptors; i++) {
             copyDescs[i].src_address = srcAddr;
             copyDescs[i].dst_address = dstAddr;
             if (sizeLeft < COPY_SIZE_LIMIT) {
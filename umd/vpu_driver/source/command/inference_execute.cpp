@@ -9,6 +9,7 @@
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "level_zero_driver/source/ext/elf_parser.hpp"
+#include "level_zero_driver/source/ext/profiling_data.hpp"
 #include "umd_common.hpp"
 #include "vpu_driver/source/command/command_buffer.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
@@ -38,7 +39,7 @@ VPUInferenceExecute::VPUInferenceExecute(std::shared_ptr<L0::ElfParser> &parser,
     , inputStrides(inputStrides)
     , outputStrides(outputStrides)
     , profilingQuery(profilingQuery)
-    , userArgIndex(bos.size()) {
+    , userArgBos(userBos) {
     vpu_cmd_inference_execute_t cmd = {};
     cmd.header.type = VPU_CMD_INFERENCE_EXECUTE;
     cmd.header.size = sizeof(vpu_cmd_inference_execute_t);
@@ -48,14 +49,10 @@ VPUInferenceExecute::VPUInferenceExecute(std::shared_ptr<L0::ElfParser> &parser,
     command.emplace<vpu_cmd_inference_execute_t>(cmd);
 
     appendAssociateBufferObject(bos);
-    userArgIndex = getAssociateBufferObjects().size();
 
-    appendAssociateBufferObject(userBos);
-
-    userArgHandles.reserve(userBos.size());
-    for (const auto &bo : userBos) {
-        userArgHandles.emplace_back(bo->getHandle());
-    }
+    userBoRefs.reserve(userBos.size());
+    for (const auto &bo : userBos)
+        acquireUserBufferObject(bo);
 
     LOG(VPU_CMD,
         "VPUInferenceExecute command created - hpi: %p, inference_id: %lu",
@@ -74,7 +71,6 @@ VPUInferenceExecute::create(std::shared_ptr<L0::ElfParser> parser,
                             uint64_t inferenceId,
                             std::vector<std::shared_ptr<VPUBufferObject>> &bos) {
     std::vector<std::shared_ptr<VPUBufferObject>> userBos;
-    userBos.reserve(inputPtrs.size() + outputPtrs.size());
     if (!parser->applyInputOutputs(cmdHpi,
                                    inputPtrs,
                                    outputPtrs,
@@ -103,6 +99,12 @@ bool VPUInferenceExecute::setUpdates(const ArgumentUpdatesMap &updatesMap) {
     uint32_t numOutputArgs = safe_cast<uint32_t>(outputs.size());
     uint32_t numArgs = numInputArgs + numOutputArgs;
 
+    // Drop cached buffer object to look it up again, keep the one that is applied to the command
+    auto replaceArgBo = [this](uint32_t argIndex) {
+        replacedArgBos.try_emplace(argIndex, userArgBos[argIndex]);
+        userArgBos[argIndex] = nullptr;
+    };
+
     for (const auto &[argIndex, argUpdate] : updatesMap) {
         if (argIndex >= numArgs) {
             LOG_E("Invalid argument index (%u). It exceeds the number of graph arguments %u",
@@ -112,8 +114,9 @@ bool VPUInferenceExecute::setUpdates(const ArgumentUpdatesMap &updatesMap) {
         }
 
         if (argIndex < numInputArgs) {
-            if (argUpdate.ptr) {
+            if (argUpdate.ptr && inputs[argIndex] != *argUpdate.ptr) {
                 inputs[argIndex] = *argUpdate.ptr;
+                replaceArgBo(argIndex);
             }
             if (argUpdate.strides) {
                 inputStrides[argIndex] = *argUpdate.strides;
@@ -122,8 +125,9 @@ bool VPUInferenceExecute::setUpdates(const ArgumentUpdatesMap &updatesMap) {
             }
         } else {
             uint32_t outputIndex = argIndex - numInputArgs;
-            if (argUpdate.ptr) {
+            if (argUpdate.ptr && outputs[outputIndex] != *argUpdate.ptr) {
                 outputs[outputIndex] = *argUpdate.ptr;
+                replaceArgBo(argIndex);
             }
             if (argUpdate.strides) {
                 outputStrides[outputIndex] = *argUpdate.strides;
@@ -142,26 +146,59 @@ bool VPUInferenceExecute::update(VPUCommandBuffer *commandBuffer) {
 
     cmdNeedsUpdate = false;
 
-    std::vector<std::shared_ptr<VPUBufferObject>> userArgs;
+    // Arguments with unchanged pointer reuse cached buffer objects
     if (!parser->applyInputOutputs(hpi,
                                    inputs,
                                    outputs,
                                    inputStrides,
                                    outputStrides,
                                    profilingQuery,
-                                   userArgs)) {
+                                   userArgBos)) {
         return false;
     }
 
+    std::vector<uint32_t> oldHandles;
     std::vector<uint32_t> newHandles;
-    for (const auto &bo : userArgs)
-        newHandles.emplace_back(bo->getHandle());
+    for (const auto &[argIndex, oldBo] : replacedArgBos) {
+        const auto &newBo = userArgBos[argIndex];
+        if (newBo == oldBo)
+            continue;
+
+        if (releaseUserBufferObject(oldBo))
+            oldHandles.push_back(oldBo->getHandle());
+        if (acquireUserBufferObject(newBo))
+            newHandles.push_back(newBo->getHandle());
+    }
+    replacedArgBos.clear();
+
+    commandBuffer->replaceBufferHandles(oldHandles, newHandles);
+    return true;
+}
 
-    commandBuffer->replaceBufferHandles(userArgHandles, newHandles);
-    userArgHandles = std::move(newHandles);
+bool VPUInferenceExecute::acquireUserBufferObject(const std::shared_ptr<VPUBufferObject> &bo) {
+    size_t index = getAssociateBufferObjects().size();
+    auto [it, inserted] = userBoRefs.try_emplace(bo.get(), UserBufferObjectRef{index, 0});
+    if (inserted)
+        insertAssociateBufferObject(bo);
+    return it->second.refCount++ == 0;
+}
+
+bool VPUInferenceExecute::releaseUserBufferObject(const std::shared_ptr<VPUBufferObject> &bo) {
+    auto it = userBoRefs.find(bo.get());
+    if (it == userBoRefs.end() || --it->second.refCount > 0)
+        return false;
+
+    size_t index = it->second.index;
+    userBoRefs.erase(it);
+    removeAssociatedBufferObject(index);
 
-    eraseAssociatedBufferObjects(userArgIndex);
-    appendAssociateBufferObject(std::move(userArgs));
+    // The last associated buffer object has moved to index, update it only if it is a user one
+    const auto &associated = getAssociateBufferObjects();
+    if (index < associated.size()) {
+        auto moved = userBoRefs.find(associated[index].get());
+        if (moved != userBoRefs.end() && moved->second.index == associated.size())
+            moved->second.index = index;
+    }
     return true;
 }
 
@@ -169,6 +206,12 @@ size_t VPUInferenceExecute::getSharedScratchSize() {
     return parser->getSharedScratchSize();
 }
 
+void VPUInferenceExecute::onSubmitted(const std::shared_ptr<VPUSubmissionFence> &fence) {
+    // Decoded profiling data is not reused until completion of this execution is observed
+    if (profilingQuery != nullptr)
+        profilingQuery->onSubmit(fence);
+}
+
 void VPUInferenceExecute::updateScratchBuffer(VPUCommandBuffer *cmdBuffer,
                                               std::shared_ptr<VPUBufferObject> scratchBuffer) {
     if (getSharedScratchSize() == 0)
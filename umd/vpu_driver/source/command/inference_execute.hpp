@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 #include <any>
 #include <api/vpu_jsm_job_cmd_api.h>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace elf {
@@ -67,6 +68,7 @@ class VPUInferenceExecute : public VPUCommand {
 
     bool setUpdates(const ArgumentUpdatesMap &updatesMap) override;
     bool update(VPUCommandBuffer *commandBuffer) override;
+    void onSubmitted(const std::shared_ptr<VPUSubmissionFence> &fence) override;
 
     void updateScratchBuffer(VPUCommandBuffer *cmdBuffer, std::shared_ptr<VPUBufferObject> bo);
     size_t getSharedScratchSize();
@@ -80,9 +82,20 @@ class VPUInferenceExecute : public VPUCommand {
     ArgumentStridesMap outputStrides;
     L0::GraphProfilingQuery *profilingQuery;
 
-    /* inputs, outputs and graph profiling buffer */
-    size_t userArgIndex;
-    std::vector<uint32_t> userArgHandles;
+    bool acquireUserBufferObject(const std::shared_ptr<VPUBufferObject> &bo);
+    bool releaseUserBufferObject(const std::shared_ptr<VPUBufferObject> &bo);
+
+    /* Buffer object of each input, output and graph profiling buffer */
+    std::vector<std::shared_ptr<VPUBufferObject>> userArgBos;
+    /* Buffer objects of arguments with pointer changed since the last update, key - arg index */
+    std::unordered_map<uint32_t, std::shared_ptr<VPUBufferObject>> replacedArgBos;
+
+    struct UserBufferObjectRef {
+        size_t index;
+        uint32_t refCount;
+    };
+    /* Position in associated buffer objects and number of arguments using the buffer object */
+    std::unordered_map<const VPUBufferObject *, UserBufferObjectRef> userBoRefs;
 
     /* shared scratch buffer, on command create the value is invalid */
     uint32_t lastScratchBoHandle = UINT32_MAX;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -99,10 +99,41 @@ bool VPUJob::stripInOrder() {
     if (!isClosed()) {
         return false;
     }
+
+    if (cmdBuffers.empty() || !hasInOrderWorkload) {
+        hasInOrderWorkload = false;
+        return true;
+    }
+
+    auto &front = cmdBuffers.front();
+    auto &back = cmdBuffers.back();
+    if (front->isSubmitted() || back->isSubmitted()) {
+        // Device may still process the buffers, build new ones instead of patching them
+        cmdBuffers.clear();
+        hasInOrderWorkload = false;
+        closed = false;
+        return closeCommands();
+    }
+
+    // Synchronization slots are reserved at close, restore them in place
+    if (!front->addWaitAtHead(nullptr)) {
+        LOG_E("Failed to remove synchronization from the first command buffer");
+        return false;
+    }
+    if (!back->removeSelfSignalAtTail()) {
+        LOG_E("Failed to remove synchronization from the last command buffer");
+        return false;
+    }
+
+    hasInOrderWorkload = false;
+    return true;
+}
+
+void VPUJob::reset() {
     cmdBuffers.clear();
+    commands.clear();
     hasInOrderWorkload = false;
     closed = false;
-    return closeCommands();
 }
 
 bool VPUJob::createCommandBuffer(const std::vector<std::shared_ptr<VPUCommand>>::iterator &begin,
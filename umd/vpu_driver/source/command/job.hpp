@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,12 @@ class VPUJob {
     bool makeInOrder(std::shared_ptr<VPUBufferObject> &waitFor);
     bool stripInOrder();
 
+    /**
+     * Drop commands and command buffers of a completed job, so the object can be reused to build
+     * a new job
+     */
+    void reset();
+
     /**
      * Return true if the command buffers execution is completed with success
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,21 +13,74 @@
 #include "vpu_driver/source/command/command_buffer.hpp"
 #include "vpu_driver/source/command/job.hpp"
 #include "vpu_driver/source/device/hw_info.hpp"
+#include "vpu_driver/source/device/vpu_completion_service.hpp"
 #include "vpu_driver/source/device/vpu_device_context.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/trace_perfetto.hpp"
 
+#include <atomic>
 #include <chrono> // IWYU pragma: keep
 #include <errno.h>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
 #include <uapi/drm/ivpu_accel.h>
 #include <vector>
 
 namespace VPU {
 
-template <typename T>
-bool submitWithWait(const VPUJob *job, T &&submitFunc) {
+static TraceCounter submitBusyRetries("Submit EBUSY retries");
+
+VPUDeviceQueue::VPUDeviceQueue(VPUDriverApi *api)
+    : pDriverApi(api) {
+    static std::atomic<uint32_t> nextTraceId = 0;
+    inFlightCounter = std::make_unique<TraceCounter>("In-flight jobs of queue " +
+                                                     std::to_string(nextTraceId++));
+}
+
+VPUDeviceQueue::~VPUDeviceQueue() {
+    if (pCompletionService != nullptr)
+        pCompletionService->destroyStream(completionEventFd);
+}
+
+int VPUDeviceQueue::enableCompletionNotification(VPUCompletionService &service) {
+    if (pCompletionService != nullptr)
+        return completionEventFd;
+
+    completionEventFd = service.createStream();
+    if (completionEventFd < 0)
+        return -1;
+
+    pCompletionService = &service;
+    return completionEventFd;
+}
+
+bool VPUDeviceQueue::setWaitPolicy(const VPUWaitPolicy::Config &config) {
+    // In order job signals the fence that the next job waits for and resets, so busy wait on it
+    // could spin until the end of the window after the job completed
+    if (isInOrder()) {
+        LOG_E("Wait policy is not supported on in order queue");
+        return false;
+    }
+
+    if (config.spinBudget <= std::chrono::nanoseconds::zero()) {
+        waitPolicy.reset();
+        LOG(CMDQUEUE, "Busy wait disabled");
+        return true;
+    }
+
+    waitPolicy = std::make_shared<VPUWaitPolicy>(config);
+    LOG(CMDQUEUE,
+        "Wait policy set, spin budget: %ld ns, percentile: %u",
+        config.spinBudget.count(),
+        config.percentile);
+    return true;
+}
+
+bool VPUDeviceQueue::submitCommandBuffers(const VPUJob *job) {
     if (job == nullptr) {
         LOG_W("Invalid argument - job is nullptr");
         return false;
@@ -38,16 +91,37 @@ bool submitWithWait(const VPUJob *job, T &&submitFunc) {
         return false;
     }
 
+    std::unique_lock<std::mutex> lock(inFlightMutex);
     for (const auto &cmdBuffer : job->getCommandBuffers()) {
-        constexpr auto pollTime = std::chrono::seconds(2);
-        const auto timeoutPoint = std::chrono::steady_clock::now() + pollTime;
-
-        while ((submitFunc)(cmdBuffer) < 0) {
-            /*
-             * SUBMIT ioctl returns EBUSY if command queue is full. Driver should wait till firmware
-             * completes a job and make a space for new job in queue. Polling time is set to 2
-             * seconds to match with TDR timeout.
-             */
+        /*
+         * SUBMIT ioctl returns EBUSY if command queue is full. Driver should wait till firmware
+         * completes a job and make a space for new job in queue. Waiting time is set to 2
+         * seconds to match with TDR timeout.
+         */
+        const auto startPoint = std::chrono::steady_clock::now();
+        const auto timeoutPoint = startPoint + std::chrono::seconds(2);
+        bool throttled = false;
+        bool probing = false;
+
+        while (true) {
+            if (inFlightLimit != 0 && inFlight.size() >= inFlightLimit) {
+                retireInFlight();
+                // Firmware queue may have grown, try to submit above the limit once in a while
+                probing = inFlight.size() >= inFlightLimit &&
+                          ++limitedSubmissions % inFlightLimitProbeInterval == 0;
+                if (inFlight.size() >= inFlightLimit && !probing) {
+                    throttled = true;
+                    if (!waitForInFlightSpace(lock, timeoutPoint.time_since_epoch().count())) {
+                        LOG_E("Timed out waiting for driver to submit a job");
+                        return false;
+                    }
+                    continue;
+                }
+            }
+
+            if (submitCommandBuffer(cmdBuffer) == 0)
+                break;
+
             if (errno != EBUSY) {
                 LOG_E("Failed to submit command buffer: %p", cmdBuffer.get());
                 return false;
@@ -58,15 +132,119 @@ bool submitWithWait(const VPUJob *job, T &&submitFunc) {
                 return false;
             }
 
-            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            throttled = true;
+            submitBusyRetries.add(1);
+            retireInFlight();
+            if (inFlight.empty()) {
+                // Queue is filled by jobs that are not tracked, nothing to block on
+                lock.unlock();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                lock.lock();
+                continue;
+            }
+
+            if (inFlightLimit != inFlight.size()) {
+                inFlightLimit = inFlight.size();
+                LOG(CMDQUEUE, "Command queue is full, limit in-flight jobs to %zu", inFlightLimit);
+            }
+            probing = false;
+        }
+
+        if (probing) {
+            inFlightLimit = inFlight.size() + 1;
+            LOG(CMDQUEUE, "Command queue accepted more jobs, raise limit to %zu", inFlightLimit);
+        }
+
+        auto fence = std::make_shared<VPUSubmissionFence>(cmdBuffer->getBuffer());
+        cmdBuffer->setSubmitted(fence);
+
+        InFlightEntry entry = {std::move(fence), nullptr};
+        if (pCompletionService != nullptr) {
+            entry.completion = pCompletionService->track(completionEventFd, cmdBuffer->getBuffer());
+            cmdBuffer->setCompletion(entry.completion);
+        }
+        if (inFlight.size() >= maxTrackedInFlight)
+            retireInFlight();
+        if (inFlight.size() >= maxTrackedInFlight)
+            inFlight.pop_front();
+        inFlight.push_back(std::move(entry));
+        inFlightCounter->set(static_cast<int64_t>(inFlight.size()));
+
+        if (throttled) {
+            throttleCount++;
+            throttleTimeNs += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - startPoint)
+                    .count());
         }
     }
     LOG(DEVICE, "Buffers execution successfully triggered");
     return true;
 }
 
-VPUDeviceQueue::VPUDeviceQueue(VPUDriverApi *api)
-    : pDriverApi(api) {}
+bool VPUDeviceQueue::waitInFlight(const InFlightEntry &entry, int64_t timeoutAbsNs) {
+    if (entry.fence->isSignaled())
+        return true;
+
+    uint32_t jobStatus = 0;
+    bool completed = false;
+    if (entry.completion != nullptr) {
+        completed = pCompletionService->wait(*entry.completion, timeoutAbsNs, jobStatus);
+    } else if (auto bo = entry.fence->getBuffer()) {
+        drm_ivpu_bo_wait args = {};
+        args.handle = bo->getHandle();
+        args.timeout_ns = timeoutAbsNs;
+        completed = pDriverApi->wait(&args) == 0;
+    } else {
+        // Fence has been signaled after the check above
+        completed = true;
+    }
+
+    if (completed)
+        entry.fence->signal();
+    return completed;
+}
+
+void VPUDeviceQueue::retireInFlight() {
+    bool retired = false;
+    while (!inFlight.empty() && waitInFlight(inFlight.front(), 0)) {
+        inFlight.pop_front();
+        retired = true;
+    }
+    if (retired)
+        inFlightCounter->set(static_cast<int64_t>(inFlight.size()));
+}
+
+bool VPUDeviceQueue::waitForInFlightSpace(std::unique_lock<std::mutex> &lock,
+                                          int64_t timeoutAbsNs) {
+    const auto timeoutPoint =
+        std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timeoutAbsNs));
+    while (!inFlight.empty() && inFlight.size() >= inFlightLimit) {
+        if (retiring) {
+            // Other submitter waits for the oldest job, it notifies when the wait is over
+            if (!inFlightCv.wait_until(lock, timeoutPoint, [this] { return !retiring; }))
+                return false;
+            continue;
+        }
+
+        // Jobs from a queue complete in submission order, block only for the oldest one
+        InFlightEntry oldest = inFlight.front();
+        retiring = true;
+        lock.unlock();
+        bool completed = waitInFlight(oldest, timeoutAbsNs);
+        lock.lock();
+        retiring = false;
+        retireInFlight();
+        inFlightCv.notify_all();
+        if (!completed)
+            return false;
+    }
+    return true;
+}
+
+VPUDeviceQueue::ThrottleStats VPUDeviceQueue::getThrottleStats() const {
+    return {throttleCount.load(), throttleTimeNs.load()};
+}
 
 std::unique_ptr<VPUDeviceQueue>
 VPUDeviceQueue::create(VPUDeviceContext *VPUContext, Priority queuePriority, uint32_t mode) {
@@ -112,6 +290,9 @@ int VPUDeviceQueueLegacy::submitCommandBuffer(const std::unique_ptr<VPUCommandBu
     execParam.commands_offset = cmdBuf->getCommandBufferOffset();
     execParam.priority = static_cast<uint32_t>(priority);
 
+    if (waitPolicy)
+        cmdBuf->useBusyWait(waitPolicy);
+
     LOG(DEVICE,
         "Submit params -> engine: %u, flags: %u, offset: %u, count: %u, ptr: "
         "%#llx, prior: %u",
@@ -130,7 +311,7 @@ bool VPUDeviceQueueLegacy::submit(VPUJob *job) {
         LOG_E("Submit failed, INORDER request on queue without INORDER support");
         return false;
     }
-    return submitWithWait(job, [this](auto &cmdBuf) { return this->submitCommandBuffer(cmdBuf); });
+    return submitCommandBuffers(job);
 }
 
 bool VPUDeviceQueueLegacy::toBackgroundPriority() {
@@ -150,7 +331,11 @@ VPUDeviceQueueManaged::VPUDeviceQueueManaged(VPUDriverApi *api,
     , currentId(defaultQueue)
     , defaultId(defaultQueue)
     , backgroundId(defaultQueue)
-    , modeFlags(mode) {}
+    , modeFlags(mode) {
+    // Fence of in order job is reset by the next job, so spinning waiter could miss the signal
+    if (isTurbo() && !isInOrder())
+        waitPolicy = std::make_shared<VPUWaitPolicy>(VPUWaitPolicy::Config{});
+}
 
 VPUDeviceQueueManaged::~VPUDeviceQueueManaged() {
     if (backgroundId != defaultId && pDriverApi->commandQueueDestroy(backgroundId))
@@ -168,8 +353,8 @@ int VPUDeviceQueueManaged::submitCommandBuffer(const std::unique_ptr<VPUCommandB
     submitArgs.preempt_buffer_index = cmdBuf->getPreemptionBufferIndex();
     submitArgs.cmdq_id = currentId;
 
-    if (isTurbo())
-        cmdBuf->useBusyWait();
+    if (waitPolicy)
+        cmdBuf->useBusyWait(waitPolicy);
 
     return pDriverApi->commandQueueSubmit(&submitArgs);
 }
@@ -190,7 +375,7 @@ bool VPUDeviceQueueManaged::submit(VPUJob *job) {
         }
     }
 
-    return submitWithWait(job, [this](auto &cmdBuf) { return this->submitCommandBuffer(cmdBuf); });
+    return submitCommandBuffers(job);
 }
 
 bool VPUDeviceQueueManaged::toBackgroundPriority() {
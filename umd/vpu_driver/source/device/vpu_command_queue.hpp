@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,15 +8,25 @@
 #pragma once
 #include <stdint.h>
 
+#include "vpu_driver/source/device/vpu_completion_service.hpp"
+#include "vpu_driver/source/device/vpu_wait_policy.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <uapi/drm/ivpu_accel.h>
 
+class TraceCounter;
+
 namespace VPU {
 class VPUJob;
 class VPUBufferObject;
 class VPUCommandBuffer;
 class VPUDeviceContext;
 class VPUDriverApi;
+class VPUSubmissionFence;
 
 class VPUDeviceQueue {
   public:
@@ -29,7 +39,7 @@ class VPUDeviceQueue {
 
     enum ModeFlags : uint32_t { DEFAULT = 0, TURBO = 0x1, IN_ORDER = 0x2 };
 
-    virtual ~VPUDeviceQueue() = default;
+    virtual ~VPUDeviceQueue();
 
     static std::unique_ptr<VPUDeviceQueue>
     create(VPUDeviceContext *VPUContext, Priority queuePriority, uint32_t mode);
@@ -40,11 +50,89 @@ class VPUDeviceQueue {
     virtual bool isInOrder() = 0;
     virtual bool isTurbo() const = 0;
 
+    /**
+     * Observe completion of submitted jobs with completion service. Returns eventfd that is
+     * signaled on every retired command buffer, or -1 on failure. The stream is destroyed
+     * together with the queue.
+     *
+     * Level Zero command queue enables it for every queue except turbo queues, so host waiters
+     * of a job share the BO waits of the service thread. Turbo queue enables it only on request,
+     * without it a waiter issues BO wait itself, which avoids hand-off to the service thread and
+     * a second wakeup.
+     */
+    int enableCompletionNotification(VPUCompletionService &service);
+
+    /**
+     * Busy wait for jobs of this queue according to adaptive wait policy. Turbo queues that are
+     * not in order use the default policy. Not supported on in order queues, which use the
+     * command buffer fence for device synchronization.
+     */
+    bool setWaitPolicy(const VPUWaitPolicy::Config &config);
+    std::shared_ptr<VPUWaitPolicy> getWaitPolicy() const { return waitPolicy; }
+
+    struct ThrottleStats {
+        uint64_t count;
+        uint64_t timeNs;
+    };
+
+    /**
+     * Return number of command buffer submissions that waited for space in the firmware queue
+     * and total time they spent waiting
+     */
+    ThrottleStats getThrottleStats() const;
+
+    /* Maximum number of submitted command buffers tracked by the queue */
+    static constexpr size_t maxTrackedInFlight = 256;
+    /* Every n-th submission blocked by the in-flight limit is tried anyway to raise the limit */
+    static constexpr uint32_t inFlightLimitProbeInterval = 16;
+
   protected:
     VPUDeviceQueue(VPUDriverApi *api);
     virtual int submitCommandBuffer(const std::unique_ptr<VPUCommandBuffer> &cmdBuf) = 0;
+    /**
+     * Submit command buffers of job. When the firmware queue is full, the submitter blocks until
+     * the oldest job of this queue completes. The number of in-flight command buffers observed
+     * when the firmware queue became full limits following submissions. The limit is raised when
+     * a probing submission above it is accepted.
+     */
+    bool submitCommandBuffers(const VPUJob *job);
 
     VPUDriverApi *pDriverApi;
+    VPUCompletionService *pCompletionService = nullptr;
+    int completionEventFd = -1;
+    std::shared_ptr<VPUWaitPolicy> waitPolicy;
+
+  private:
+    struct InFlightEntry {
+        std::shared_ptr<VPUSubmissionFence> fence;
+        std::shared_ptr<const VPUCompletionService::Completion> completion;
+    };
+
+    /**
+     * Wait for submission of entry until timeoutAbsNs and signal its fence if it is finished
+     */
+    bool waitInFlight(const InFlightEntry &entry, int64_t timeoutAbsNs);
+
+    /**
+     * Remove finished command buffers from the front of in-flight list without blocking
+     */
+    void retireInFlight();
+
+    /**
+     * Block until number of in-flight command buffers drops below the limit. One submitter waits
+     * for the oldest job without holding the lock, others wait for its wakeup.
+     */
+    bool waitForInFlightSpace(std::unique_lock<std::mutex> &lock, int64_t timeoutAbsNs);
+
+    std::mutex inFlightMutex;
+    std::condition_variable inFlightCv;
+    std::deque<InFlightEntry> inFlight;
+    size_t inFlightLimit = 0;
+    uint32_t limitedSubmissions = 0;
+    bool retiring = false;
+    std::atomic<uint64_t> throttleCount = 0;
+    std::atomic<uint64_t> throttleTimeNs = 0;
+    std::unique_ptr<TraceCounter> inFlightCounter;
 };
 
 class VPUDeviceQueueLegacy final : public VPUDeviceQueue {
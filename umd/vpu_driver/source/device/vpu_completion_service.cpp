@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include "vpu_driver/source/device/vpu_completion_service.hpp"
+
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <errno.h>
+#include <limits>
+#include <sys/eventfd.h>
+#include <tuple>
+#include <uapi/drm/ivpu_accel.h>
+#include <unistd.h>
+
+namespace VPU {
+
+static int64_t getAbsTimeoutNs(std::chrono::nanoseconds timeout) {
+    return (std::chrono::steady_clock::now().time_since_epoch() + timeout).count();
+}
+
+VPUCompletionService::VPUCompletionService(VPUDriverApi &drvApi)
+    : drvApi(drvApi) {}
+
+VPUCompletionService::~VPUCompletionService() {
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workCv.notify_all();
+    if (thread.joinable())
+        thread.join();
+
+    for (const auto &stream : streams)
+        ::close(stream.first);
+}
+
+int VPUCompletionService::createStream() {
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) {
+        LOG_E("Failed to create eventfd, errno: %d", errno);
+        return -1;
+    }
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    streams[fd];
+    LOG(DEVICE, "Created completion stream with eventfd %d", fd);
+    return fd;
+}
+
+void VPUCompletionService::destroyStream(int stream) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto it = streams.find(stream);
+    if (it == streams.end())
+        return;
+
+    for (auto &entry : it->second) {
+        entry.completion->done = true;
+        entry.completion->failed = true;
+    }
+    if (!it->second.empty())
+        completionCv.notify_all();
+
+    streams.erase(it);
+    ::close(stream);
+    LOG(DEVICE, "Destroyed completion stream with eventfd %d", stream);
+}
+
+size_t VPUCompletionService::getStreamCount() {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return streams.size();
+}
+
+std::shared_ptr<const VPUCompletionService::Completion>
+VPUCompletionService::track(int stream, std::shared_ptr<VPUBufferObject> bo) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto it = streams.find(stream);
+    if (it == streams.end() || bo == nullptr) {
+        LOG_E("Invalid completion stream %d or buffer object %p", stream, bo.get());
+        return nullptr;
+    }
+
+    // Handle of sub-allocation is shared by the whole slab, waiting on it waits for other jobs
+    if (bo->isSubAllocation()) {
+        LOG_E("Sub-allocated buffer object %p can't be used to track a job", bo.get());
+        return nullptr;
+    }
+
+    auto completion = std::make_shared<Completion>();
+    completion->handle = bo->getHandle();
+    it->second.push_back({std::move(bo), completion, nextSequence++});
+
+    if (!thread.joinable())
+        thread = std::thread(&VPUCompletionService::run, this);
+    workCv.notify_one();
+    return completion;
+}
+
+bool VPUCompletionService::wait(const Completion &completion,
+                                int64_t timeoutAbsNs,
+                                uint32_t &jobStatus) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto deadline = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timeoutAbsNs));
+    if (!completionCv.wait_until(lock, deadline, [&completion] { return completion.done; })) {
+        // Status query has to see the job finished before the worker thread retires it
+        lock.unlock();
+        return waitBo(completion.handle, 0, jobStatus) == WaitResult::COMPLETED;
+    }
+
+    if (completion.failed) {
+        lock.unlock();
+        return waitBo(completion.handle, timeoutAbsNs, jobStatus) == WaitResult::COMPLETED;
+    }
+
+    jobStatus = completion.jobStatus;
+    return true;
+}
+
+VPUCompletionService::WaitResult
+VPUCompletionService::waitBo(uint32_t handle, int64_t timeoutAbsNs, uint32_t &jobStatus) {
+    drm_ivpu_bo_wait args = {};
+    args.handle = handle;
+    args.timeout_ns = timeoutAbsNs;
+    args.job_status = std::numeric_limits<uint32_t>::max();
+
+    if (drvApi.wait(&args) == 0) {
+        jobStatus = args.job_status;
+        return WaitResult::COMPLETED;
+    }
+    return errno == ETIMEDOUT ? WaitResult::PENDING : WaitResult::FAILED;
+}
+
+void VPUCompletionService::run() {
+    // Buffer objects stay referenced only by the streams, so destroyed stream releases them
+    struct Head {
+        int stream;
+        uint64_t sequence;
+        uint32_t handle;
+    };
+    using Result = std::tuple<int, uint64_t, WaitResult, uint32_t>;
+    std::vector<Head> heads;
+    std::vector<Result> results;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        workCv.wait(lock, [this] {
+            if (stopping)
+                return true;
+            for (const auto &stream : streams) {
+                if (!stream.second.empty())
+                    return true;
+            }
+            return false;
+        });
+        if (stopping)
+            break;
+
+        for (const auto &[fd, pending] : streams) {
+            if (!pending.empty())
+                heads.push_back({fd, pending.front().sequence, pending.front().completion->handle});
+        }
+        lock.unlock();
+
+        // Retire every job that is already finished without blocking
+        results.clear();
+        for (const auto &head : heads) {
+            uint32_t jobStatus = 0;
+            waitCount++;
+            auto result = waitBo(head.handle, 0, jobStatus);
+            if (result != WaitResult::PENDING)
+                results.emplace_back(head.stream, head.sequence, result, jobStatus);
+        }
+
+        // Nothing progressed, block on the oldest job for bounded time slice
+        if (results.empty()) {
+            auto oldest = std::min_element(heads.begin(), heads.end(), [](auto &a, auto &b) {
+                return a.sequence < b.sequence;
+            });
+            auto slice = heads.size() > 1 ? multiStreamWaitSlice : singleStreamWaitSlice;
+            uint32_t jobStatus = 0;
+            waitCount++;
+            auto result = waitBo(oldest->handle, getAbsTimeoutNs(slice), jobStatus);
+            if (result != WaitResult::PENDING)
+                results.emplace_back(oldest->stream, oldest->sequence, result, jobStatus);
+        }
+        heads.clear();
+
+        lock.lock();
+        for (const auto &[fd, sequence, result, jobStatus] : results) {
+            // Stream could be destroyed while waiting and its eventfd number reused by a new one
+            auto it = streams.find(fd);
+            if (it == streams.end() || it->second.empty() ||
+                it->second.front().sequence != sequence)
+                continue;
+
+            auto &pending = it->second;
+            auto &completion = *pending.front().completion;
+            completion.done = true;
+            completion.failed = result == WaitResult::FAILED;
+            completion.jobStatus = jobStatus;
+            pending.pop_front();
+
+            uint64_t value = 1;
+            if (::write(fd, &value, sizeof(value)) != sizeof(value))
+                LOG_W("Failed to signal eventfd %d, errno: %d", fd, errno);
+        }
+        if (!results.empty())
+            completionCv.notify_all();
+    }
+}
+
+} // namespace VPU
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VPU {
+class VPUBufferObject;
+class VPUDriverApi;
+
+/**
+ * Per device context service that observes job completion on behalf of host waiters. A single
+ * worker thread issues DRM_IOCTL_IVPU_BO_WAIT for the oldest job of every stream and wakes all
+ * threads waiting for retired jobs with one condition variable broadcast. Each stream owns an
+ * eventfd that is signaled on every retired job, so it can be polled together with other file
+ * descriptors.
+ */
+class VPUCompletionService {
+  public:
+    struct Completion {
+        uint32_t handle = 0;
+        bool done = false;
+        bool failed = false;
+        uint32_t jobStatus = 0;
+    };
+
+    explicit VPUCompletionService(VPUDriverApi &drvApi);
+    ~VPUCompletionService();
+
+    VPUCompletionService(const VPUCompletionService &) = delete;
+    VPUCompletionService &operator=(const VPUCompletionService &) = delete;
+
+    /**
+     * Create stream identified by returned eventfd. The eventfd is non blocking and is owned by
+     * the service. Returns -1 on failure.
+     */
+    int createStream();
+
+    /**
+     * Stop tracking jobs of stream and close its eventfd. Jobs that are still pending are marked
+     * failed, so their waiters fall back to direct BO wait.
+     */
+    void destroyStream(int stream);
+
+    /**
+     * Start tracking job submitted with bo. Jobs on a stream have to be tracked in submission
+     * order. Returns nullptr if stream does not exist or bo is a sub-allocation.
+     */
+    std::shared_ptr<const Completion> track(int stream, std::shared_ptr<VPUBufferObject> bo);
+
+    /**
+     * Wait until completion is observed or absolute timeout expires. If the service failed to
+     * observe the job, the job is waited with direct BO wait instead. Expired wait, e.g. status
+     * query with zero timeout, checks the job once with non-blocking BO wait.
+     * @return true if job is finished, jobStatus is set to job status reported by kernel
+     */
+    bool wait(const Completion &completion, int64_t timeoutAbsNs, uint32_t &jobStatus);
+
+    /**
+     * Return number of BO waits issued by the worker thread
+     */
+    uint64_t getWaitCount() const { return waitCount.load(); }
+
+    /**
+     * Return number of streams that are not destroyed
+     */
+    size_t getStreamCount();
+
+    /* Maximum time the worker thread blocks in single BO wait, it bounds latency of other streams
+     * and of the shutdown */
+    static constexpr std::chrono::milliseconds singleStreamWaitSlice{10};
+    static constexpr std::chrono::milliseconds multiStreamWaitSlice{1};
+
+  private:
+    struct Entry {
+        std::shared_ptr<VPUBufferObject> bo;
+        std::shared_ptr<Completion> completion;
+        uint64_t sequence;
+    };
+
+    enum class WaitResult { PENDING, COMPLETED, FAILED };
+
+    void run();
+    WaitResult waitBo(uint32_t handle, int64_t timeoutAbsNs, uint32_t &jobStatus);
+
+    VPUDriverApi &drvApi;
+
+    std::mutex mutex;
+    std::condition_variable workCv;
+    std::condition_variable completionCv;
+    std::map<int, std::deque<Entry>> streams;
+    uint64_t nextSequence = 0;
+    bool stopping = false;
+    std::thread thread;
+    std::atomic<uint64_t> waitCount = 0;
+};
+
+} // namespace VPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,19 +14,31 @@
 #include "vpu_driver/source/device/hw_info.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
+#include "vpu_driver/source/utilities/trace_perfetto.hpp"
 
 #include <chrono> // IWYU pragma: keep
 #include <exception>
 #include <immintrin.h> // IWYU pragma: keep
 #include <memory>
+#include <string.h>
 #include <uapi/drm/ivpu_accel.h>
 
 namespace VPU {
 struct VPUDescriptor;
 
+static TraceCounter scratchCacheSize("Scratch cache size");
+static TraceCounter preemptionCacheCount("Preemption cache buffers");
+
+static uint64_t nextBufferSnapshotGeneration() {
+    static std::atomic<uint64_t> generation = 0;
+    return ++generation;
+}
+
 VPUDeviceContext::VPUDeviceContext(std::unique_ptr<VPUDriverApi> drvApi, VPUHwInfo *info)
     : drvApi(std::move(drvApi))
-    , hwInfo(info) {
+    , hwInfo(info)
+    , bufferSnapshotGeneration(nextBufferSnapshotGeneration())
+    , completionService(*this->drvApi) {
     LOG(DEVICE, "VPUDeviceContext is created");
 }
 
@@ -68,6 +80,7 @@ VPUDeviceContext::importBufferObject(VPUBufferObject::Location type, int32_t fd)
         LOG_E("Failed to add buffer object to trackedBuffers");
         return nullptr;
     }
+    invalidateBufferSnapshot();
     LOG(DEVICE, "Buffer object %p successfully imported and added to trackedBuffers", &it->second);
     return it->second;
 }
@@ -79,7 +92,9 @@ VPUDeviceContext::createBufferObject(size_t size,
     if (!hwInfo->dmaMemoryRangeCapability && (static_cast<uint32_t>(type) & DRM_IVPU_BO_DMA_MEM))
         type = VPUBufferObject::convertDmaToShaveRange(type);
 
-    auto bo = VPUBufferObject::create(*drvApi, loc, type, size);
+    auto bo = slabAllocator.acquire(this, size, type, loc);
+    if (bo == nullptr)
+        bo = VPUBufferObject::create(*drvApi, loc, type, size);
     if (bo == nullptr) {
         LOG_E("Failed to create VPUBufferObject");
         return nullptr;
@@ -98,6 +113,7 @@ VPUDeviceContext::createBufferObject(size_t size,
         LOG_E("Failed to add buffer object to trackedBuffers");
         return nullptr;
     }
+    invalidateBufferSnapshot();
     return it->second;
 }
 
@@ -136,30 +152,74 @@ bool VPUDeviceContext::freeMemAlloc(std::shared_ptr<VPUBufferObject> bo) {
         LOG_E("Failed to remove VPUBufferObject from trackedBuffers!");
         return false;
     }
+    invalidateBufferSnapshot();
 
-    MemoryStatistics::get().snapshot();
     return true;
 }
 
+void VPUDeviceContext::invalidateBufferSnapshot() {
+    bufferSnapshot.reset();
+    bufferSnapshotGeneration.store(nextBufferSnapshotGeneration(), std::memory_order_release);
+}
+
+const VPUDeviceContext::BufferSnapshot &VPUDeviceContext::getBufferSnapshot() const {
+    thread_local std::shared_ptr<const BufferSnapshot> cachedSnapshot;
+
+    if (cachedSnapshot != nullptr &&
+        cachedSnapshot->generation == bufferSnapshotGeneration.load(std::memory_order_acquire))
+        return *cachedSnapshot;
+
+    const std::lock_guard<std::mutex> lock(mtx);
+    if (bufferSnapshot == nullptr) {
+        auto snapshot = std::make_shared<BufferSnapshot>();
+        snapshot->generation = bufferSnapshotGeneration.load(std::memory_order_relaxed);
+        snapshot->ranges.reserve(trackedBuffers.size());
+        // trackedBuffers is sorted in descending order
+        for (auto it = trackedBuffers.rbegin(); it != trackedBuffers.rend(); it++) {
+            const uint8_t *begin = it->second->getBasePointer();
+            snapshot->ranges.push_back({begin, begin + it->second->getAllocSize(), it->second});
+        }
+        bufferSnapshot = std::move(snapshot);
+    }
+    cachedSnapshot = bufferSnapshot;
+    return *cachedSnapshot;
+}
+
+std::shared_ptr<VPUBufferObject> VPUDeviceContext::findTrackedBufferObject(const void *ptr) const {
+    const std::lock_guard<std::mutex> lock(mtx);
+    auto it = trackedBuffers.lower_bound(ptr);
+    if (it == trackedBuffers.end() || !it->second->isInRange(ptr))
+        return nullptr;
+    return it->second;
+}
+
 std::shared_ptr<VPUBufferObject> VPUDeviceContext::findBufferObject(const void *ptr) const {
     if (ptr == nullptr) {
         LOG_E("ptr passed is nullptr!");
         return nullptr;
     }
 
-    const std::lock_guard<std::mutex> lock(mtx);
-    auto it = trackedBuffers.lower_bound(ptr);
-    if (it == trackedBuffers.end()) {
+    const auto &ranges = getBufferSnapshot().ranges;
+    auto it = std::upper_bound(ranges.begin(),
+                               ranges.end(),
+                               static_cast<const uint8_t *>(ptr),
+                               [](const uint8_t *p, const auto &range) { return p < range.begin; });
+    if (it == ranges.begin()) {
         LOG(DEVICE, "Could not find a pointer %p in VPUDeviceContext %p", ptr, this);
         return nullptr;
     }
 
-    auto &bo = it->second;
-    if (!bo->isInRange(ptr)) {
+    it--;
+    if (ptr >= it->end) {
         LOG(DEVICE, "Pointer %p is not in the allocation size in VPUDeviceContext %p", ptr, this);
         return nullptr;
     }
 
+    auto bo = it->bo.lock();
+    if (bo == nullptr) {
+        // Buffer was freed after the snapshot was validated, the range may be reused already
+        return findTrackedBufferObject(ptr);
+    }
     return bo;
 }
 
@@ -184,7 +244,25 @@ VPUDeviceContext::createUntrackedBufferObject(size_t size, VPUBufferObject::Type
     const std::lock_guard<std::mutex> lock(mtx);
     untrackedBuffers.emplace_back(bo);
 
-    MemoryStatistics::get().snapshot();
+    return bo;
+}
+
+std::shared_ptr<VPUBufferObject>
+VPUDeviceContext::createUntrackedSubAllocation(size_t size, VPUBufferObject::Type range) {
+    if (size == 0) {
+        LOG_E("Invalid size - %lu", size);
+        return nullptr;
+    }
+
+    if (!hwInfo->dmaMemoryRangeCapability && (static_cast<uint32_t>(range) & DRM_IVPU_BO_DMA_MEM))
+        range = VPUBufferObject::convertDmaToShaveRange(range);
+
+    auto bo = slabAllocator.acquire(this, size, range, VPUBufferObject::Location::Internal);
+    if (bo == nullptr)
+        return createUntrackedBufferObject(size, range);
+
+    const std::lock_guard<std::mutex> lock(mtx);
+    untrackedBuffers.emplace_back(bo);
     return bo;
 }
 
@@ -242,8 +320,8 @@ VPUDeviceContext::createTrackedBufferObjectFromUserPtr(void *userPtr, size_t siz
         LOG_E("Failed to add buffer object to trackedBuffers");
         return nullptr;
     }
+    invalidateBufferSnapshot();
 
-    MemoryStatistics::get().snapshot();
     return it->second;
 }
 
@@ -269,7 +347,6 @@ VPUDeviceContext::createUntrackedBufferObjectFromUserPtr(void *userPtr,
     const std::lock_guard<std::mutex> lock(mtx);
     untrackedBuffers.emplace_back(bo);
 
-    MemoryStatistics::get().snapshot();
     return bo;
 }
 
@@ -299,16 +376,45 @@ void VPUDeviceContext::printCopyDescriptor(void *desc, vpu_cmd_header_t *cmd) {
     hwInfo->printCopyDescriptor(desc, cmd);
 }
 
-bool VPUDeviceContext::getUniqueInferenceId(uint64_t &inferenceId) {
+/*
+ * Kernel driver does not support reservation of ID ranges. The kernel ID is unique for device, so
+ * it is used as a block number. IDs from the block are tagged with the highest bit to avoid
+ * collisions with IDs that are requested directly from kernel by other processes.
+ */
+bool VPUDeviceContext::reserveInferenceIdBlock() {
+    uint64_t blockId = 0;
     try {
-        inferenceId = drvApi->getDeviceParam(DRM_IVPU_PARAM_UNIQUE_INFERENCE_ID);
+        blockId = drvApi->getDeviceParam(DRM_IVPU_PARAM_UNIQUE_INFERENCE_ID);
     } catch (const std::exception &err) {
         LOG_E("Failed to get unique inference id, error: %s", err.what());
         return false;
     }
+
+    if (blockId >= (inferenceIdBlockTag >> inferenceIdBlockShift)) {
+        LOG_E("Kernel inference id %#lx exceeds the block range", blockId);
+        return false;
+    }
+
+    inferenceIdNext = inferenceIdBlockTag | (blockId << inferenceIdBlockShift);
+    inferenceIdEnd = inferenceIdNext + (1ULL << inferenceIdBlockShift);
+    LOG(DEVICE, "Reserved inference id block %#lx - %#lx", inferenceIdNext, inferenceIdEnd);
     return true;
 }
 
+bool VPUDeviceContext::getUniqueInferenceId(uint64_t &inferenceId) {
+    const std::lock_guard<std::mutex> lock(inferenceIdMutex);
+    if (inferenceIdNext == inferenceIdEnd && !reserveInferenceIdBlock())
+        return false;
+
+    inferenceId = inferenceIdNext++;
+    return true;
+}
+
+ScratchCacheFactory::~ScratchCacheFactory() {
+    for (const auto &bo : scratchBuffers)
+        scratchCacheSize.add(-static_cast<int64_t>(bo->getAllocSize()));
+}
+
 std::shared_ptr<VPUBufferObject> ScratchCacheFactory::acquire(VPUDeviceContext *ctx, size_t size) {
     if (size == 0) {
         return nullptr;
@@ -353,6 +459,7 @@ std::shared_ptr<VPUBufferObject> ScratchCacheFactory::acquire(VPUDeviceContext *
     }
 
     scratchBuffers.emplace_back(bo);
+    scratchCacheSize.add(static_cast<int64_t>(bo->getAllocSize()));
     LOG(CONTEXT,
         "Allocated scratch buffer: handle %u, size: %lu, requested size: %lu",
         bo->getHandle(),
@@ -369,12 +476,20 @@ void ScratchCacheFactory::prune(size_t size) {
     scratchBuffers.erase(std::remove_if(scratchBuffers.begin(),
                                         scratchBuffers.end(),
                                         [size](const std::shared_ptr<VPUBufferObject> &bo) {
-                                            return bo.use_count() == 1 &&
-                                                   bo->getAllocSize() <= size;
+                                            if (bo.use_count() != 1 || bo->getAllocSize() > size)
+                                                return false;
+
+                                            scratchCacheSize.add(
+                                                -static_cast<int64_t>(bo->getAllocSize()));
+                                            return true;
                                         }),
                          scratchBuffers.end());
 }
 
+PreemptionCacheFactory::~PreemptionCacheFactory() {
+    preemptionCacheCount.add(-static_cast<int64_t>(preemptionBuffers.size()));
+}
+
 std::shared_ptr<VPUBufferObject> PreemptionCacheFactory::acquire(VPUDeviceContext *ctx) {
     const auto size = ctx->getDeviceCapabilities().fwPreemptBufSize;
     if (size == 0) {
@@ -401,6 +516,7 @@ std::shared_ptr<VPUBufferObject> PreemptionCacheFactory::acquire(VPUDeviceContex
     }
 
     preemptionBuffers.push_back(bo);
+    preemptionCacheCount.add(1);
     LOG(CONTEXT,
         "Returning new preemption buffer: handle %u, size: %lu",
         bo->getHandle(),
@@ -413,6 +529,7 @@ void PreemptionCacheFactory::prune() {
     if (numQueues > 0)
         numQueues--;
 
+    size_t cachedCount = preemptionBuffers.size();
     size_t numQueuesToRemove = preemptionBuffers.size() > numQueues
                                    ? preemptionBuffers.size() - numQueues
                                    : preemptionBuffers.size();
@@ -427,7 +544,278 @@ void PreemptionCacheFactory::prune() {
                            return false;
                        }),
         preemptionBuffers.end());
+    preemptionCacheCount.add(static_cast<int64_t>(preemptionBuffers.size()) -
+                             static_cast<int64_t>(cachedCount));
     LOG(CONTEXT, "Pruned preemption buffers, remaining count: %zu", preemptionBuffers.size());
 }
 
+size_t CommandBufferCacheFactory::getSizeClass(size_t size) {
+    size_t sizeClass = 0;
+    for (size_t classSize = minSizeClass; classSize < size; classSize <<= 1)
+        sizeClass++;
+    return sizeClass;
+}
+
+std::shared_ptr<VPUBufferObject> CommandBufferCacheFactory::acquire(VPUDeviceContext *ctx,
+                                                                    size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+
+    size_t sizeClass = getSizeClass(size);
+    if (sizeClass >= numSizeClasses) {
+        LOG(CONTEXT, "Command buffer size %lu exceeds cached size classes", size);
+        return ctx->createUntrackedBufferObject(size, VPUBufferObject::Type::CachedFw);
+    }
+
+    const std::lock_guard<std::mutex> lock(cacheMutex);
+    auto &entries = sizeClasses[sizeClass];
+    for (auto &entry : entries) {
+        if (entry.bo.use_count() != 1) {
+            continue;
+        }
+
+        if (!entry.completed) {
+            // Buffer has been released without waiting for job, check it without blocking
+            drm_ivpu_bo_wait args = {};
+            args.handle = entry.bo->getHandle();
+            args.timeout_ns = 0;
+            if (ctx->getDriverApi().wait(&args) != 0) {
+                continue;
+            }
+            entry.completed = true;
+        }
+
+        LOG(CONTEXT,
+            "Reusing command buffer: handle %u, size: %lu, requested size: %lu",
+            entry.bo->getHandle(),
+            entry.bo->getAllocSize(),
+            size);
+        return entry.bo;
+    }
+
+    auto bo = ctx->createUntrackedBufferObject(minSizeClass << sizeClass,
+                                               VPUBufferObject::Type::CachedFw);
+    if (bo == nullptr) {
+        LOG_E("Failed to allocate command buffer of size %lu", size);
+        return nullptr;
+    }
+
+    if (entries.size() < maxBuffersPerSizeClass) {
+        entries.push_back({bo, true});
+    }
+
+    LOG(CONTEXT,
+        "Allocated command buffer: handle %u, size: %lu, requested size: %lu",
+        bo->getHandle(),
+        bo->getAllocSize(),
+        size);
+    return bo;
+}
+
+void CommandBufferCacheFactory::release(const std::shared_ptr<VPUBufferObject> &bo,
+                                        bool completed) {
+    if (bo == nullptr) {
+        return;
+    }
+
+    size_t sizeClass = getSizeClass(bo->getAllocSize());
+    if (sizeClass >= numSizeClasses) {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(cacheMutex);
+    for (auto &entry : sizeClasses[sizeClass]) {
+        if (entry.bo == bo) {
+            entry.completed = completed;
+            return;
+        }
+    }
+}
+
+void CommandBufferCacheFactory::prune() {
+    const std::lock_guard<std::mutex> lock(cacheMutex);
+    size_t count = 0;
+    for (auto &entries : sizeClasses) {
+        entries.erase(std::remove_if(entries.begin(),
+                                     entries.end(),
+                                     [](const CacheEntry &entry) {
+                                         return entry.bo.use_count() == 1;
+                                     }),
+                      entries.end());
+        count += entries.size();
+    }
+    LOG(CONTEXT, "Pruned command buffers, remaining count: %zu", count);
+}
+
+size_t CommandBufferCacheFactory::getIdleCount() {
+    const std::lock_guard<std::mutex> lock(cacheMutex);
+    size_t count = 0;
+    for (auto &entries : sizeClasses) {
+        count += static_cast<size_t>(
+            std::count_if(entries.begin(), entries.end(), [](const CacheEntry &entry) {
+                return entry.bo.use_count() == 1;
+            }));
+    }
+    return count;
+}
+
+std::shared_ptr<VPUBufferObject> FillPatternCacheFactory::acquire(VPUDeviceContext *ctx,
+                                                                  uint32_t pattern) {
+    const std::lock_guard<std::mutex> lock(patternMutex);
+    auto it = std::find_if(patternBuffers.begin(), patternBuffers.end(), [pattern](auto &entry) {
+        return entry.first == pattern;
+    });
+    if (it != patternBuffers.end()) {
+        auto entry = std::move(*it);
+        patternBuffers.erase(it);
+        patternBuffers.push_back(std::move(entry));
+        return patternBuffers.back().second;
+    }
+
+    auto bo =
+        ctx->createUntrackedBufferObject(patternBufferSize, VPUBufferObject::Type::CachedDma);
+    if (bo == nullptr) {
+        LOG_E("Failed to create fill pattern buffer");
+        return nullptr;
+    }
+
+    if (!bo->fillBuffer(&pattern, sizeof(pattern))) {
+        LOG_E("Failed to fill pattern buffer with pattern %#x", pattern);
+        return nullptr;
+    }
+
+    // Commands that still use dropped buffer keep it alive
+    if (patternBuffers.size() >= maxPatterns)
+        patternBuffers.erase(patternBuffers.begin());
+
+    patternBuffers.emplace_back(pattern, bo);
+    LOG(CONTEXT,
+        "Returning new fill pattern buffer: handle %u, pattern %#x",
+        bo->getHandle(),
+        pattern);
+    return bo;
+}
+
+void FillPatternCacheFactory::prune() {
+    const std::lock_guard<std::mutex> lock(patternMutex);
+    patternBuffers.clear();
+}
+
+size_t FillPatternCacheFactory::getCount() {
+    const std::lock_guard<std::mutex> lock(patternMutex);
+    return patternBuffers.size();
+}
+
+SlabAllocatorFactory::SlabAllocatorFactory()
+    : state(std::make_shared<State>()) {}
+
+std::shared_ptr<VPUBufferObject>
+SlabAllocatorFactory::acquire(VPUDeviceContext *ctx,
+                              size_t size,
+                              VPUBufferObject::Type type,
+                              VPUBufferObject::Location location) {
+    if (size == 0 || size > maxAllocSize || !(static_cast<uint32_t>(type) & DRM_IVPU_BO_MAPPABLE))
+        return nullptr;
+
+    // Exportable and user pointer buffers need own handle
+    if (location != VPUBufferObject::Location::Internal &&
+        location != VPUBufferObject::Location::Host &&
+        location != VPUBufferObject::Location::Device &&
+        location != VPUBufferObject::Location::Shared)
+        return nullptr;
+
+    size_t slotSize = minSizeClass;
+    while (slotSize < size)
+        slotSize <<= 1;
+    SlabKey key = {location, type, slotSize};
+
+    const std::lock_guard<std::mutex> lock(state->mutex);
+    auto &slabs = state->slabs[key];
+    auto it = std::find_if(slabs.begin(), slabs.end(), [](const auto &slab) {
+        return !slab->isFull();
+    });
+    if (it == slabs.end()) {
+        auto slabBo = VPUBufferObject::create(ctx->getDriverApi(), location, type, slabSize);
+        if (slabBo == nullptr) {
+            LOG_E("Failed to allocate slab for slot size %lu", slotSize);
+            return nullptr;
+        }
+
+        auto slab = std::make_unique<Slab>();
+        slab->bo = std::move(slabBo);
+        slab->slotSize = slotSize;
+        slab->numSlots = slabSize / slotSize;
+        LOG(CONTEXT,
+            "Allocated slab: handle %u, slot size: %lu, slots: %lu",
+            slab->bo->getHandle(),
+            slab->slotSize,
+            slab->numSlots);
+        it = slabs.insert(slabs.end(), std::move(slab));
+    }
+
+    Slab *slab = it->get();
+    size_t slot = 0;
+    if (slab->freeSlots.empty()) {
+        slot = slab->nextUnusedSlot++;
+    } else {
+        slot = slab->freeSlots.back();
+        slab->freeSlots.pop_back();
+        // Memory of new buffer object is zeroed by kernel, keep the same for reused slot
+        memset(slab->bo->getBasePointer() + slot * slotSize, 0, slotSize);
+    }
+
+    size_t offset = slot * slotSize;
+
+    auto bo = VPUBufferObject::createSubAllocation(
+        *slab->bo,
+        location,
+        offset,
+        size,
+        [state = state, key, slab, slot] { state->release(key, slab, slot); });
+    if (bo == nullptr) {
+        slab->freeSlots.push_back(slot);
+        return nullptr;
+    }
+    return bo;
+}
+
+void SlabAllocatorFactory::State::release(const SlabKey &key, Slab *slab, size_t slot) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    slab->freeSlots.push_back(slot);
+    if (!slab->isEmpty())
+        return;
+
+    // Keep single empty slab per size class to not recreate it on every allocation
+    auto &keySlabs = slabs[key];
+    auto emptyCount = std::count_if(keySlabs.begin(), keySlabs.end(), [](const auto &s) {
+        return s->isEmpty();
+    });
+    if (emptyCount > 1) {
+        keySlabs.erase(std::find_if(keySlabs.begin(), keySlabs.end(), [slab](const auto &s) {
+            return s.get() == slab;
+        }));
+    }
+}
+
+void SlabAllocatorFactory::prune() {
+    const std::lock_guard<std::mutex> lock(state->mutex);
+    for (auto it = state->slabs.begin(); it != state->slabs.end();) {
+        auto &slabs = it->second;
+        slabs.erase(std::remove_if(slabs.begin(),
+                                   slabs.end(),
+                                   [](const auto &slab) { return slab->isEmpty(); }),
+                    slabs.end());
+        it = slabs.empty() ? state->slabs.erase(it) : std::next(it);
+    }
+}
+
+size_t SlabAllocatorFactory::getSlabCount() {
+    const std::lock_guard<std::mutex> lock(state->mutex);
+    size_t count = 0;
+    for (const auto &entry : state->slabs)
+        count += entry.second.size();
+    return count;
+}
+
 } // namespace VPU
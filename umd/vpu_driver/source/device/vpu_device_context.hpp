@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,16 +12,19 @@
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "vpu_driver/source/device/hw_info.hpp"
+#include "vpu_driver/source/device/vpu_completion_service.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
-#include "vpu_driver/source/utilities/stats.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <bitset>
 #include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -32,6 +35,7 @@ class VPUDeviceContext;
 class ScratchCacheFactory {
   public:
     ScratchCacheFactory() = default;
+    ~ScratchCacheFactory();
 
     std::shared_ptr<VPUBufferObject> acquire(VPUDeviceContext *ctx, size_t size);
     void prune(size_t size);
@@ -44,6 +48,7 @@ class ScratchCacheFactory {
 class PreemptionCacheFactory {
   public:
     PreemptionCacheFactory() = default;
+    ~PreemptionCacheFactory();
 
     std::shared_ptr<VPUBufferObject> acquire(VPUDeviceContext *ctx);
     void prune();
@@ -58,6 +63,109 @@ class PreemptionCacheFactory {
     std::mutex preemptionMutex;
 };
 
+class CommandBufferCacheFactory {
+  public:
+    CommandBufferCacheFactory() = default;
+
+    /**
+     * Return a command buffer object of at least size bytes. Buffers are bucketed by power of two
+     * size classes and reused once no job references them anymore. Requests above the largest
+     * size class are allocated directly and are not cached.
+     */
+    std::shared_ptr<VPUBufferObject> acquire(VPUDeviceContext *ctx, size_t size);
+
+    /**
+     * Mark buffer as released by command buffer. If completed is false the buffer may still be
+     * processed by device and has to be checked with non blocking wait before reuse.
+     */
+    void release(const std::shared_ptr<VPUBufferObject> &bo, bool completed);
+    void prune();
+    size_t getIdleCount();
+
+    static constexpr size_t minSizeClass = 4 * 1024;
+    static constexpr size_t numSizeClasses = 9;
+    static constexpr size_t maxBuffersPerSizeClass = 16;
+
+  private:
+    struct CacheEntry {
+        std::shared_ptr<VPUBufferObject> bo;
+        bool completed = true;
+    };
+
+    static size_t getSizeClass(size_t size);
+
+    std::array<std::vector<CacheEntry>, numSizeClasses> sizeClasses;
+    std::mutex cacheMutex;
+};
+
+class FillPatternCacheFactory {
+  public:
+    FillPatternCacheFactory() = default;
+
+    /**
+     * Return buffer object of patternBufferSize bytes filled with repeated 32-bit pattern. Buffers
+     * are cached by pattern and the least recently used one is dropped when cache is full.
+     */
+    std::shared_ptr<VPUBufferObject> acquire(VPUDeviceContext *ctx, uint32_t pattern);
+    void prune();
+    size_t getCount();
+
+    static constexpr size_t patternBufferSize = 4 * 1024;
+    static constexpr size_t maxPatterns = 8;
+
+  private:
+    // Ordered from the least to the most recently used pattern
+    std::vector<std::pair<uint32_t, std::shared_ptr<VPUBufferObject>>> patternBuffers;
+    std::mutex patternMutex;
+};
+
+class SlabAllocatorFactory {
+  public:
+    SlabAllocatorFactory();
+
+    /**
+     * Return buffer object carved out of a larger slab buffer object with the same location and
+     * type. Slabs are split into slots of power of two size classes, the slot is returned to its
+     * slab when the buffer object is destroyed. Returns nullptr if the request can't be served
+     * from slab, i.e. it is above the largest size class or the type is not mappable.
+     */
+    std::shared_ptr<VPUBufferObject> acquire(VPUDeviceContext *ctx,
+                                             size_t size,
+                                             VPUBufferObject::Type type,
+                                             VPUBufferObject::Location location);
+    void prune();
+    size_t getSlabCount();
+
+    static constexpr size_t minSizeClass = 4 * 1024;
+    static constexpr size_t numSizeClasses = 5;
+    static constexpr size_t maxAllocSize = minSizeClass << (numSizeClasses - 1);
+    static constexpr size_t slabSize = 256 * 1024;
+
+  private:
+    struct Slab {
+        std::shared_ptr<VPUBufferObject> bo;
+        size_t slotSize = 0;
+        size_t numSlots = 0;
+        size_t nextUnusedSlot = 0;
+        std::vector<size_t> freeSlots;
+
+        bool isEmpty() const { return nextUnusedSlot == freeSlots.size(); }
+        bool isFull() const { return nextUnusedSlot == numSlots && freeSlots.empty(); }
+    };
+
+    using SlabKey = std::tuple<VPUBufferObject::Location, VPUBufferObject::Type, size_t>;
+
+    // State is shared with sub-allocated buffers that can outlive the factory
+    struct State {
+        std::mutex mutex;
+        std::map<SlabKey, std::vector<std::unique_ptr<Slab>>> slabs;
+
+        void release(const SlabKey &key, Slab *slab, size_t slot);
+    };
+
+    std::shared_ptr<State> state;
+};
+
 class VPUDeviceContext {
   public:
     VPUDeviceContext(std::unique_ptr<VPUDriverApi> drvApi, VPUHwInfo *info);
@@ -71,7 +179,6 @@ class VPUDeviceContext {
         auto bo = createBufferObject(size, type, loc);
         if (bo == nullptr)
             return nullptr;
-        MemoryStatistics::get().snapshot();
         return bo->getBasePointer();
     }
 
@@ -87,6 +194,11 @@ class VPUDeviceContext {
      */
     bool freeMemAlloc(void *ptr);
 
+    /**
+     * Return tracked buffer object that contains ptr. Lookups are served without locking from a
+     * sorted snapshot of tracked buffers that is cached per thread. The snapshot is rebuilt on
+     * first lookup after a buffer is added or removed.
+     */
     std::shared_ptr<VPUBufferObject> findBufferObject(const void *ptr) const;
 
     /**
@@ -104,6 +216,12 @@ class VPUDeviceContext {
      */
     VPUDriverApi &getDriverApi() const { return *drvApi; }
     const VPUHwInfo &getDeviceCapabilities() const { return *hwInfo; }
+
+    /**
+     * Return service that observes job completion for queues with completion notification
+     */
+    VPUCompletionService &getCompletionService() { return completionService; }
+
     /**
      * Return value of VPU Device ID
      */
@@ -164,10 +282,15 @@ class VPUDeviceContext {
     }
 
     /**
-     * Return inference ID from kernel driver that is unique for VPU
+     * Return inference ID that is unique for VPU. IDs are served from a block reserved with
+     * single DRM_IVPU_PARAM_UNIQUE_INFERENCE_ID request, see reserveInferenceIdBlock()
      */
     bool getUniqueInferenceId(uint64_t &inferenceId);
 
+    /* Block IDs are tagged with the highest bit to never overlap with plain kernel IDs */
+    static constexpr uint64_t inferenceIdBlockTag = 1ULL << 63;
+    static constexpr uint32_t inferenceIdBlockShift = 16;
+
     bool
     getCopyCommandDescriptor(uint64_t srcAddr, uint64_t dstAddr, size_t size, VPUDescriptor &desc);
     void printCopyDescriptor(void *desc, vpu_cmd_header_t *cmd);
@@ -192,6 +315,37 @@ class VPUDeviceContext {
     void preemptionCachePrune() { preemptionCache.prune(); }
     void preemptionCacheLoad() { preemptionCache.load(); }
 
+    // Command buffer cache management
+    std::shared_ptr<VPUBufferObject> commandBufferCacheAcquire(size_t size) {
+        return commandBufferCache.acquire(this, size);
+    }
+    void commandBufferCacheRelease(const std::shared_ptr<VPUBufferObject> &bo, bool completed) {
+        commandBufferCache.release(bo, completed);
+    }
+    void commandBufferCachePrune() { commandBufferCache.prune(); }
+    /* Return number of idle buffers kept in command buffer cache, they are counted as buffers */
+    size_t getCommandBufferCacheCount() { return commandBufferCache.getIdleCount(); }
+
+    // Fill pattern cache management
+    std::shared_ptr<VPUBufferObject> fillPatternCacheAcquire(uint32_t pattern) {
+        return fillPatternCache.acquire(this, pattern);
+    }
+    void fillPatternCachePrune() { fillPatternCache.prune(); }
+    /* Return number of pattern buffers kept in fill pattern cache, they are counted as buffers */
+    size_t getFillPatternCacheCount() { return fillPatternCache.getCount(); }
+
+    // Slab allocator management
+    void slabAllocatorPrune() { slabAllocator.prune(); }
+    size_t getSlabCount() { return slabAllocator.getSlabCount(); }
+
+    /**
+     * Create internal buffer object that is not tracked by context. Small buffers are
+     * sub-allocated from slabs, so the handle is shared with other buffers and can't be used to
+     * wait for job completion.
+     */
+    std::shared_ptr<VPUBufferObject> createUntrackedSubAllocation(size_t size,
+                                                                  VPUBufferObject::Type range);
+
     bool isPreemptionBufferSupported() const {
         return hwInfo->fwPreemptBufSize > 0 && hwInfo->cmdQueueCreationCapability;
     }
@@ -215,6 +369,22 @@ class VPUDeviceContext {
                                                         VPUBufferObject::Location location);
     std::shared_ptr<VPUBufferObject>
     createBufferObjectFromUserPtr(void *userPtr, size_t size, bool readOnly);
+    bool reserveInferenceIdBlock();
+
+    struct BufferSnapshot {
+        struct Range {
+            const uint8_t *begin;
+            const uint8_t *end;
+            std::weak_ptr<VPUBufferObject> bo;
+        };
+
+        uint64_t generation;
+        std::vector<Range> ranges;
+    };
+
+    const BufferSnapshot &getBufferSnapshot() const;
+    std::shared_ptr<VPUBufferObject> findTrackedBufferObject(const void *ptr) const;
+    void invalidateBufferSnapshot();
 
     std::unique_ptr<VPUDriverApi> drvApi;
     VPUHwInfo *hwInfo;
@@ -224,8 +394,21 @@ class VPUDeviceContext {
     std::vector<std::weak_ptr<VPUBufferObject>> untrackedBuffers;
     mutable std::mutex mtx;
 
+    // Generation is unique across contexts, it identifies the snapshot cached by a thread
+    std::atomic<uint64_t> bufferSnapshotGeneration;
+    mutable std::shared_ptr<const BufferSnapshot> bufferSnapshot;
+
+    std::mutex inferenceIdMutex;
+    uint64_t inferenceIdNext = 0;
+    uint64_t inferenceIdEnd = 0;
+
     ScratchCacheFactory scratchCache;
     PreemptionCacheFactory preemptionCache;
+    CommandBufferCacheFactory commandBufferCache;
+    FillPatternCacheFactory fillPatternCache;
+    SlabAllocatorFactory slabAllocator;
+    // Destroyed first to stop the worker thread before the caches and driver api
+    VPUCompletionService completionService;
 };
 
 } // namespace VPU
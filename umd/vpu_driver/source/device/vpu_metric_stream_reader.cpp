@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include "vpu_driver/source/device/vpu_metric_stream_reader.hpp"
+
+#include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <errno.h>
+#include <string.h>
+#include <uapi/drm/ivpu_accel.h>
+
+namespace VPU {
+
+static std::chrono::nanoseconds getNominalPollInterval(std::chrono::nanoseconds samplingPeriod,
+                                                       size_t kernelReadPeriodReports) {
+    // Drain the kernel buffer about four times per its read period
+    return samplingPeriod * std::max<size_t>(kernelReadPeriodReports / 4, 1);
+}
+
+VPUMetricStreamReader::VPUMetricStreamReader(const VPUDriverApi &drvApi, const Config &config)
+    : drvApi(drvApi)
+    , config(config)
+    , minPollInterval(config.samplingPeriod)
+    , maxPollInterval(
+          2 * getNominalPollInterval(config.samplingPeriod, config.kernelReadPeriodReports))
+    , ring(std::max<size_t>(config.capacityReports, 2) * config.reportSize)
+    , pollInterval(getNominalPollInterval(config.samplingPeriod, config.kernelReadPeriodReports)) {
+    LOG(METRIC,
+        "Metric stream reader for group mask %#lx, ring size %lu, report size %lu",
+        config.groupMask,
+        ring.size(),
+        config.reportSize);
+}
+
+VPUMetricStreamReader::~VPUMetricStreamReader() {
+    stop();
+}
+
+void VPUMetricStreamReader::start() {
+    const std::lock_guard<std::mutex> lock(mutex);
+    if (!thread.joinable() && !stopping)
+        thread = std::thread(&VPUMetricStreamReader::run, this);
+}
+
+void VPUMetricStreamReader::stop() {
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    readerCv.notify_all();
+    dataCv.notify_all();
+    if (thread.joinable())
+        thread.join();
+}
+
+bool VPUMetricStreamReader::getData(uint8_t *dst, size_t size, size_t &dataSize) {
+    drm_ivpu_metric_streamer_get_data data = {};
+    data.metric_group_mask = config.groupMask;
+    data.buffer_ptr = reinterpret_cast<uint64_t>(dst);
+    data.buffer_size = size;
+    if (drvApi.metricStreamerGetData(&data) < 0) {
+        LOG_E("Failed to get metric streamer data, errno: %d", errno);
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            failed = true;
+        }
+        dataCv.notify_all();
+        return false;
+    }
+
+    dataSize = data.data_size;
+    return true;
+}
+
+int64_t VPUMetricStreamReader::drain() {
+    if (ring.empty())
+        return 0;
+
+    int64_t total = 0;
+    while (true) {
+        // Pending size is queried only if the ring is full, to overwrite no more than needed.
+        // Consumers only release the data, so the ring can not become full in the meantime.
+        size_t pending = 0;
+        bool full = false;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            full = used == ring.size();
+        }
+        if (full) {
+            if (!getData(nullptr, 0, pending))
+                return -1;
+            if (pending == 0)
+                break;
+        }
+
+        uint8_t *dst = nullptr;
+        size_t chunk = 0;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            size_t capacity = ring.size();
+            size_t tail = (head + used) % capacity;
+            chunk = std::min(capacity - tail, capacity - used);
+            if (chunk == 0) {
+                size_t reports = (pending + config.reportSize - 1) / config.reportSize;
+                chunk = std::min(capacity - head, reports * config.reportSize);
+                head = (head + chunk) % capacity;
+                used -= chunk;
+                stats.overflowCount++;
+                stats.droppedReports += chunk / config.reportSize;
+            }
+            dst = ring.data() + tail;
+        }
+
+        // Kernel copies the data straight to the free part of ring, which is not accessed by
+        // the consumers
+        size_t written = 0;
+        if (!getData(dst, chunk, written))
+            return -1;
+
+        written = std::min(written, chunk);
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            used += written;
+            stats.drainCount++;
+        }
+        if (written > 0)
+            dataCv.notify_all();
+
+        total += static_cast<int64_t>(written);
+        if (written < chunk)
+            break;
+    }
+    return total;
+}
+
+size_t VPUMetricStreamReader::read(uint8_t *dst, size_t size) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    size_t bytes = std::min(used, size) / config.reportSize * config.reportSize;
+    size_t firstPart = std::min(bytes, ring.size() - head);
+    memcpy(dst, ring.data() + head, firstPart);
+    memcpy(dst + firstPart, ring.data(), bytes - firstPart);
+
+    head = (head + bytes) % ring.size();
+    used -= bytes;
+    return bytes;
+}
+
+bool VPUMetricStreamReader::waitForData(size_t size, int64_t timeoutAbsNs) {
+    auto deadline = std::chrono::steady_clock::time_point(std::chrono::nanoseconds(timeoutAbsNs));
+    size = std::min(size, ring.size());
+
+    std::unique_lock<std::mutex> lock(mutex);
+    dataCv.wait_until(lock, deadline, [&] { return used >= size || stopping || failed; });
+    return used >= size;
+}
+
+size_t VPUMetricStreamReader::getAvailableSize() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return used / config.reportSize * config.reportSize;
+}
+
+bool VPUMetricStreamReader::hasFailed() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return failed;
+}
+
+VPUMetricStreamReader::Stats VPUMetricStreamReader::getStats() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+std::chrono::nanoseconds VPUMetricStreamReader::getPollInterval() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return pollInterval;
+}
+
+void VPUMetricStreamReader::adjustPollInterval(size_t drainedBytes) {
+    size_t drainedReports = drainedBytes / config.reportSize;
+    size_t targetReports = std::max<size_t>(config.kernelReadPeriodReports / 4, 1);
+
+    if (drainedReports == 0)
+        pollInterval = std::min(pollInterval * 2, maxPollInterval);
+    else if (drainedReports > targetReports)
+        pollInterval = std::max(pollInterval / 2, minPollInterval);
+}
+
+void VPUMetricStreamReader::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        lock.unlock();
+        int64_t drained = drain();
+        lock.lock();
+
+        if (drained < 0)
+            break;
+
+        adjustPollInterval(static_cast<size_t>(drained));
+        readerCv.wait_for(lock, pollInterval, [this] { return stopping; });
+    }
+}
+
+} // namespace VPU
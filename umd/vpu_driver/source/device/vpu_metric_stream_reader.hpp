@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace VPU {
+class VPUDriverApi;
+
+/**
+ * Host side buffering of metric streamer reports. A reader thread drains the kernel metric buffer
+ * with DRM_IOCTL_IVPU_METRIC_STREAMER_GET_DATA directly into a ring of whole reports, so the
+ * consumers read and wait for the data without issuing ioctls. The polling interval adapts to the
+ * amount of data returned by every drain. If the consumer does not keep up, the oldest unread
+ * reports are overwritten and accounted as dropped.
+ */
+class VPUMetricStreamReader {
+  public:
+    struct Config {
+        uint64_t groupMask = 0;
+        size_t reportSize = 0;
+        /* Number of reports held by the host ring */
+        size_t capacityReports = 0;
+        std::chrono::nanoseconds samplingPeriod{0};
+        /* Number of reports after which kernel expects the buffer to be read */
+        size_t kernelReadPeriodReports = 0;
+    };
+
+    struct Stats {
+        uint64_t drainCount = 0;
+        uint64_t overflowCount = 0;
+        uint64_t droppedReports = 0;
+    };
+
+    VPUMetricStreamReader(const VPUDriverApi &drvApi, const Config &config);
+    ~VPUMetricStreamReader();
+
+    VPUMetricStreamReader(const VPUMetricStreamReader &) = delete;
+    VPUMetricStreamReader &operator=(const VPUMetricStreamReader &) = delete;
+
+    /* Start the reader thread */
+    void start();
+    /* Stop the reader thread and wake up all waiters, buffered reports can still be read */
+    void stop();
+
+    /**
+     * Drain the kernel buffer into the ring. Called by the reader thread, can be used directly
+     * when the thread is not started.
+     * @return number of bytes drained, -1 on ioctl failure
+     */
+    int64_t drain();
+
+    /**
+     * Copy the oldest whole reports that fit into size bytes to dst and release them from ring.
+     * @return number of bytes copied
+     */
+    size_t read(uint8_t *dst, size_t size);
+
+    /**
+     * Wait until at least size bytes are buffered, the reader stops or absolute timeout expires.
+     * @return true if requested size is available
+     */
+    bool waitForData(size_t size, int64_t timeoutAbsNs);
+
+    size_t getAvailableSize() const;
+    size_t getCapacity() const { return ring.size(); }
+    size_t getReportSize() const { return config.reportSize; }
+    bool hasFailed() const;
+    Stats getStats() const;
+    std::chrono::nanoseconds getPollInterval() const;
+
+  private:
+    void run();
+    bool getData(uint8_t *dst, size_t size, size_t &dataSize);
+    void adjustPollInterval(size_t drainedBytes);
+
+    const VPUDriverApi &drvApi;
+    const Config config;
+    const std::chrono::nanoseconds minPollInterval;
+    const std::chrono::nanoseconds maxPollInterval;
+
+    std::vector<uint8_t> ring;
+
+    mutable std::mutex mutex;
+    std::condition_variable readerCv;
+    std::condition_variable dataCv;
+    size_t head = 0;
+    size_t used = 0;
+    bool stopping = false;
+    bool failed = false;
+    Stats stats = {};
+    std::chrono::nanoseconds pollInterval;
+    std::thread thread;
+};
+
+} // namespace VPU
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include "vpu_driver/source/device/vpu_wait_policy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace VPU {
+
+VPUWaitPolicy::VPUWaitPolicy(const Config &config, Clock clock)
+    : config(config)
+    , clock(std::move(clock)) {}
+
+size_t VPUWaitPolicy::toBucket(std::chrono::nanoseconds duration) {
+    double us = std::chrono::duration<double, std::micro>(duration).count();
+    if (us < 1.0)
+        return 0;
+
+    auto bucket = static_cast<size_t>(std::log2(us) * bucketsPerOctave);
+    return std::min(bucket, bucketCount - 1);
+}
+
+std::chrono::nanoseconds VPUWaitPolicy::toBucketUpperBound(size_t bucket) {
+    double us = std::exp2(static_cast<double>(bucket + 1) / bucketsPerOctave);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double, std::micro>(us));
+}
+
+void VPUWaitPolicy::recordCompletion(std::chrono::steady_clock::time_point submitTime) {
+    auto duration = std::max(clock() - submitTime, std::chrono::steady_clock::duration::zero());
+    size_t bucket = toBucket(duration);
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    for (auto &weight : histogram)
+        weight *= 1.0 - sampleWeight;
+    histogram[bucket] += sampleWeight;
+    totalWeight = totalWeight * (1.0 - sampleWeight) + sampleWeight;
+    if (sampleCount < warmupSamples)
+        sampleCount++;
+}
+
+std::chrono::nanoseconds VPUWaitPolicy::getExpectedDurationLocked() const {
+    if (sampleCount < warmupSamples)
+        return std::chrono::nanoseconds::zero();
+
+    double target = totalWeight * std::clamp(config.percentile, 1u, 100u) / 100.0;
+    double cumulative = 0;
+    for (size_t i = 0; i < bucketCount; i++) {
+        cumulative += histogram[i];
+        if (cumulative >= target)
+            return toBucketUpperBound(i);
+    }
+    return toBucketUpperBound(bucketCount - 1);
+}
+
+std::chrono::nanoseconds VPUWaitPolicy::getExpectedDuration() const {
+    const std::lock_guard<std::mutex> lock(mutex);
+    return getExpectedDurationLocked();
+}
+
+VPUWaitPolicy::SpinWindow
+VPUWaitPolicy::getSpinWindow(std::chrono::steady_clock::time_point submitTime) const {
+    if (config.spinBudget <= std::chrono::nanoseconds::zero())
+        return {};
+
+    std::chrono::nanoseconds expected;
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (sampleCount < warmupSamples)
+            return {std::chrono::nanoseconds::zero(), config.spinBudget};
+        expected = getExpectedDurationLocked();
+    }
+
+    // Job that overran the expected duration is in the tail, spinning for it only burns CPU
+    auto remaining = expected - std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    clock() - submitTime);
+    if (remaining <= std::chrono::nanoseconds::zero())
+        return {};
+
+    // Block until the job is expected to finish within the spin budget, then spin until then
+    auto duration = std::min(remaining, config.spinBudget);
+    return {remaining - duration, duration};
+}
+
+} // namespace VPU
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <chrono> // IWYU pragma: keep
+#include <functional>
+#include <mutex>
+
+namespace VPU {
+
+/**
+ * Per queue policy deciding how long a host waiter busy waits for a job before blocking in kernel.
+ * The policy keeps exponentially weighted histogram of job durations observed on the queue and
+ * spins only when the job is expected to finish within the spin budget. The expected duration is
+ * the configured percentile of the histogram.
+ */
+class VPUWaitPolicy {
+  public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    struct Config {
+        /* Maximum time a waiter spins for a single job */
+        std::chrono::nanoseconds spinBudget{15'000'000};
+        /* Percentile of observed durations used as expected job duration, 1 - 100 */
+        uint32_t percentile = 90;
+    };
+
+    /**
+     * Part of the wait spent in busy wait. Waiter blocks for `delay` first, then spins for
+     * `duration`. Zero duration means the waiter should block for the whole wait.
+     */
+    struct SpinWindow {
+        std::chrono::nanoseconds delay{0};
+        std::chrono::nanoseconds duration{0};
+    };
+
+    explicit VPUWaitPolicy(const Config &config, Clock clock = std::chrono::steady_clock::now);
+
+    std::chrono::steady_clock::time_point now() const { return clock(); }
+
+    /**
+     * Return spin window for a job submitted at submitTime
+     */
+    SpinWindow getSpinWindow(std::chrono::steady_clock::time_point submitTime) const;
+
+    /**
+     * Record that job submitted at submitTime was observed finished now
+     */
+    void recordCompletion(std::chrono::steady_clock::time_point submitTime);
+
+    /**
+     * Return expected job duration, zero until enough samples are recorded
+     */
+    std::chrono::nanoseconds getExpectedDuration() const;
+
+    const Config &getConfig() const { return config; }
+
+    /* Durations are bucketed geometrically with bucketsPerOctave buckets per power of two of
+     * microseconds, the last bucket collects everything above ~16s */
+    static constexpr size_t bucketsPerOctave = 4;
+    static constexpr size_t bucketCount = 24 * bucketsPerOctave;
+    /* Weight of the newest sample, older samples decay by (1 - sampleWeight) on every record */
+    static constexpr double sampleWeight = 1.0 / 16;
+    /* Number of samples before the histogram is trusted, until then the waiter spins for budget */
+    static constexpr uint32_t warmupSamples = 8;
+
+    static size_t toBucket(std::chrono::nanoseconds duration);
+    static std::chrono::nanoseconds toBucketUpperBound(size_t bucket);
+
+  private:
+    std::chrono::nanoseconds getExpectedDurationLocked() const;
+
+    const Config config;
+    const Clock clock;
+
+    mutable std::mutex mutex;
+    std::array<double, bucketCount> histogram = {};
+    double totalWeight = 0;
+    uint32_t sampleCount = 0;
+};
+
+} // namespace VPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,7 @@
 #include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 #include "vpu_driver/source/utilities/stats.hpp"
+#include "vpu_driver/source/utilities/trace_perfetto.hpp"
 
 #include <algorithm>
 #include <atomic>
@@ -21,6 +22,27 @@
 
 namespace VPU {
 
+// Counted in create() and destructor of owning buffer object, sub-allocations are skipped
+static TraceCounter *getAllocationCounter(VPUBufferObject::Location location) {
+    static TraceCounter internal("Allocated internal memory");
+    static TraceCounter host("Allocated host memory");
+    static TraceCounter device("Allocated device memory");
+    static TraceCounter shared("Allocated shared memory");
+
+    switch (location) {
+    case VPUBufferObject::Location::Internal:
+        return &internal;
+    case VPUBufferObject::Location::Host:
+        return &host;
+    case VPUBufferObject::Location::Device:
+        return &device;
+    case VPUBufferObject::Location::Shared:
+        return &shared;
+    default:
+        return nullptr;
+    }
+}
+
 VPUBufferObject::VPUBufferObject(const VPUDriverApi &drvApi,
                                  Location location,
                                  Type type,
@@ -40,6 +62,10 @@ VPUBufferObject::VPUBufferObject(const VPUDriverApi &drvApi,
 }
 
 VPUBufferObject::~VPUBufferObject() {
+    // Memory and handle are owned by parent buffer object
+    if (subAllocation)
+        return;
+
     if (location != Location::UserPtr && basePtr != nullptr &&
         drvApi.unmap(basePtr, allocSize) != 0) {
         LOG_E("Failed to unmap handle %d", handle);
@@ -56,11 +82,19 @@ VPUBufferObject::~VPUBufferObject() {
         MemoryStatistics::get().dec(location, ALIGN(allocSize, pageSize));
     }
 
+    if (auto *counter = getAllocationCounter(location))
+        counter->add(-static_cast<int64_t>(allocSize));
+
     if (drvApi.closeBuffer(handle) != 0) {
         LOG_E("Failed to close handle %d", handle);
     }
 }
 
+int64_t VPUBufferObject::getAllocatedMemory(Location location) {
+    auto *counter = getAllocationCounter(location);
+    return counter != nullptr ? counter->get() : 0;
+}
+
 std::shared_ptr<VPUBufferObject>
 VPUBufferObject::create(const VPUDriverApi &drvApi, Location type, Type range, size_t size) {
     uint32_t handle = 0;
@@ -92,6 +126,9 @@ VPUBufferObject::create(const VPUDriverApi &drvApi, Location type, Type range, s
         MemoryStatistics::get().inc(type, ALIGN(size, pageSize));
     }
 
+    if (auto *counter = getAllocationCounter(type))
+        counter->add(static_cast<int64_t>(size));
+
     return std::make_shared<VPUBufferObject>(drvApi,
                                              type,
                                              range,
@@ -172,6 +209,36 @@ std::shared_ptr<VPUBufferObject> VPUBufferObject::createFromUserPtr(const VPUDri
                                              args.vpu_addr);
 }
 
+std::shared_ptr<VPUBufferObject>
+VPUBufferObject::createSubAllocation(const VPUBufferObject &parent,
+                                     Location location,
+                                     size_t offset,
+                                     size_t size,
+                                     std::function<void()> onDestroy) {
+    if (parent.basePtr == nullptr || offset + size > parent.allocSize) {
+        LOG_E("Sub-allocation out of parent buffer range");
+        return nullptr;
+    }
+
+    auto deleter = [onDestroy = std::move(onDestroy)](VPUBufferObject *bo) mutable {
+        delete bo;
+        onDestroy();
+        // Deleter is kept until weak references are gone, release captured state now
+        onDestroy = nullptr;
+    };
+
+    auto bo = std::shared_ptr<VPUBufferObject>(new VPUBufferObject(parent.drvApi,
+                                                                   location,
+                                                                   parent.type,
+                                                                   parent.basePtr + offset,
+                                                                   size,
+                                                                   parent.handle,
+                                                                   parent.vpuAddr + offset),
+                                               std::move(deleter));
+    bo->subAllocation = true;
+    return bo;
+}
+
 bool VPUBufferObject::copyToBuffer(const void *data, size_t size, size_t offset) {
     if (basePtr == nullptr) {
         LOG_E("Base pointer is null");
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <functional>
 #include <memory>
 #include <uapi/drm/ivpu_accel.h>
 
@@ -61,6 +62,26 @@ class VPUBufferObject {
     static std::shared_ptr<VPUBufferObject>
     createFromUserPtr(const VPUDriverApi &drvApi, uint8_t *userPtr, size_t size, bool readOnly);
 
+    /**
+     * @brief Return bytes of buffer objects created by create() in location, the value reported
+     * by "Allocated <type> memory" trace counter. Sub-allocations are not counted, the slab buffer
+     * object they are carved out of is counted once with its full size.
+     */
+    static int64_t getAllocatedMemory(Location location);
+
+    /**
+     * @brief Create buffer object that covers range [offset, offset + size) of parent buffer.
+     * Sub-allocation shares the handle with parent and does not own the memory. Parent has to
+     * outlive the sub-allocation, onDestroy is called after sub-allocation is destroyed.
+     * DRM_IOCTL_IVPU_BO_WAIT on the shared handle waits for all jobs that use the parent, so
+     * sub-allocations are never used to wait for a job.
+     */
+    static std::shared_ptr<VPUBufferObject> createSubAllocation(const VPUBufferObject &parent,
+                                                                Location location,
+                                                                size_t offset,
+                                                                size_t size,
+                                                                std::function<void()> onDestroy);
+
     VPUBufferObject(const VPUDriverApi &drvApi,
                     Location memoryType,
                     Type range,
@@ -166,6 +187,7 @@ class VPUBufferObject {
      */
     bool exportToFd(int32_t &fd);
     uint64_t getId() const { return id; }
+    bool isSubAllocation() const { return subAllocation; }
 
     static VPUBufferObject::Type convertDmaToShaveRange(VPUBufferObject::Type type) {
         auto t = static_cast<int>(type);
@@ -192,6 +214,7 @@ class VPUBufferObject {
     uint64_t vpuAddr;
     uint32_t handle;
     uint64_t id;
+    bool subAllocation = false;
 };
 
 } // namespace VPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include <filesystem>
 #include <functional>
 #include <memory>
@@ -24,6 +26,8 @@ class OsFile {
     virtual bool write(const void *in, size_t size) = 0;
     virtual void *mmap() = 0;
     virtual size_t size() = 0;
+    // Last modification time in nanoseconds, as seen when the file was opened
+    virtual int64_t mtime() = 0;
 };
 
 class OsInterface {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -156,6 +156,7 @@ class OsFileImp : public OsFile {
         }
 
         fileSize = safe_cast<size_t>(fstatInfo.st_size);
+        fileMtime = fstatInfo.st_mtim.tv_sec * 1'000'000'000LL + fstatInfo.st_mtim.tv_nsec;
         LOG(FSYS, "OsFileImp::ctor - path: %s, fd: %i, fileSize: %lu", path.c_str(), fd, fileSize);
     }
 
@@ -238,12 +239,14 @@ class OsFileImp : public OsFile {
     }
 
     size_t size() override { return fileSize; }
+    int64_t mtime() override { return fileMtime; }
 
   private:
     bool writeAccess;
     int fd;
     void *mmapPtr = MAP_FAILED;
     size_t fileSize = 0;
+    int64_t fileMtime = 0;
 };
 
 std::unique_ptr<OsFile> OsInterfaceImp::osiOpenWithExclusiveLock(const std::filesystem::path &path,
@@ -0,0 +1,493 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include "vpu_driver/source/utilities/async_log.hpp"
+
+#include "vpu_driver/source/utilities/async_log_ring.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <algorithm>
+#include <chrono> // IWYU pragma: keep
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VPU {
+
+static uint64_t getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+AsyncLogRing::AsyncLogRing(size_t capacity, uint32_t threadId)
+    : threadId(threadId) {
+    size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+
+    mask = size - 1;
+    records = std::make_unique<AsyncLogRecord[]>(size);
+}
+
+AsyncLogRecord *AsyncLogRing::reserve() {
+    uint64_t pos = head.load(std::memory_order_relaxed);
+    if (pos - tail.load(std::memory_order_acquire) > mask) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return &records[pos & mask];
+}
+
+void AsyncLogRing::commit() {
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+bool AsyncLogRing::pop(AsyncLogRecord &record) {
+    uint64_t pos = tail.load(std::memory_order_relaxed);
+    if (pos == head.load(std::memory_order_acquire))
+        return false;
+
+    record = records[pos & mask];
+    tail.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+namespace {
+
+constexpr char binaryMagic[8] = {'N', 'P', 'U', 'L', 'O', 'G', '\0', '\0'};
+constexpr uint32_t preformattedId = UINT32_MAX;
+
+enum class BinaryEntry : uint8_t {
+    String = 0,
+    Message = 1,
+    Dropped = 2,
+};
+
+template <typename T>
+void appendFormatted(std::string &out, const char *spec, T value) {
+    char buffer[256];
+    int len = snprintf(buffer, sizeof(buffer), spec, value);
+    if (len < 0)
+        return;
+
+    if (static_cast<size_t>(len) < sizeof(buffer)) {
+        out.append(buffer, static_cast<size_t>(len));
+        return;
+    }
+
+    size_t pos = out.size();
+    out.resize(pos + static_cast<size_t>(len) + 1);
+    snprintf(out.data() + pos, static_cast<size_t>(len) + 1, spec, value);
+    out.resize(pos + static_cast<size_t>(len));
+}
+
+void appendArg(std::string &out, const std::string &spec, const AsyncLogRecord &record, size_t i) {
+    char conversion = spec.back();
+    uint64_t value = record.args[i];
+
+    if (conversion == 's') {
+        if (record.argTypes[i] == AsyncLogArgType::String)
+            appendFormatted(out, spec.c_str(), record.strings + record.stringOffsets[i]);
+        else
+            out += "(invalid)";
+        return;
+    }
+
+    switch (record.argTypes[i]) {
+    case AsyncLogArgType::Int32:
+        appendFormatted(out, spec.c_str(), static_cast<int>(value));
+        break;
+    case AsyncLogArgType::UInt32:
+        appendFormatted(out, spec.c_str(), static_cast<unsigned int>(value));
+        break;
+    case AsyncLogArgType::Int64:
+        appendFormatted(out, spec.c_str(), static_cast<long>(value));
+        break;
+    case AsyncLogArgType::UInt64:
+        appendFormatted(out, spec.c_str(), static_cast<unsigned long>(value));
+        break;
+    case AsyncLogArgType::Double: {
+        double d;
+        memcpy(&d, &value, sizeof(d));
+        appendFormatted(out, spec.c_str(), d);
+        break;
+    }
+    case AsyncLogArgType::Pointer:
+    case AsyncLogArgType::String:
+        appendFormatted(out, spec.c_str(), reinterpret_cast<const void *>(value));
+        break;
+    }
+}
+
+/* Format the message using printf conversion specification per argument */
+void formatMessage(std::string &out, const AsyncLogRecord &record) {
+    if (record.preformatted) {
+        out += record.getPreformatted();
+        return;
+    }
+
+    size_t argIndex = 0;
+    const char *p = record.fmt;
+    while (*p != '\0') {
+        if (*p != '%') {
+            out += *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            out += '%';
+            p += 2;
+            continue;
+        }
+
+        std::string spec = "%";
+        const char *s = p + 1;
+        while (*s != '\0' && strchr("diouxXeEfFgGaAcspn", *s) == nullptr) {
+            if (*s == '*') {
+                int width = argIndex < record.argCount ? static_cast<int>(record.args[argIndex])
+                                                       : 0;
+                argIndex++;
+                spec += std::to_string(width);
+            } else {
+                spec += *s;
+            }
+            s++;
+        }
+        if (*s == '\0') {
+            out += p;
+            break;
+        }
+
+        spec += *s;
+        p = s + 1;
+        if (*s == 'n')
+            continue;
+        if (argIndex >= record.argCount) {
+            out += spec;
+            continue;
+        }
+        appendArg(out, spec, record, argIndex++);
+    }
+}
+
+class BinaryWriter {
+  public:
+    explicit BinaryWriter(std::string &out)
+        : out(out) {}
+
+    template <typename T>
+    void put(T value) {
+        out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void putString(const char *str, size_t len) {
+        put(static_cast<uint32_t>(len));
+        out.append(str, len);
+    }
+
+  private:
+    std::string &out;
+};
+
+class AsyncLogWriter {
+  public:
+    static AsyncLogWriter &get() {
+        static AsyncLogWriter writer;
+        return writer;
+    }
+
+    ~AsyncLogWriter() { AsyncLog::disable(); }
+
+    void start(FILE *file, AsyncLog::Format fmt, bool owned, size_t capacity) {
+        out = file;
+        ownsOut = owned;
+        format = fmt;
+        stringIds.clear();
+        {
+            const std::lock_guard<std::mutex> lock(ringsMutex);
+            ringCapacity = capacity;
+        }
+
+        if (format == AsyncLog::Format::Binary) {
+            std::string header;
+            BinaryWriter writer(header);
+            header.append(binaryMagic, sizeof(binaryMagic));
+            writer.put(AsyncLog::binaryVersion);
+            writer.put(uint32_t{0});
+            fwrite(header.data(), 1, header.size(), out);
+        }
+
+        stopWriter = false;
+        thread = std::thread(&AsyncLogWriter::writerLoop, this);
+    }
+
+    void stop() {
+        {
+            const std::lock_guard<std::mutex> lock(writerMutex);
+            stopWriter = true;
+        }
+        writerCv.notify_one();
+        thread.join();
+
+        if (ownsOut)
+            fclose(out);
+        out = nullptr;
+    }
+
+    std::shared_ptr<AsyncLogRing> createRing() {
+        thread_local uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+        const std::lock_guard<std::mutex> lock(ringsMutex);
+        auto ring = std::make_shared<AsyncLogRing>(ringCapacity, tid);
+        rings.push_back(ring);
+        return ring;
+    }
+
+  private:
+    void writerLoop() {
+        std::unique_lock<std::mutex> lock(writerMutex);
+        bool stop = false;
+        while (!stop) {
+            // Drain once more after stop is requested, so no message is left in the rings
+            stop = writerCv.wait_for(lock, drainPeriod, [this] { return stopWriter; });
+            drain();
+        }
+    }
+
+    void drain() {
+        std::vector<std::shared_ptr<AsyncLogRing>> snapshot;
+        {
+            const std::lock_guard<std::mutex> lock(ringsMutex);
+            snapshot = rings;
+        }
+
+        pending.clear();
+        std::string text;
+        for (auto &ring : snapshot) {
+            bool closed = ring->isClosed();
+            AsyncLogRecord record;
+            while (ring->pop(record))
+                pending.emplace_back(ring->getThreadId(), record);
+
+            uint64_t dropped = ring->takeDropped();
+            if (dropped > 0)
+                writeDropped(text, ring->getThreadId(), dropped);
+
+            // Closed ring does not get new messages, release it after the last drain
+            if (closed) {
+                const std::lock_guard<std::mutex> lock(ringsMutex);
+                rings.erase(std::remove(rings.begin(), rings.end(), ring), rings.end());
+            }
+        }
+
+        std::stable_sort(pending.begin(), pending.end(), [](const auto &a, const auto &b) {
+            return a.second.timestampNs < b.second.timestampNs;
+        });
+        for (const auto &[threadId, record] : pending) {
+            writeMessage(text, threadId, record);
+            delete[] record.message;
+        }
+
+        if (!text.empty()) {
+            fwrite(text.data(), 1, text.size(), out);
+            fflush(out);
+        }
+    }
+
+    void writeMessage(std::string &text, uint32_t threadId, const AsyncLogRecord &record) {
+        if (format == AsyncLog::Format::Text) {
+            auto level = static_cast<LogLevel>(record.level);
+            text += "NPU_LOG: ";
+            if (level > WARNING) {
+                text += '[';
+                text += getLogMaskStr(record.mask);
+                text += ']';
+            } else {
+                text += '*';
+                text += getLogLevelStr(level);
+                text += "* ";
+            }
+            text += '[';
+            text += record.file;
+            text += ':';
+            text += std::to_string(record.line);
+            text += "] ";
+            formatMessage(text, record);
+            text += '\n';
+            return;
+        }
+
+        uint32_t fileId = getStringId(text, record.file);
+        uint32_t fmtId = record.preformatted ? preformattedId : getStringId(text, record.fmt);
+        BinaryWriter writer(text);
+        writer.put(BinaryEntry::Message);
+        writer.put(record.timestampNs);
+        writer.put(threadId);
+        writer.put(record.level);
+        writer.put(record.mask);
+        writer.put(fileId);
+        writer.put(record.line);
+        writer.put(fmtId);
+        if (record.preformatted) {
+            writer.put(uint8_t{1});
+            writer.put(AsyncLogArgType::String);
+            const char *message = record.getPreformatted();
+            writer.putString(message, strlen(message));
+            return;
+        }
+
+        writer.put(record.argCount);
+        for (size_t i = 0; i < record.argCount; i++) {
+            writer.put(record.argTypes[i]);
+            if (record.argTypes[i] == AsyncLogArgType::String) {
+                const char *str = record.strings + record.stringOffsets[i];
+                writer.putString(str, strlen(str));
+            } else {
+                writer.put(record.args[i]);
+            }
+        }
+    }
+
+    void writeDropped(std::string &text, uint32_t threadId, uint64_t count) {
+        if (format == AsyncLog::Format::Text) {
+            text += "NPU_LOG: *WARNING* [async_log] Dropped " + std::to_string(count) +
+                    " messages of thread " + std::to_string(threadId) + "\n";
+            return;
+        }
+
+        BinaryWriter writer(text);
+        writer.put(BinaryEntry::Dropped);
+        writer.put(threadId);
+        writer.put(count);
+    }
+
+    uint32_t getStringId(std::string &text, const char *str) {
+        auto it = stringIds.find(str);
+        if (it != stringIds.end())
+            return it->second;
+
+        auto id = static_cast<uint32_t>(stringIds.size());
+        stringIds.emplace(str, id);
+
+        BinaryWriter writer(text);
+        writer.put(BinaryEntry::String);
+        writer.put(id);
+        writer.putString(str, strlen(str));
+        return id;
+    }
+
+    static constexpr std::chrono::milliseconds drainPeriod{10};
+
+    FILE *out = nullptr;
+    bool ownsOut = false;
+    AsyncLog::Format format = AsyncLog::Format::Text;
+    std::unordered_map<const char *, uint32_t> stringIds;
+    std::vector<std::pair<uint32_t, AsyncLogRecord>> pending;
+
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<AsyncLogRing>> rings;
+    size_t ringCapacity = AsyncLog::defaultRingCapacity;
+
+    std::thread thread;
+    std::mutex writerMutex;
+    std::condition_variable writerCv;
+    bool stopWriter = false;
+};
+
+/* Ring of the calling thread, closed on thread exit */
+struct ThreadRing {
+    ~ThreadRing() {
+        if (ring)
+            ring->close();
+    }
+
+    std::shared_ptr<AsyncLogRing> ring;
+};
+
+thread_local ThreadRing threadRing;
+
+} // namespace
+
+char getAsyncLogConversion(const char *fmt, size_t argIndex) {
+    size_t index = 0;
+    const char *p = fmt;
+    while ((p = strchr(p, '%')) != nullptr) {
+        if (p[1] == '%') {
+            p += 2;
+            continue;
+        }
+
+        const char *s = p + 1;
+        while (*s != '\0' && strchr("diouxXeEfFgGaAcspn", *s) == nullptr) {
+            // Width or precision given by argument takes argument slot
+            if (*s == '*' && index++ == argIndex)
+                return '*';
+            s++;
+        }
+        if (*s == '\0')
+            return '\0';
+        if (index++ == argIndex)
+            return *s;
+        p = s + 1;
+    }
+    return '\0';
+}
+
+bool AsyncLog::enable(FILE *out, Format format, size_t ringCapacity) {
+    if (out == nullptr || isEnabled())
+        return false;
+
+    AsyncLogWriter::get().start(out, format, false, ringCapacity);
+    enabled.store(true, std::memory_order_release);
+    return true;
+}
+
+bool AsyncLog::enable(std::string_view path, Format format) {
+    if (path.empty() || isEnabled())
+        return false;
+
+    std::string fileName(path);
+    FILE *out = fopen(fileName.c_str(), format == Format::Binary ? "wb" : "w");
+    if (out == nullptr) {
+        LOG_E("Failed to open %s for writing", fileName.c_str());
+        return false;
+    }
+
+    AsyncLogWriter::get().start(out, format, true, defaultRingCapacity);
+    enabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void AsyncLog::disable() {
+    if (!enabled.exchange(false))
+        return;
+
+    AsyncLogWriter::get().stop();
+}
+
+AsyncLogRecord *AsyncLog::reserve() {
+    if (!threadRing.ring)
+        threadRing.ring = AsyncLogWriter::get().createRing();
+
+    AsyncLogRecord *record = threadRing.ring->reserve();
+    if (record != nullptr)
+        record->timestampNs = getTimestampNs();
+    return record;
+}
+
+void AsyncLog::commit() {
+    threadRing.ring->commit();
+}
+
+} // namespace VPU
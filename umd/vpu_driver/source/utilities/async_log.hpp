@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+
+namespace VPU {
+
+enum class AsyncLogArgType : uint8_t {
+    Int32 = 0,
+    UInt32 = 1,
+    Int64 = 2,
+    UInt64 = 3,
+    Double = 4,
+    Pointer = 5,
+    String = 6,
+};
+
+/**
+ * Log message captured on the logging thread. Arguments are stored raw and formatted by the writer
+ * thread. Format string and file name must be string literals, arguments of %s are copied. Message
+ * which arguments do not fit the record is formatted on the logging thread.
+ */
+struct AsyncLogRecord {
+    static constexpr size_t maxArgs = 8;
+    static constexpr size_t stringStorageSize = 128;
+
+    uint64_t timestampNs;
+    const char *fmt;
+    const char *file;
+    uint64_t mask;
+    uint32_t line;
+    uint8_t level;
+    uint8_t argCount;
+    uint8_t stringsUsed;
+    /* Message did not fit the record, it is formatted on logging thread to strings or message */
+    bool preformatted;
+    AsyncLogArgType argTypes[maxArgs];
+    /* Offset of string argument copy in strings */
+    uint8_t stringOffsets[maxArgs];
+    uint64_t args[maxArgs];
+    char strings[stringStorageSize];
+    /* Preformatted message longer than strings, released by the writer thread */
+    char *message;
+
+    const char *getPreformatted() const { return message != nullptr ? message : strings; }
+};
+
+/**
+ * Asynchronous logging backend. When enabled, LOG macros capture the message into ring of the
+ * calling thread and the writer thread formats it in the background. This header holds only what
+ * LOG macros need to capture a message, the rings are declared in async_log_ring.hpp. Messages are
+ * written in timestamp order within each drain period.
+ *
+ * Binary format starts with 8 bytes magic "NPULOG\0\0" followed by uint32_t version and
+ * uint32_t reserved. Then entries follow, each starting with uint8_t kind:
+ *  - String (0): uint32_t id, uint32_t length, characters. Emitted before the first message
+ *    that refers to the format string or file name.
+ *  - Message (1): uint64_t timestampNs, uint32_t threadId, uint8_t level, uint64_t mask,
+ *    uint32_t fileId, uint32_t line, uint32_t fmtId, uint8_t argCount, then for each argument
+ *    uint8_t AsyncLogArgType and uint64_t value or, for String, uint32_t length and characters.
+ *    Message preformatted on logging thread has fmtId 0xffffffff and single String argument.
+ *  - Dropped (2): uint32_t threadId, uint64_t count.
+ */
+class AsyncLog final {
+  public:
+    enum class Format { Text, Binary };
+
+    static constexpr size_t defaultRingCapacity = 256;
+    static constexpr uint32_t binaryVersion = 1;
+
+    /* Write messages to out, out is not closed by disable */
+    static bool enable(FILE *out, Format format, size_t ringCapacity = defaultRingCapacity);
+    /* Write messages to file created at path */
+    static bool enable(std::string_view path, Format format);
+    /* Stop the writer thread and flush remaining messages */
+    static void disable();
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    /* Return slot in ring of the calling thread or nullptr when message is dropped */
+    static AsyncLogRecord *reserve();
+    static void commit();
+
+  private:
+    static inline std::atomic<bool> enabled = false;
+};
+
+/* Return conversion character of argument at argIndex, '\0' if fmt has no such argument */
+char getAsyncLogConversion(const char *fmt, size_t argIndex);
+
+template <typename T>
+inline bool encodeAsyncLogArg(AsyncLogRecord &record, const char *fmt, T value) {
+    auto &type = record.argTypes[record.argCount];
+    auto &slot = record.args[record.argCount];
+
+    if constexpr (std::is_same_v<T, char *> || std::is_same_v<T, const char *>) {
+        // Only string printed by %s is read, other conversions use the pointer value
+        if (getAsyncLogConversion(fmt, record.argCount) != 's') {
+            type = AsyncLogArgType::Pointer;
+            slot = reinterpret_cast<uintptr_t>(value);
+            record.argCount++;
+            return true;
+        }
+
+        // String that does not fit the record is not truncated, the message is preformatted
+        size_t available = AsyncLogRecord::stringStorageSize - record.stringsUsed;
+        const char *str = value == nullptr ? "(null)" : value;
+        size_t len = strnlen(str, available);
+        if (len == available)
+            return false;
+
+        memcpy(record.strings + record.stringsUsed, str, len);
+        record.strings[record.stringsUsed + len] = '\0';
+
+        type = AsyncLogArgType::String;
+        slot = reinterpret_cast<uintptr_t>(value);
+        record.stringOffsets[record.argCount] = record.stringsUsed;
+        record.stringsUsed += static_cast<uint8_t>(len + 1);
+    } else if constexpr (std::is_null_pointer_v<T>) {
+        type = AsyncLogArgType::Pointer;
+        slot = 0;
+    } else if constexpr (std::is_pointer_v<T>) {
+        type = AsyncLogArgType::Pointer;
+        slot = reinterpret_cast<uintptr_t>(static_cast<const volatile void *>(value));
+    } else if constexpr (std::is_enum_v<T>) {
+        return encodeAsyncLogArg(record, fmt, static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        if constexpr (sizeof(T) > sizeof(double)) {
+            return false;
+        } else {
+            double d = value;
+            type = AsyncLogArgType::Double;
+            memcpy(&slot, &d, sizeof(d));
+        }
+    } else if constexpr (std::is_integral_v<T>) {
+        if constexpr (sizeof(T) <= sizeof(int32_t)) {
+            type = std::is_signed_v<T> ? AsyncLogArgType::Int32 : AsyncLogArgType::UInt32;
+        } else {
+            type = std::is_signed_v<T> ? AsyncLogArgType::Int64 : AsyncLogArgType::UInt64;
+        }
+        slot = static_cast<uint64_t>(value);
+    } else {
+        return false;
+    }
+
+    record.argCount++;
+    return true;
+}
+
+/* Format the message on logging thread, message longer than strings is allocated */
+template <typename... Args>
+inline void formatAsyncLogMessage(AsyncLogRecord &record, const char *fmt, Args... args) {
+    record.preformatted = true;
+    int len = snprintf(record.strings, sizeof(record.strings), fmt, args...);
+    if (len < static_cast<int>(sizeof(record.strings)))
+        return;
+
+    record.message = new (std::nothrow) char[static_cast<size_t>(len) + 1];
+    if (record.message == nullptr) {
+        // Keep the message visibly truncated rather than dropping it
+        memcpy(record.strings + sizeof(record.strings) - 4, "...", 4);
+        return;
+    }
+    snprintf(record.message, static_cast<size_t>(len) + 1, fmt, args...);
+}
+
+template <typename... Args>
+inline void
+asyncLog(int level, uint64_t mask, const char *file, int line, const char *fmt, Args... args) {
+    AsyncLogRecord *record = AsyncLog::reserve();
+    if (record == nullptr)
+        return;
+
+    record->fmt = fmt;
+    record->file = file;
+    record->mask = mask;
+    record->line = static_cast<uint32_t>(line);
+    record->level = static_cast<uint8_t>(level);
+    record->argCount = 0;
+    record->stringsUsed = 0;
+    record->preformatted = false;
+    record->message = nullptr;
+
+    if constexpr (sizeof...(Args) > 0) {
+        bool encoded = sizeof...(Args) <= AsyncLogRecord::maxArgs &&
+                       (encodeAsyncLogArg(*record, fmt, args) && ...);
+        if (!encoded)
+            formatAsyncLogMessage(*record, fmt, args...);
+    }
+
+    AsyncLog::commit();
+}
+
+} // namespace VPU
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vpu_driver/source/utilities/async_log.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace VPU {
+
+/**
+ * Ring of log records with single producer, the owning thread, and single consumer, the writer
+ * thread. Producer never blocks, message is dropped and counted when the ring is full.
+ */
+class AsyncLogRing final {
+  public:
+    /* capacity is rounded up to power of two */
+    AsyncLogRing(size_t capacity, uint32_t threadId);
+
+    /* Return slot for next record or nullptr if the ring is full */
+    AsyncLogRecord *reserve();
+    /* Publish record returned by reserve */
+    void commit();
+
+    bool pop(AsyncLogRecord &record);
+    /* Return number of dropped messages since the last call */
+    uint64_t takeDropped() { return dropped.exchange(0, std::memory_order_relaxed); }
+    size_t getCapacity() const { return mask + 1; }
+    uint32_t getThreadId() const { return threadId; }
+
+    /* Owning thread exited, ring can be released once drained */
+    void close() { closed.store(true, std::memory_order_release); }
+    bool isClosed() const { return closed.load(std::memory_order_acquire); }
+
+  private:
+    size_t mask;
+    uint32_t threadId;
+    std::unique_ptr<AsyncLogRecord[]> records;
+    alignas(64) std::atomic<uint64_t> head = 0;
+    alignas(64) std::atomic<uint64_t> tail = 0;
+    std::atomic<uint64_t> dropped = 0;
+    std::atomic<bool> closed = false;
+};
+
+} // namespace VPU
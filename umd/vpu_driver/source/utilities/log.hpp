@@ -9,6 +9,8 @@
 
 #include <cstdint>
 
+#include "vpu_driver/source/utilities/async_log.hpp"
+
 #include <cstdio>
 #include <cstring>
 #include <string_view>
@@ -61,6 +63,16 @@ enum LogMask : uint64_t {
         if ((LEVEL > WARNING) && !(MASK & VPU::getLogMask())) \
             break;                                            \
                                                               \
+        if (VPU::AsyncLog::isEnabled()) {                     \
+            VPU::asyncLog(LEVEL,                              \
+                          MASK,                               \
+                          __FNAME__,                          \
+                          __LINE__,                           \
+                          fmt,                                \
+                          ##__VA_ARGS__);                     \
+            break;                                            \
+        }                                                     \
+                                                              \
         if (LEVEL > WARNING)                                  \
             fprintf(stderr,                                   \
                     "NPU_LOG: [%s][%s:%d] " fmt "\n",         \
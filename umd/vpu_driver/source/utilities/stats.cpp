@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,18 +16,99 @@
 
 #include <chrono> // IWYU pragma: keep
 #include <filesystem>
-#include <string>
+#include <functional>
+#include <string.h>
 #include <sys/resource.h>
+#include <sys/syscall.h>
 #include <sys/sysinfo.h>
 #include <system_error>
+#include <unistd.h>
+
+static size_t getThreadStripe() {
+    thread_local size_t stripe =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % MemoryCounters::stripeCount;
+    return stripe;
+}
+
+static uint32_t getThreadId() {
+    thread_local uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+    return tid;
+}
+
+static uint64_t getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+void MemoryCounters::add(MemoryStatsCategory category, int64_t delta) {
+    stripes[getThreadStripe()]
+        .values[static_cast<size_t>(category)]
+        .fetch_add(delta, std::memory_order_relaxed);
+}
+
+int64_t MemoryCounters::get(MemoryStatsCategory category) const {
+    int64_t sum = 0;
+    for (const auto &stripe : stripes)
+        sum += stripe.values[static_cast<size_t>(category)].load(std::memory_order_relaxed);
+    return sum;
+}
+
+MemoryEventRing::MemoryEventRing(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+
+    mask = size - 1;
+    cells = std::make_unique<Cell[]>(size);
+    for (size_t i = 0; i < size; i++)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+bool MemoryEventRing::push(const MemoryStatsRecord &record) {
+    uint64_t pos = head.load(std::memory_order_relaxed);
+    while (true) {
+        Cell &cell = cells[pos & mask];
+        uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int64_t>(sequence - pos);
+        if (diff == 0) {
+            if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.record = record;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // Cell still holds an event that was not consumed, the ring is full
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool MemoryEventRing::pop(MemoryStatsRecord &record) {
+    Cell &cell = cells[tail & mask];
+    if (cell.sequence.load(std::memory_order_acquire) != tail + 1)
+        return false;
+
+    record = cell.record;
+    cell.sequence.store(tail + mask + 1, std::memory_order_release);
+    tail++;
+    return true;
+}
 
 MemoryStatistics &MemoryStatistics::get() {
     static MemoryStatistics m;
     return m;
 }
 
+MemoryStatistics::~MemoryStatistics() {
+    disable();
+}
+
 void MemoryStatistics::enable(std::string_view statsPath) {
-    if (statsPath.empty()) {
+    if (statsPath.empty() || isEnabled()) {
         return;
     }
 
@@ -43,110 +124,157 @@ void MemoryStatistics::enable(std::string_view statsPath) {
         }
     }
 
-    statOut.open(statsFilePath, std::ios_base::out | std::ios_base::trunc);
-    if (!statOut.is_open()) {
+    statOut = fopen(statsFilePath.c_str(), "wb");
+    if (statOut == nullptr) {
         LOG_E("Failed to open %s for writing", statsFilePath.c_str());
         return;
     }
 
-    enabled = true;
-    statOut << "#Timestamp, "
-            << "SysUsedRam, "
-            << "SysUsedShared, "
-            << "SysUsedSwap, "
-            << "SysUsedHigh, "
-            << "DrvUsedDevice, "
-            << "DrvUsedHost, "
-            << "DrvUsedShared, "
-            << "DrvUsedInternal, "
-            << "RSS[Kb], "
-            << "UserTime[sec.usec], "
-            << "SysTime[sec.usec]" << std::endl;
-    snapshot();
-    return;
-}
+    MemoryStatsHeader header = {};
+    memcpy(header.magic, memoryStatsMagic, sizeof(header.magic));
+    header.version = memoryStatsVersion;
+    header.recordSize = sizeof(MemoryStatsRecord);
+    header.startTimestampNs = getTimestampNs();
+    if (fwrite(&header, sizeof(header), 1, statOut) != 1) {
+        LOG_E("Failed to write header to %s", statsFilePath.c_str());
+        fclose(statOut);
+        statOut = nullptr;
+        return;
+    }
+
+    std::call_once(ringOnce, [this] { ring = std::make_unique<MemoryEventRing>(ringCapacity); });
+    // Events pushed after the last drain of previous session are not written to the new file
+    MemoryStatsRecord stale = {};
+    while (ring->pop(stale)) {
+    }
+    ring->takeDropped();
 
-bool MemoryStatistics::isEnabled() {
-    return enabled;
+    stopWriter = false;
+    writer = std::thread(&MemoryStatistics::writerLoop, this);
+    enabled.store(true, std::memory_order_release);
 }
 
-void MemoryStatistics::inc(VPU::VPUBufferObject::Location loc, size_t size) {
-    if (!enabled)
+void MemoryStatistics::disable() {
+    if (!enabled.exchange(false))
         return;
 
-    std::lock_guard<std::mutex> lock(mtx);
+    {
+        const std::lock_guard<std::mutex> lock(writerMutex);
+        stopWriter = true;
+    }
+    writerCv.notify_one();
+    writer.join();
+
+    fclose(statOut);
+    statOut = nullptr;
+}
+
+static MemoryStatsCategory toCategory(VPU::VPUBufferObject::Location loc) {
     switch (loc) {
     case VPU::VPUBufferObject::Location::Internal:
-        internalAllocSize += size;
-        break;
+        return MemoryStatsCategory::Internal;
     case VPU::VPUBufferObject::Location::Host:
     case VPU::VPUBufferObject::Location::ExternalHost:
-        hostAllocSize += size;
-        break;
+        return MemoryStatsCategory::Host;
     case VPU::VPUBufferObject::Location::Device:
     case VPU::VPUBufferObject::Location::ExternalDevice:
-        deviceAllocSize += size;
-        break;
+        return MemoryStatsCategory::Device;
     case VPU::VPUBufferObject::Location::Shared:
     case VPU::VPUBufferObject::Location::ExternalShared:
-        sharedAllocSize += size;
-        break;
+        return MemoryStatsCategory::Shared;
     default:
-        break;
+        return MemoryStatsCategory::Count;
     }
 }
 
-void MemoryStatistics::dec(VPU::VPUBufferObject::Location loc, size_t size) {
-    if (!enabled)
+void MemoryStatistics::record(MemoryStatsEvent event,
+                              VPU::VPUBufferObject::Location loc,
+                              size_t size) {
+    if (!isEnabled())
         return;
 
-    std::lock_guard<std::mutex> lock(mtx);
-    switch (loc) {
-    case VPU::VPUBufferObject::Location::Internal:
-        internalAllocSize -= size;
-        break;
-    case VPU::VPUBufferObject::Location::Host:
-    case VPU::VPUBufferObject::Location::ExternalHost:
-        hostAllocSize -= size;
-        break;
-    case VPU::VPUBufferObject::Location::Device:
-    case VPU::VPUBufferObject::Location::ExternalDevice:
-        deviceAllocSize -= size;
-        break;
-    case VPU::VPUBufferObject::Location::Shared:
-    case VPU::VPUBufferObject::Location::ExternalShared:
-        sharedAllocSize -= size;
-        break;
-    default:
-        break;
+    auto category = toCategory(loc);
+    if (category == MemoryStatsCategory::Count)
+        return;
+
+    auto delta = static_cast<int64_t>(size);
+    counters.add(category, event == MemoryStatsEvent::Alloc ? delta : -delta);
+
+    MemoryStatsRecord record = {};
+    record.timestampNs = getTimestampNs();
+    record.value = size;
+    record.threadId = getThreadId();
+    record.event = event;
+    record.category = category;
+    ring->push(record);
+}
+
+void MemoryStatistics::inc(VPU::VPUBufferObject::Location loc, size_t size) {
+    record(MemoryStatsEvent::Alloc, loc, size);
+}
+
+void MemoryStatistics::dec(VPU::VPUBufferObject::Location loc, size_t size) {
+    record(MemoryStatsEvent::Free, loc, size);
+}
+
+void MemoryStatistics::writerLoop() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    bool stop = false;
+    while (!stop) {
+        // Drain once more after stop is requested, so no event is left in the ring
+        stop = writerCv.wait_for(lock, drainPeriod, [this] { return stopWriter; });
+        drain();
+        sampleSystem();
     }
+    fflush(statOut);
 }
 
-void MemoryStatistics::snapshot() {
-    if (!enabled)
-        return;
+void MemoryStatistics::drain() {
+    MemoryStatsRecord record = {};
+    while (ring->pop(record)) {
+        if (fwrite(&record, sizeof(record), 1, statOut) != 1) {
+            LOG_W("Failed to write memory statistics record");
+            return;
+        }
+    }
+
+    uint64_t dropped = ring->takeDropped();
+    if (dropped > 0)
+        write(MemoryStatsEvent::Dropped, dropped);
+}
+
+void MemoryStatistics::sampleSystem() {
     struct sysinfo sysStats = {};
     struct rusage procStats = {};
-
-    auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
-                         std::chrono::steady_clock::now().time_since_epoch())
-                         .count();
     if (sysinfo(&sysStats) != 0 || getrusage(RUSAGE_SELF, &procStats) != 0) {
         LOG_W("Can not get statistic information from system");
         return;
     }
 
-    std::lock_guard<std::mutex> lock(mtx);
-    statOut << static_cast<float>(timestamp) / 1000000.f << ", ";
-    statOut << ((sysStats.totalram - sysStats.freeram) * sysStats.mem_unit) << ", ";
-    statOut << (sysStats.sharedram * sysStats.mem_unit) << ", ";
-    statOut << ((sysStats.totalswap - sysStats.freeswap) * sysStats.mem_unit) << ", ";
-    statOut << ((sysStats.totalhigh - sysStats.freehigh) * sysStats.mem_unit) << ", ";
-    statOut << (deviceAllocSize) << ", ";
-    statOut << (hostAllocSize) << ", ";
-    statOut << (sharedAllocSize) << ", ";
-    statOut << (internalAllocSize) << ", ";
-    statOut << procStats.ru_maxrss << ", ";
-    statOut << procStats.ru_utime.tv_sec << "." << procStats.ru_utime.tv_usec << ", ";
-    statOut << procStats.ru_stime.tv_sec << "." << procStats.ru_stime.tv_usec << std::endl;
+    auto toMicroseconds = [](const struct timeval &time) {
+        return static_cast<uint64_t>(time.tv_sec) * 1000000 + static_cast<uint64_t>(time.tv_usec);
+    };
+
+    write(MemoryStatsEvent::SystemUsedRam,
+          static_cast<uint64_t>(sysStats.totalram - sysStats.freeram) * sysStats.mem_unit);
+    write(MemoryStatsEvent::SystemSharedRam,
+          static_cast<uint64_t>(sysStats.sharedram) * sysStats.mem_unit);
+    write(MemoryStatsEvent::SystemUsedSwap,
+          static_cast<uint64_t>(sysStats.totalswap - sysStats.freeswap) * sysStats.mem_unit);
+    write(MemoryStatsEvent::SystemUsedHigh,
+          static_cast<uint64_t>(sysStats.totalhigh - sysStats.freehigh) * sysStats.mem_unit);
+    write(MemoryStatsEvent::ProcessMaxRss, static_cast<uint64_t>(procStats.ru_maxrss) * 1024);
+    write(MemoryStatsEvent::ProcessUserTime, toMicroseconds(procStats.ru_utime));
+    write(MemoryStatsEvent::ProcessSystemTime, toMicroseconds(procStats.ru_stime));
+}
+
+void MemoryStatistics::write(MemoryStatsEvent event, uint64_t value) {
+    MemoryStatsRecord record = {};
+    record.timestampNs = getTimestampNs();
+    record.value = value;
+    record.threadId = getThreadId();
+    record.event = event;
+    record.category = MemoryStatsCategory::Count;
+    if (fwrite(&record, sizeof(record), 1, statOut) != 1)
+        LOG_W("Failed to write memory statistics record");
 }
@@ -1,39 +1,114 @@
 /*
- * Copyright (C) 2024 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+// IWYU pragma: no_include <bits/chrono.h>
+
 #pragma once
 
 #include <cstddef>
 #include <cstdint>
 
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/utilities/stats_record.hpp"
 
-#include <fstream>
+#include <array>
+#include <atomic>
+#include <chrono> // IWYU pragma: keep
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
 #include <mutex>
 #include <string_view>
+#include <thread>
+
+/**
+ * Allocated size per category. Counters are striped by thread, so concurrent updates do not
+ * contend on a single cache line. Value of a category is the sum of all stripes.
+ */
+class MemoryCounters final {
+  public:
+    void add(MemoryStatsCategory category, int64_t delta);
+    int64_t get(MemoryStatsCategory category) const;
+
+    static constexpr size_t stripeCount = 64;
+
+  private:
+    struct alignas(64) Stripe {
+        std::array<std::atomic<int64_t>, static_cast<size_t>(MemoryStatsCategory::Count)> values =
+            {};
+    };
+
+    std::array<Stripe, stripeCount> stripes = {};
+};
+
+/**
+ * Bounded lock-free ring of memory events with multiple producers and single consumer. Producer
+ * never blocks, event is dropped and counted when the ring is full.
+ */
+class MemoryEventRing final {
+  public:
+    /* capacity is rounded up to power of two */
+    explicit MemoryEventRing(size_t capacity);
+
+    bool push(const MemoryStatsRecord &record);
+    /* Must be called from a single consumer thread */
+    bool pop(MemoryStatsRecord &record);
+    /* Return number of dropped events since the last call */
+    uint64_t takeDropped() { return dropped.exchange(0, std::memory_order_relaxed); }
+    size_t getCapacity() const { return mask + 1; }
+
+  private:
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        MemoryStatsRecord record;
+    };
+
+    size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<uint64_t> head = 0;
+    alignas(64) uint64_t tail = 0;
+    std::atomic<uint64_t> dropped = 0;
+};
 
 class MemoryStatistics final {
     MemoryStatistics() = default;
 
   public:
+    ~MemoryStatistics();
+
     static MemoryStatistics &get();
     void enable(std::string_view statsPath);
-    bool isEnabled();
+    bool isEnabled() { return enabled.load(std::memory_order_acquire); }
     void inc(VPU::VPUBufferObject::Location loc, size_t size);
     void dec(VPU::VPUBufferObject::Location loc, size_t size);
-    void snapshot();
+    /* Stop the writer thread and flush remaining events to the file */
+    void disable();
+
+    int64_t getAllocSize(MemoryStatsCategory category) const { return counters.get(category); }
+
+    static constexpr size_t ringCapacity = 64 * 1024;
+    static constexpr std::chrono::milliseconds drainPeriod{100};
 
   private:
-    bool enabled = false;
-    std::ofstream statOut;
-    std::mutex mtx;
-
-    uint64_t internalAllocSize = 0;
-    uint64_t sharedAllocSize = 0;
-    uint64_t deviceAllocSize = 0;
-    uint64_t hostAllocSize = 0;
+    void record(MemoryStatsEvent event, VPU::VPUBufferObject::Location loc, size_t size);
+    void writerLoop();
+    void drain();
+    void sampleSystem();
+    void write(MemoryStatsEvent event, uint64_t value);
+
+    std::atomic<bool> enabled = false;
+    MemoryCounters counters;
+    /* Created by first enable and never replaced, producers can still push after disable */
+    std::unique_ptr<MemoryEventRing> ring;
+    std::once_flag ringOnce;
+
+    FILE *statOut = nullptr;
+    std::thread writer;
+    std::mutex writerMutex;
+    std::condition_variable writerCv;
+    bool stopWriter = false;
 };
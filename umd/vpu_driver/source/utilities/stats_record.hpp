@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/*
+ * Binary format of memory statistics file. The file starts with MemoryStatsHeader followed by
+ * MemoryStatsRecord entries in the order they were drained from the event ring. The header has no
+ * dependencies, so it can be used by the offline decoder in tools/.
+ */
+
+enum class MemoryStatsEvent : uint8_t {
+    /* value - allocated size in bytes */
+    Alloc = 0,
+    /* value - freed size in bytes */
+    Free = 1,
+    /* value - used system RAM in bytes, sampled by writer thread */
+    SystemUsedRam = 2,
+    /* value - maximum resident set size of the process in bytes, sampled by writer thread */
+    ProcessMaxRss = 3,
+    /* value - number of events dropped because the ring was full */
+    Dropped = 4,
+    /* value - shared system RAM in bytes, sampled by writer thread */
+    SystemSharedRam = 5,
+    /* value - used swap in bytes, sampled by writer thread */
+    SystemUsedSwap = 6,
+    /* value - used high memory in bytes, sampled by writer thread */
+    SystemUsedHigh = 7,
+    /* value - user CPU time of the process in microseconds, sampled by writer thread */
+    ProcessUserTime = 8,
+    /* value - system CPU time of the process in microseconds, sampled by writer thread */
+    ProcessSystemTime = 9,
+};
+
+enum class MemoryStatsCategory : uint8_t {
+    Device = 0,
+    Host = 1,
+    Shared = 2,
+    Internal = 3,
+    Count = 4,
+};
+
+struct MemoryStatsHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    /* steady clock timestamp of enabling statistics */
+    uint64_t startTimestampNs;
+};
+
+struct MemoryStatsRecord {
+    /* steady clock timestamp */
+    uint64_t timestampNs;
+    uint64_t value;
+    uint32_t threadId;
+    MemoryStatsEvent event;
+    MemoryStatsCategory category;
+    uint16_t reserved;
+};
+
+static_assert(sizeof(MemoryStatsHeader) == 24, "Unexpected size of MemoryStatsHeader");
+static_assert(sizeof(MemoryStatsRecord) == 24, "Unexpected size of MemoryStatsRecord");
+
+constexpr char memoryStatsMagic[8] = {'N', 'P', 'U', 'M', 'S', 'T', 'A', 'T'};
+constexpr uint32_t memoryStatsVersion = 2;
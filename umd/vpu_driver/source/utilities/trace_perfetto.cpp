@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 
 #include "trace_perfetto.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,7 @@ TracePerfetto::TracePerfetto() {
         track_event_cfg.add_enabled_categories("SYS");
         track_event_cfg.add_enabled_categories("NPU_ELF");
         track_event_cfg.add_enabled_categories("NPU_COMPILER");
+        track_event_cfg.add_enabled_categories("NPU_COUNTERS");
 
         if (!isSystemBackend) {
             perfetto::TraceConfig cfg;
@@ -67,3 +70,18 @@ TracePerfetto::~TracePerfetto() {
     out.write(&trace_data[0], (long)trace_data.size());
     out.close();
 }
+
+TraceCounter::TraceCounter(std::string_view name) {
+    size_t len = std::min(name.size(), sizeof(this->name) - 1);
+    memcpy(this->name, name.data(), len);
+}
+
+void TraceCounter::set(int64_t value) {
+    current.store(value, std::memory_order_relaxed);
+    TRACE_COUNTER("NPU_COUNTERS", perfetto::CounterTrack(perfetto::DynamicString{name}), value);
+}
+
+void TraceCounter::add(int64_t delta) {
+    int64_t value = current.fetch_add(delta, std::memory_order_relaxed) + delta;
+    TRACE_COUNTER("NPU_COUNTERS", perfetto::CounterTrack(perfetto::DynamicString{name}), value);
+}
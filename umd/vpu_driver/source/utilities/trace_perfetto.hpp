@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2024-2025 Intel Corporation
+ * Copyright (C) 2024-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,11 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include <atomic>
+#include <string_view>
+
 #if ENABLE_NPU_PERFETTO_BUILD
 #include <memory>
 #include <perfetto.h>
@@ -15,7 +20,8 @@ PERFETTO_DEFINE_CATEGORIES(
     perfetto::Category("API").SetDescription("Level Zero APIs traces to Intel NPU UMD"),
     perfetto::Category("SYS").SetDescription("Linux system calls used by Intel NPU UMD"),
     perfetto::Category("NPU_ELF").SetDescription("elf::HostParsedInference calls traces"),
-    perfetto::Category("NPU_COMPILER").SetDescription("NPU Compiler API calls traces"));
+    perfetto::Category("NPU_COMPILER").SetDescription("NPU Compiler API calls traces"),
+    perfetto::Category("NPU_COUNTERS").SetDescription("Queue, memory and cache counters"));
 
 class TracePerfetto {
   public:
@@ -32,6 +38,24 @@ class TracePerfetto {
     bool enable = false;
 };
 
+/**
+ * Counter track in NPU_COUNTERS category. The value is kept by the counter, so a counter shared
+ * by multiple objects can be updated with delta. Counter is trivially destructible, so static
+ * counters can be updated by objects destroyed at exit.
+ */
+class TraceCounter {
+  public:
+    explicit TraceCounter(std::string_view name);
+
+    void set(int64_t value);
+    void add(int64_t delta);
+    int64_t get() const { return current.load(std::memory_order_relaxed); }
+
+  private:
+    char name[64] = {};
+    std::atomic<int64_t> current = 0;
+};
+
 #else
 
 #define TRACE_EVENT(...) \
@@ -55,4 +79,17 @@ class TracePerfetto {
     TracePerfetto &operator=(const TracePerfetto &) = delete;
 };
 
+/* Value is kept without trace, so it can be read in both builds */
+class TraceCounter {
+  public:
+    explicit TraceCounter(std::string_view name) {}
+
+    void set(int64_t value) { current.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { current.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t get() const { return current.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<int64_t> current = 0;
+};
+
 #endif
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/utilities/async_log.hpp"
+#include "vpu_driver/source/utilities/async_log_ring.hpp"
+#include "vpu_driver/source/utilities/log.hpp"
+
+#include <cstdio>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace VPU;
+
+static std::string readAll(FILE *file) {
+    std::string content;
+    rewind(file);
+    char buffer[1024];
+    size_t len;
+    while ((len = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        content.append(buffer, len);
+    return content;
+}
+
+TEST(AsyncLogRing, fullRingDropsMessagesUntilDrained) {
+    AsyncLogRing ring(3, 0);
+    ASSERT_EQ(ring.getCapacity(), 4u);
+
+    for (uint32_t i = 0; i < 6; i++) {
+        AsyncLogRecord *record = ring.reserve();
+        if (i >= 4) {
+            EXPECT_EQ(record, nullptr);
+            continue;
+        }
+        ASSERT_NE(record, nullptr);
+        record->line = i;
+        ring.commit();
+    }
+    EXPECT_EQ(ring.takeDropped(), 2u);
+    EXPECT_EQ(ring.takeDropped(), 0u);
+
+    AsyncLogRecord record = {};
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.pop(record));
+        EXPECT_EQ(record.line, i);
+    }
+    EXPECT_FALSE(ring.pop(record));
+    EXPECT_NE(ring.reserve(), nullptr);
+}
+
+TEST(AsyncLog, messagesAreFormattedByWriterThread) {
+    FILE *out = tmpfile();
+    ASSERT_NE(out, nullptr);
+    ASSERT_TRUE(AsyncLog::enable(out, AsyncLog::Format::Text));
+    EXPECT_TRUE(AsyncLog::isEnabled());
+
+    std::string name = "cmdlist";
+    int value = -5;
+    uint64_t address = 0xdead0000;
+    asyncLog(INFO,
+             CMDLIST,
+             "test.cpp",
+             10,
+             "%s: %d, 0x%lx, %.2f, 100%%",
+             name.c_str(),
+             value,
+             address,
+             1.5);
+    // String argument is copied, so the caller can release it right after logging
+    name = "released";
+    asyncLog(ERROR, DRIVER, "test.cpp", 11, "Failed with %#x", 0x10u);
+    // Message with more arguments than the record can hold is formatted on logging thread
+    asyncLog(INFO,
+             CMDQUEUE,
+             "test.cpp",
+             12,
+             "%d %d %d %d %d %d %d %d %d",
+             1,
+             2,
+             3,
+             4,
+             5,
+             6,
+             7,
+             8,
+             9);
+    AsyncLog::disable();
+    EXPECT_FALSE(AsyncLog::isEnabled());
+
+    EXPECT_EQ(readAll(out),
+              "NPU_LOG: [CMDLIST][test.cpp:10] cmdlist: -5, 0xdead0000, 1.50, 100%\n"
+              "NPU_LOG: *ERROR* [test.cpp:11] Failed with 0x10\n"
+              "NPU_LOG: [CMDQUEUE][test.cpp:12] 1 2 3 4 5 6 7 8 9\n");
+    fclose(out);
+}
+
+TEST(AsyncLog, longStringArgumentsAreNotTruncated) {
+    FILE *out = tmpfile();
+    ASSERT_NE(out, nullptr);
+    ASSERT_TRUE(AsyncLog::enable(out, AsyncLog::Format::Text));
+
+    std::string options(3 * AsyncLogRecord::stringStorageSize, 'o');
+    asyncLog(INFO, GRAPH, "test.cpp", 20, "Options: %s", options.c_str());
+    asyncLog(INFO, GRAPH, "test.cpp", 21, "%s %s", options.c_str(), options.c_str());
+    // Pointer printed by %p is not read as a string
+    char buffer[4] = {'a', 'b', 'c', 'd'};
+    char *ptr = buffer;
+    asyncLog(INFO, MEMORY, "test.cpp", 22, "ptr %p", ptr);
+    AsyncLog::disable();
+
+    char ptrStr[32];
+    snprintf(ptrStr, sizeof(ptrStr), "%p", static_cast<void *>(ptr));
+    EXPECT_EQ(readAll(out),
+              "NPU_LOG: [GRAPH][test.cpp:20] Options: " + options + "\n" +
+                  "NPU_LOG: [GRAPH][test.cpp:21] " + options + " " + options + "\n" +
+                  "NPU_LOG: [MEMORY][test.cpp:22] ptr " + ptrStr + "\n");
+    fclose(out);
+}
+
+TEST(AsyncLog, conversionOfArgumentIsFoundInFormat) {
+    EXPECT_EQ(getAsyncLogConversion("%s %p", 0), 's');
+    EXPECT_EQ(getAsyncLogConversion("%s %p", 1), 'p');
+    EXPECT_EQ(getAsyncLogConversion("100%% %-*s", 0), '*');
+    EXPECT_EQ(getAsyncLogConversion("100%% %-*s", 1), 's');
+    EXPECT_EQ(getAsyncLogConversion("%lu", 1), '\0');
+}
+
+TEST(AsyncLog, messagesOfEachThreadKeepOrder) {
+    constexpr uint32_t threadCount = 4;
+    constexpr uint32_t messagesPerThread = 200;
+
+    FILE *out = tmpfile();
+    ASSERT_NE(out, nullptr);
+    ASSERT_TRUE(AsyncLog::enable(out, AsyncLog::Format::Text, messagesPerThread));
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([t] {
+            for (uint32_t i = 0; i < messagesPerThread; i++)
+                asyncLog(INFO, MISC, "test.cpp", 1, "thread %u message %u", t, i);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    AsyncLog::disable();
+
+    std::istringstream lines(readAll(out));
+    fclose(out);
+
+    std::map<uint32_t, uint32_t> expected;
+    std::string line;
+    uint32_t count = 0;
+    while (std::getline(lines, line)) {
+        uint32_t t, i;
+        ASSERT_EQ(sscanf(line.c_str(), "NPU_LOG: [MISC][test.cpp:1] thread %u message %u", &t, &i),
+                  2)
+            << line;
+        EXPECT_EQ(i, expected[t]++);
+        count++;
+    }
+    EXPECT_EQ(count, threadCount * messagesPerThread);
+}
+
+TEST(AsyncLog, binaryFormatStoresFormatStringOnce) {
+    FILE *out = tmpfile();
+    ASSERT_NE(out, nullptr);
+    ASSERT_TRUE(AsyncLog::enable(out, AsyncLog::Format::Binary));
+
+    for (int i = 0; i < 2; i++)
+        asyncLog(INFO, MEMORY, "bin.cpp", 7, "size %d", 4096);
+    AsyncLog::disable();
+
+    std::string content = readAll(out);
+    fclose(out);
+
+    ASSERT_GE(content.size(), 16u);
+    EXPECT_EQ(content.compare(0, 8, std::string("NPULOG\0\0", 8)), 0);
+    uint32_t version;
+    memcpy(&version, content.data() + 8, sizeof(version));
+    EXPECT_EQ(version, AsyncLog::binaryVersion);
+
+    size_t pos = 16;
+    auto takeString = [&]() {
+        uint32_t len;
+        memcpy(&len, content.data() + pos, sizeof(len));
+        pos += sizeof(len);
+        std::string str = content.substr(pos, len);
+        pos += len;
+        return str;
+    };
+
+    std::vector<std::string> strings;
+    uint32_t messages = 0;
+    while (pos < content.size()) {
+        uint8_t kind = static_cast<uint8_t>(content[pos++]);
+        if (kind == 0) {
+            pos += sizeof(uint32_t);
+            strings.push_back(takeString());
+            continue;
+        }
+
+        ASSERT_EQ(kind, 1u);
+        // timestamp, thread id, level, mask, file id, line, format id
+        pos += 8 + 4 + 1 + 8 + 4 + 4 + 4;
+        ASSERT_EQ(content[pos++], 1);
+        EXPECT_EQ(static_cast<AsyncLogArgType>(content[pos++]), AsyncLogArgType::Int32);
+        uint64_t value;
+        memcpy(&value, content.data() + pos, sizeof(value));
+        pos += sizeof(value);
+        EXPECT_EQ(value, 4096u);
+        messages++;
+    }
+
+    EXPECT_EQ(messages, 2u);
+    EXPECT_EQ(strings, (std::vector<std::string>{"bin.cpp", "size %d"}));
+}
+
+TEST(AsyncLog, enableWithPathUsesOnlyCharactersOfView) {
+    std::string path = ::testing::TempDir() + "async_log_test.bin";
+    std::string padded = path + ".unused";
+
+    ASSERT_TRUE(AsyncLog::enable(std::string_view(padded.data(), path.size()),
+                                 AsyncLog::Format::Binary));
+    AsyncLog::disable();
+
+    EXPECT_EQ(remove(path.c_str()), 0);
+    EXPECT_NE(remove(padded.c_str()), 0);
+}
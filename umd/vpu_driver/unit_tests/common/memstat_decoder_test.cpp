@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "gtest/gtest.h"
+#include "memstat_decoder.hpp"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/utilities/stats.hpp"
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::string readAll(FILE *file) {
+    std::string content;
+    rewind(file);
+    char buffer[256];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        content.append(buffer, size);
+    return content;
+}
+
+static std::vector<std::string> splitLines(const std::string &content) {
+    std::vector<std::string> lines;
+    std::istringstream stream(content);
+    std::string line;
+    while (std::getline(stream, line))
+        lines.push_back(line);
+    return lines;
+}
+
+static std::vector<std::string> splitColumns(const std::string &line) {
+    std::vector<std::string> columns;
+    std::istringstream stream(line);
+    std::string column;
+    while (std::getline(stream, column, ','))
+        columns.push_back(column);
+    return columns;
+}
+
+TEST(MemoryStatsDecoder, reportAndTimelineReplayRecordedEvents) {
+    auto path = std::filesystem::temp_directory_path() / "npu_mem_stats_decoder_test.bin";
+    auto &stats = MemoryStatistics::get();
+    stats.enable(path.string());
+    ASSERT_TRUE(stats.isEnabled());
+
+    stats.inc(VPU::VPUBufferObject::Location::Device, 8192);
+    stats.inc(VPU::VPUBufferObject::Location::Host, 4096);
+    stats.dec(VPU::VPUBufferObject::Location::Device, 8192);
+    stats.dec(VPU::VPUBufferObject::Location::Host, 4096);
+    stats.disable();
+
+    FILE *report = tmpfile();
+    FILE *timeline = tmpfile();
+    ASSERT_NE(report, nullptr);
+    ASSERT_NE(timeline, nullptr);
+    ASSERT_EQ(memstat::decodeMemoryStats(path.string(), report, timeline), 0);
+
+    // Peak is reported per category, final size is 0 as everything was freed
+    std::string reportText = readAll(report);
+    EXPECT_NE(reportText.find("Allocations:     2\n"), std::string::npos);
+    EXPECT_NE(reportText.find("Frees:           2\n"), std::string::npos);
+    EXPECT_NE(reportText.find("Dropped events:  0\n"), std::string::npos);
+    std::vector<std::pair<std::string, int64_t>> expectedPeaks = {{"device", 8192},
+                                                                  {"host", 4096},
+                                                                  {"shared", 0},
+                                                                  {"internal", 0},
+                                                                  {"total", 12288}};
+    for (const auto &[category, expectedPeak] : expectedPeaks) {
+        bool found = false;
+        for (const auto &line : splitLines(reportText)) {
+            char name[16] = {};
+            long peak = -1;
+            double at = 0.0;
+            long final = -1;
+            if (sscanf(line.c_str(), "%15s %ld %lf %ld", name, &peak, &at, &final) != 4 ||
+                category != name)
+                continue;
+            found = true;
+            EXPECT_EQ(peak, expectedPeak) << category;
+            EXPECT_EQ(final, 0) << category;
+        }
+        EXPECT_TRUE(found) << category;
+    }
+
+    // Timeline has a row per record, allocations are replayed in order
+    auto lines = splitLines(readAll(timeline));
+    ASSERT_GT(lines.size(), 5u);
+    EXPECT_EQ(lines[0],
+              "time[s],device,host,shared,internal,total,sysUsedRam,sysSharedRam,sysUsedSwap,"
+              "sysUsedHigh,maxRss,userTime[s],sysTime[s]");
+    // Rows of system samples repeat allocated sizes of the previous row
+    std::vector<std::vector<int64_t>> allocated = {{0, 0, 0}};
+    for (size_t i = 1; i < lines.size(); i++) {
+        auto columns = splitColumns(lines[i]);
+        ASSERT_EQ(columns.size(), 13u) << lines[i];
+        std::vector<int64_t> sizes = {std::stoll(columns[1]),
+                                      std::stoll(columns[2]),
+                                      std::stoll(columns[5])};
+        if (allocated.back() != sizes)
+            allocated.push_back(sizes);
+    }
+    std::vector<std::vector<int64_t>> expectedAllocated = {{0, 0, 0},
+                                                           {8192, 0, 8192},
+                                                           {8192, 4096, 12288},
+                                                           {0, 4096, 4096},
+                                                           {0, 0, 0}};
+    EXPECT_EQ(allocated, expectedAllocated);
+
+    // System sample taken on disable is in the last row
+    auto last = splitColumns(lines.back());
+    EXPECT_GT(std::stoull(last[6]), 0u);
+    EXPECT_GT(std::stoull(last[10]), 0u);
+
+    fclose(report);
+    fclose(timeline);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/source/utilities/stats.hpp"
+#include "vpu_driver/source/utilities/stats_record.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+TEST(MemoryCounters, concurrentUpdatesSumToTotal) {
+    MemoryCounters counters;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&counters] {
+            for (int i = 0; i < 1000; i++) {
+                counters.add(MemoryStatsCategory::Device, 4096);
+                counters.add(MemoryStatsCategory::Host, 4096);
+                counters.add(MemoryStatsCategory::Host, -4096);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(counters.get(MemoryStatsCategory::Device), 8 * 1000 * 4096);
+    EXPECT_EQ(counters.get(MemoryStatsCategory::Host), 0);
+    EXPECT_EQ(counters.get(MemoryStatsCategory::Shared), 0);
+
+    // Memory freed by other thread than allocating one is accounted correctly
+    std::thread([&counters] { counters.add(MemoryStatsCategory::Device, -8 * 1000 * 4096); })
+        .join();
+    EXPECT_EQ(counters.get(MemoryStatsCategory::Device), 0);
+}
+
+TEST(MemoryEventRing, fullRingDropsEventsUntilDrained) {
+    MemoryEventRing ring(3);
+    ASSERT_EQ(ring.getCapacity(), 4u);
+
+    MemoryStatsRecord record = {};
+    for (uint64_t i = 0; i < 6; i++) {
+        record.value = i;
+        EXPECT_EQ(ring.push(record), i < 4);
+    }
+    EXPECT_EQ(ring.takeDropped(), 2u);
+    EXPECT_EQ(ring.takeDropped(), 0u);
+
+    for (uint64_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.pop(record));
+        EXPECT_EQ(record.value, i);
+    }
+    EXPECT_FALSE(ring.pop(record));
+
+    record.value = 10;
+    EXPECT_TRUE(ring.push(record));
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ(record.value, 10u);
+}
+
+TEST(MemoryEventRing, concurrentProducersDeliverAllEvents) {
+    constexpr uint32_t producerCount = 4;
+    constexpr uint64_t eventsPerProducer = 10000;
+    MemoryEventRing ring(256);
+
+    std::vector<std::thread> producers;
+    for (uint32_t t = 0; t < producerCount; t++) {
+        producers.emplace_back([&ring, t] {
+            MemoryStatsRecord record = {};
+            record.threadId = t;
+            for (uint64_t i = 0; i < eventsPerProducer; i++) {
+                record.value = i;
+                while (!ring.push(record))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<uint64_t> expected(producerCount, 0);
+    uint64_t received = 0;
+    MemoryStatsRecord record = {};
+    while (received < producerCount * eventsPerProducer) {
+        if (!ring.pop(record))
+            continue;
+        ASSERT_LT(record.threadId, producerCount);
+        // Events of single producer keep their order
+        EXPECT_EQ(record.value, expected[record.threadId]++);
+        received++;
+    }
+
+    for (auto &producer : producers)
+        producer.join();
+    EXPECT_FALSE(ring.pop(record));
+}
+
+TEST(MemoryStatistics, eventsAreWrittenToBinaryFile) {
+    auto path = std::filesystem::temp_directory_path() / "npu_mem_stats_test.bin";
+    auto &stats = MemoryStatistics::get();
+    stats.enable(path.string());
+    ASSERT_TRUE(stats.isEnabled());
+
+    stats.inc(VPU::VPUBufferObject::Location::Device, 8192);
+    stats.inc(VPU::VPUBufferObject::Location::Shared, 4096);
+    stats.dec(VPU::VPUBufferObject::Location::Device, 8192);
+    EXPECT_EQ(stats.getAllocSize(MemoryStatsCategory::Device), 0);
+    EXPECT_EQ(stats.getAllocSize(MemoryStatsCategory::Shared), 4096);
+    stats.dec(VPU::VPUBufferObject::Location::Shared, 4096);
+    stats.disable();
+    EXPECT_FALSE(stats.isEnabled());
+
+    std::ifstream file(path, std::ios::binary);
+    MemoryStatsHeader header = {};
+    ASSERT_TRUE(file.read(reinterpret_cast<char *>(&header), sizeof(header)));
+    EXPECT_EQ(memcmp(header.magic, memoryStatsMagic, sizeof(header.magic)), 0);
+    EXPECT_EQ(header.version, memoryStatsVersion);
+    EXPECT_EQ(header.recordSize, sizeof(MemoryStatsRecord));
+
+    std::vector<MemoryStatsRecord> allocEvents;
+    MemoryStatsRecord record = {};
+    while (file.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+        EXPECT_GE(record.timestampNs, header.startTimestampNs);
+        if (record.event == MemoryStatsEvent::Alloc || record.event == MemoryStatsEvent::Free)
+            allocEvents.push_back(record);
+    }
+    ASSERT_EQ(allocEvents.size(), 4u);
+    EXPECT_EQ(allocEvents[0].event, MemoryStatsEvent::Alloc);
+    EXPECT_EQ(allocEvents[0].category, MemoryStatsCategory::Device);
+    EXPECT_EQ(allocEvents[0].value, 8192u);
+    EXPECT_EQ(allocEvents[2].event, MemoryStatsEvent::Free);
+    EXPECT_EQ(allocEvents[3].category, MemoryStatsCategory::Shared);
+
+    file.close();
+    std::filesystem::remove(path);
+}
+
+TEST(MemoryStatistics, enableAndDisableWhileThreadsRecordEvents) {
+    auto path = std::filesystem::temp_directory_path() / "npu_mem_stats_toggle_test.bin";
+    auto &stats = MemoryStatistics::get();
+
+    std::atomic<bool> stop = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&stats, &stop] {
+            while (!stop.load()) {
+                stats.inc(VPU::VPUBufferObject::Location::Host, 4096);
+                stats.dec(VPU::VPUBufferObject::Location::Host, 4096);
+            }
+        });
+    }
+
+    for (int i = 0; i < 20; i++) {
+        stats.enable(path.string());
+        EXPECT_TRUE(stats.isEnabled());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        stats.disable();
+        EXPECT_FALSE(stats.isEnabled());
+    }
+    stop = true;
+    for (auto &thread : threads)
+        thread.join();
+
+    std::ifstream file(path, std::ios::binary);
+    MemoryStatsHeader header = {};
+    ASSERT_TRUE(file.read(reinterpret_cast<char *>(&header), sizeof(header)));
+    EXPECT_EQ(memcmp(header.magic, memoryStatsMagic, sizeof(header.magic)), 0);
+    MemoryStatsRecord record = {};
+    while (file.read(reinterpret_cast<char *>(&record), sizeof(record)))
+        EXPECT_LE(record.event, MemoryStatsEvent::ProcessSystemTime);
+
+    file.close();
+    std::filesystem::remove(path);
+}
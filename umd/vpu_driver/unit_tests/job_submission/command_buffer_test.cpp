@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,8 +15,11 @@
 #include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
+#include <uapi/drm/ivpu_accel.h>
 #include <vector>
 
 namespace VPU {
@@ -25,7 +28,9 @@ class VPUCommand;
 struct VPUCommandBufferTest : public ::testing::Test {
     void SetUp() override {}
 
-    void TearDown() override { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
+    void TearDown() override {
+        ASSERT_EQ(ctx->getBuffersCount(), ctx->getCommandBufferCacheCount());
+    }
 
     MockOsInterfaceImp osInfc;
     std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
@@ -52,6 +57,34 @@ TEST_F(VPUCommandBufferTest, allocateCommandBufferWithTimestampCommand) {
     EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
 }
 
+struct SubmissionObserverCommand : public VPUTimeStampCommand {
+    using VPUTimeStampCommand::VPUTimeStampCommand;
+
+    void onSubmitted(const std::shared_ptr<VPUSubmissionFence> &fence) override {
+        submittedFence = fence;
+    }
+
+    std::shared_ptr<VPUSubmissionFence> submittedFence;
+};
+
+TEST_F(VPUCommandBufferTest, submissionFenceIsPassedToCommands) {
+    auto tsHeap = ctx->createSharedMemAlloc(sizeof(uint64_t));
+    auto cmd = std::make_shared<SubmissionObserverCommand>(0u, tsHeap->getVPUAddr(), tsHeap);
+
+    std::vector<std::shared_ptr<VPUCommand>> cmds = {cmd};
+    auto cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+
+    auto fence = std::make_shared<VPUSubmissionFence>(cmdBuffer->getBuffer());
+    cmdBuffer->setSubmitted(fence);
+    EXPECT_EQ(cmd->submittedFence, fence);
+    EXPECT_TRUE(cmdBuffer->waitForCompletion(0));
+    EXPECT_TRUE(cmd->submittedFence->isSignaled());
+
+    cmdBuffer.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
+}
+
 TEST_F(VPUCommandBufferTest, allocateCommandBufferWithMallocFailureExpectNullptr) {
     auto tsHeap = ctx->createSharedMemAlloc(sizeof(uint64_t));
 
@@ -83,4 +116,169 @@ TEST_F(VPUCommandBufferTest, allocateCommandBufferWithCopyCommand) {
     EXPECT_TRUE(ctx->freeMemAlloc(srcBo->getBasePointer()));
     EXPECT_TRUE(ctx->freeMemAlloc(dstBo->getBasePointer()));
 }
+
+TEST_F(VPUCommandBufferTest, allocateCommandBufferReusesCachedBufferWithoutIoctls) {
+    auto tsHeap = ctx->createSharedMemAlloc(sizeof(uint64_t));
+
+    std::vector<std::shared_ptr<VPUCommand>> cmds;
+    cmds.emplace_back(
+        VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsHeap->getBasePointer()),
+                                    tsHeap));
+    ASSERT_NE(cmds.back(), nullptr);
+
+    auto cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+    auto vpuAddr = cmdBuffer->getBuffer()->getVPUAddr();
+    cmdBuffer.reset();
+
+    // Steady state allocation should not issue any BO_CREATE, BO_INFO or mmap
+    osInfc.callCntIoctl = 0;
+    osInfc.callCntAlloc = 0;
+    for (int i = 0; i < 100; i++) {
+        cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+        ASSERT_NE(nullptr, cmdBuffer);
+        EXPECT_EQ(vpuAddr, cmdBuffer->getBuffer()->getVPUAddr());
+        cmdBuffer.reset();
+    }
+    EXPECT_EQ(0u, osInfc.callCntIoctl);
+    EXPECT_EQ(0u, osInfc.callCntAlloc);
+
+    // Buffer released after submission without wait requires single non blocking check
+    cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+    cmdBuffer->setSubmitted();
+    cmdBuffer.reset();
+    cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+    EXPECT_EQ(vpuAddr, cmdBuffer->getBuffer()->getVPUAddr());
+    EXPECT_EQ(1u, osInfc.callCntIoctl);
+    EXPECT_EQ(DRM_IOCTL_IVPU_BO_WAIT, osInfc.ioctlLastCommand);
+
+    // Completed job returns buffer without additional check
+    cmdBuffer->setSubmitted();
+    EXPECT_TRUE(cmdBuffer->waitForCompletion(0));
+    cmdBuffer.reset();
+    osInfc.callCntIoctl = 0;
+    cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+    EXPECT_EQ(0u, osInfc.callCntIoctl);
+    cmdBuffer.reset();
+
+    cmds.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
+    ctx->commandBufferCachePrune();
+    EXPECT_EQ(ctx->getAllocatedSize(), 0u);
+}
+
+TEST_F(VPUCommandBufferTest, waitForCompletionUsesCompletionServiceWhenTracked) {
+    auto tsHeap = ctx->createSharedMemAlloc(sizeof(uint64_t));
+
+    std::vector<std::shared_ptr<VPUCommand>> cmds;
+    cmds.emplace_back(
+        VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsHeap->getBasePointer()),
+                                    tsHeap));
+    auto cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+
+    auto &service = ctx->getCompletionService();
+    int eventFd = service.createStream();
+    ASSERT_GE(eventFd, 0);
+
+    // Job status reported to the service thread is returned by waitForCompletion
+    osInfc.mockFailNextJobStatus();
+    cmdBuffer->setSubmitted();
+    cmdBuffer->setCompletion(service.track(eventFd, cmdBuffer->getBuffer()));
+    EXPECT_TRUE(cmdBuffer->waitForCompletion(std::numeric_limits<int64_t>::max()));
+    EXPECT_FALSE(cmdBuffer->isSuccess());
+
+    // Completion is consumed by successful wait, next wait is direct BO wait
+    EXPECT_TRUE(cmdBuffer->waitForCompletion(0));
+    EXPECT_TRUE(cmdBuffer->isSuccess());
+    EXPECT_EQ(DRM_IOCTL_IVPU_BO_WAIT, osInfc.ioctlLastCommand);
+
+    cmdBuffer.reset();
+    cmds.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
+}
+
+TEST_F(VPUCommandBufferTest, bufferHandlesAreReferenceCountedPerCommand) {
+    // Sub-allocated buffer objects share handle of the slab, use dedicated ones
+    auto tsHeap =
+        ctx->createUntrackedBufferObject(sizeof(uint64_t), VPUBufferObject::Type::CachedFw);
+    auto userBo =
+        ctx->createUntrackedBufferObject(sizeof(uint64_t), VPUBufferObject::Type::CachedFw);
+    auto preemptionBo =
+        ctx->createUntrackedBufferObject(sizeof(uint64_t), VPUBufferObject::Type::CachedFw);
+    ASSERT_TRUE(tsHeap && userBo && preemptionBo);
+    uint32_t tsHandle = tsHeap->getHandle();
+    uint32_t userHandle = userBo->getHandle();
+
+    std::vector<std::shared_ptr<VPUCommand>> cmds;
+    for (int i = 0; i < 2; i++)
+        cmds.emplace_back(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsHeap->getBasePointer()),
+                                        tsHeap));
+    auto cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+    const auto &handles = cmdBuffer->getBufferHandles();
+    EXPECT_EQ(std::vector<uint32_t>({cmdBuffer->getBuffer()->getHandle(), tsHandle}), handles);
+
+    cmdBuffer->addPreemptionBuffer(preemptionBo);
+    EXPECT_EQ(preemptionBo->getHandle(), handles.at(cmdBuffer->getPreemptionBufferIndex()));
+
+    // Handle stays as long as one of the commands uses it
+    cmdBuffer->replaceBufferHandles({tsHandle}, {userHandle});
+    EXPECT_EQ(4u, handles.size());
+    cmdBuffer->replaceBufferHandles({tsHandle}, {});
+    EXPECT_EQ(3u, handles.size());
+    EXPECT_EQ(0, std::count(handles.begin(), handles.end(), tsHandle));
+    EXPECT_EQ(preemptionBo->getHandle(), handles.at(cmdBuffer->getPreemptionBufferIndex()));
+
+    // Unknown handle is ignored, handle of command buffer is never removed
+    cmdBuffer->replaceBufferHandles({tsHandle, cmdBuffer->getBuffer()->getHandle()}, {});
+    EXPECT_EQ(3u, handles.size());
+    EXPECT_EQ(cmdBuffer->getBuffer()->getHandle(), handles.front());
+
+    cmdBuffer->replaceBufferHandles({userHandle}, {});
+    EXPECT_EQ(2u, handles.size());
+    EXPECT_EQ(preemptionBo->getHandle(), handles.at(cmdBuffer->getPreemptionBufferIndex()));
+
+    cmdBuffer->setSubmitted();
+    EXPECT_TRUE(cmdBuffer->waitForCompletion(0));
+    EXPECT_EQ(1u, handles.size());
+    EXPECT_EQ(0u, cmdBuffer->getPreemptionBufferIndex());
+
+    cmdBuffer.reset();
+    cmds.clear();
+}
+
+TEST_F(VPUCommandBufferTest, sharedSlabHandleIsKeptWhileAnySubAllocationIsUsed) {
+    auto firstBo = ctx->createUntrackedSubAllocation(sizeof(uint64_t),
+                                                     VPUBufferObject::Type::CachedFw);
+    auto secondBo = ctx->createUntrackedSubAllocation(sizeof(uint64_t),
+                                                      VPUBufferObject::Type::CachedFw);
+    ASSERT_TRUE(firstBo && secondBo);
+    ASSERT_TRUE(firstBo->isSubAllocation());
+    uint32_t slabHandle = firstBo->getHandle();
+    ASSERT_EQ(slabHandle, secondBo->getHandle());
+
+    std::vector<std::shared_ptr<VPUCommand>> cmds;
+    for (const auto &bo : {firstBo, secondBo})
+        cmds.emplace_back(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(bo->getBasePointer()), bo));
+    auto cmdBuffer = VPUCommandBuffer::allocateCommandBuffer(ctx, cmds.begin(), cmds.end());
+    ASSERT_NE(nullptr, cmdBuffer);
+    const auto &handles = cmdBuffer->getBufferHandles();
+    EXPECT_EQ(std::vector<uint32_t>({cmdBuffer->getBuffer()->getHandle(), slabHandle}), handles);
+
+    // Mutable update replaces the first buffer, the second one still uses the slab handle
+    cmdBuffer->replaceBufferHandles({slabHandle}, {});
+    EXPECT_EQ(1, std::count(handles.begin(), handles.end(), slabHandle));
+
+    cmdBuffer->replaceBufferHandles({slabHandle}, {});
+    EXPECT_EQ(0, std::count(handles.begin(), handles.end(), slabHandle));
+
+    cmdBuffer.reset();
+    cmds.clear();
+}
 } // namespace VPU
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "api/vpu_jsm_job_cmd_api.h"
 #include "gtest/gtest.h"
 #include "vpu_driver/source/command/command_buffer.hpp"
 #include "vpu_driver/source/command/copy_command.hpp"
@@ -33,7 +34,9 @@ static size_t getExpBufferCount(const std::vector<uint32_t> &cmd_handles) {
 
 struct VPUJobTest : public ::testing::Test {
     void SetUp() override {}
-    void TearDown() override { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
+    void TearDown() override {
+        ASSERT_EQ(ctx->getBuffersCount(), ctx->getCommandBufferCacheCount());
+    }
 
     MockOsInterfaceImp osInfc;
     std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
@@ -201,3 +204,86 @@ TEST_F(VPUJobTest, checkJobStatus) {
 
     EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
 }
+
+static std::vector<uint8_t> getCommandStream(const VPUCommandBuffer &cmdBuffer) {
+    const uint8_t *base =
+        cmdBuffer.getBuffer()->getBasePointer() + cmdBuffer.getCommandBufferOffset();
+    const auto *header = reinterpret_cast<const vpu_cmd_buffer_header_t *>(base);
+    return std::vector<uint8_t>(base, base + header->cmd_buffer_size);
+}
+
+TEST_F(VPUJobTest, stripInOrderPatchesCommandBuffersToFreshlyBuiltState) {
+    auto tsHeap = ctx->createSharedMemAlloc(sizeof(uint64_t));
+    auto eventBo = ctx->createUntrackedBufferObject(sizeof(VPUEventCommand::KMDEventDataType),
+                                                    VPU::VPUBufferObject::Type::CachedFw);
+    auto waitBo = ctx->createUntrackedBufferObject(sizeof(VPUCommandBuffer::CommandHeader),
+                                                   VPU::VPUBufferObject::Type::CachedFw);
+    ASSERT_TRUE(tsHeap && eventBo && waitBo);
+    auto *tsPtr = reinterpret_cast<uint64_t *>(tsHeap->getBasePointer());
+    auto *eventPtr =
+        reinterpret_cast<VPUEventCommand::KMDEventDataType *>(eventBo->getBasePointer());
+
+    auto job = std::make_unique<VPUJob>(ctx);
+    EXPECT_TRUE(job->appendCommand(VPUTimeStampCommand::create(tsPtr, tsHeap)));
+    EXPECT_TRUE(job->appendCommand(VPUEventSignalCommand::create(eventPtr, eventBo)));
+    EXPECT_TRUE(job->appendCommand(VPUTimeStampCommand::create(tsPtr, tsHeap)));
+    EXPECT_TRUE(job->closeCommands());
+    ASSERT_EQ(2u, job->getCommandBuffers().size());
+
+    std::vector<VPUCommandBuffer *> cmdBuffers;
+    std::vector<std::vector<uint8_t>> freshStreams;
+    std::vector<std::vector<uint32_t>> freshHandles;
+    for (const auto &cmdBuffer : job->getCommandBuffers()) {
+        cmdBuffers.push_back(cmdBuffer.get());
+        freshStreams.push_back(getCommandStream(*cmdBuffer));
+        freshHandles.push_back(cmdBuffer->getBufferHandles());
+    }
+
+    for (int i = 0; i < 3; i++) {
+        std::shared_ptr<VPUBufferObject> waitFor = waitBo;
+        EXPECT_TRUE(job->makeInOrder(waitFor));
+        EXPECT_TRUE(job->isInOrder());
+        EXPECT_EQ(waitFor, job->getCommandBuffers().back()->getBuffer());
+        EXPECT_NE(freshStreams.front(), getCommandStream(*job->getCommandBuffers().front()));
+        EXPECT_NE(freshStreams.back(), getCommandStream(*job->getCommandBuffers().back()));
+        EXPECT_EQ(freshHandles.front().size() + 1,
+                  job->getCommandBuffers().front()->getBufferHandles().size());
+
+        EXPECT_TRUE(job->stripInOrder());
+        EXPECT_FALSE(job->isInOrder());
+        for (size_t j = 0; j < cmdBuffers.size(); j++) {
+            // Buffers are patched in place, not rebuilt
+            EXPECT_EQ(cmdBuffers[j], job->getCommandBuffers()[j].get());
+            EXPECT_EQ(freshStreams[j], getCommandStream(*job->getCommandBuffers()[j]));
+            EXPECT_EQ(freshHandles[j], job->getCommandBuffers()[j]->getBufferHandles());
+        }
+    }
+
+    // Submitted buffers may still be processed by device, they are rebuilt instead
+    std::shared_ptr<VPUBufferObject> waitFor = waitBo;
+    EXPECT_TRUE(job->makeInOrder(waitFor));
+    job->getCommandBuffers().front()->setSubmitted();
+    EXPECT_TRUE(job->stripInOrder());
+    ASSERT_EQ(2u, job->getCommandBuffers().size());
+    for (size_t j = 0; j < cmdBuffers.size(); j++)
+        EXPECT_EQ(freshHandles[j].size(), job->getCommandBuffers()[j]->getBufferHandles().size());
+
+    // Submission retired by queue is finished, buffers are patched in place again
+    cmdBuffers.clear();
+    for (const auto &cmdBuffer : job->getCommandBuffers())
+        cmdBuffers.push_back(cmdBuffer.get());
+    waitFor = waitBo;
+    EXPECT_TRUE(job->makeInOrder(waitFor));
+    auto &front = job->getCommandBuffers().front();
+    auto fence = std::make_shared<VPUSubmissionFence>(front->getBuffer());
+    front->setSubmitted(fence);
+    EXPECT_TRUE(front->isSubmitted());
+    fence->signal();
+    EXPECT_FALSE(front->isSubmitted());
+    EXPECT_TRUE(job->stripInOrder());
+    for (size_t j = 0; j < cmdBuffers.size(); j++)
+        EXPECT_EQ(cmdBuffers[j], job->getCommandBuffers()[j].get());
+
+    job.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsHeap->getBasePointer()));
+}
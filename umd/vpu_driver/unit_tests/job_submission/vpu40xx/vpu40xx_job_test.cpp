@@ -37,7 +37,9 @@ static size_t getExpBufferCount(const std::vector<uint32_t> &cmd_handles) {
 struct VPUJobTestForVPU40xx : public ::testing::Test {
     void SetUp() {}
 
-    void TearDown() { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
+    void TearDown() {
+        ASSERT_EQ(ctx->getBuffersCount(), ctx->getCommandBufferCacheCount());
+    }
 
     std::unique_ptr<MockOsInterfaceImp> osInfc = std::make_unique<MockOsInterfaceImp>(0x643e);
     std::unique_ptr<MockVPUDevice> vpuDevice =
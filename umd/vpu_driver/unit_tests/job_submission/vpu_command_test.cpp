@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -103,6 +103,158 @@ TEST_F(VPUCommandTest, copyCommandShouldReturnExpectedProperties) {
     EXPECT_TRUE(ctx->freeMemAlloc(dstBo->getBasePointer()));
 }
 
+TEST_F(VPUCommandTest, copyRegionCommandMergesContiguousRowsIntoSingleDescriptor) {
+    const size_t size = 4 * 1024;
+    auto srcBo = ctx->createSharedMemAlloc(size);
+    auto dstBo = ctx->createSharedMemAlloc(size);
+
+    auto getDescriptors = [](const std::shared_ptr<VPUCopyCommand> &cmd) {
+        auto *desc = reinterpret_cast<const vpu_cmd_copy_descriptor_37xx_t *>(
+            cmd->getDescriptorData());
+        size_t count = cmd->getDescriptorSize() / sizeof(vpu_cmd_copy_descriptor_37xx_t);
+        EXPECT_EQ(reinterpret_cast<const vpu_cmd_copy_buffer_t *>(cmd->getCommitStream())
+                      ->desc_count,
+                  count);
+        return std::vector<vpu_cmd_copy_descriptor_37xx_t>(desc, desc + count);
+    };
+
+    // Rows and slices are contiguous in both buffers
+    VPUCopyRegion region = {.width = 64,
+                            .height = 4,
+                            .depth = 3,
+                            .srcPitch = 64,
+                            .srcSlicePitch = 256,
+                            .dstPitch = 64,
+                            .dstSlicePitch = 256};
+    auto cmd = VPUCopyCommand::create(ctx,
+                                      srcBo->getBasePointer(),
+                                      srcBo,
+                                      dstBo->getBasePointer() + 128,
+                                      dstBo,
+                                      region);
+    ASSERT_NE(cmd, nullptr);
+    auto descs = getDescriptors(cmd);
+    ASSERT_EQ(descs.size(), 1u);
+    EXPECT_EQ(descs[0].src_address, srcBo->getVPUAddr());
+    EXPECT_EQ(descs[0].dst_address, dstBo->getVPUAddr() + 128);
+    EXPECT_EQ(descs[0].size, 64u * 4 * 3);
+
+    // Rows are contiguous, slices are not
+    region.srcSlicePitch = region.dstSlicePitch = 1024;
+    cmd = VPUCopyCommand::create(ctx,
+                                 srcBo->getBasePointer(),
+                                 srcBo,
+                                 dstBo->getBasePointer(),
+                                 dstBo,
+                                 region);
+    ASSERT_NE(cmd, nullptr);
+    descs = getDescriptors(cmd);
+    ASSERT_EQ(descs.size(), 3u);
+    for (size_t z = 0; z < descs.size(); z++) {
+        EXPECT_EQ(descs[z].src_address, srcBo->getVPUAddr() + z * 1024);
+        EXPECT_EQ(descs[z].dst_address, dstBo->getVPUAddr() + z * 1024);
+        EXPECT_EQ(descs[z].size, 256u);
+    }
+
+    // Strided source rows need a descriptor per row
+    region.width = 16;
+    region.depth = 1;
+    region.dstPitch = 16;
+    cmd = VPUCopyCommand::create(ctx,
+                                 srcBo->getBasePointer() + 8,
+                                 srcBo,
+                                 dstBo->getBasePointer(),
+                                 dstBo,
+                                 region);
+    ASSERT_NE(cmd, nullptr);
+    descs = getDescriptors(cmd);
+    ASSERT_EQ(descs.size(), 4u);
+    for (size_t y = 0; y < descs.size(); y++) {
+        EXPECT_EQ(descs[y].src_address, srcBo->getVPUAddr() + 8 + y * 64);
+        EXPECT_EQ(descs[y].dst_address, dstBo->getVPUAddr() + y * 16);
+        EXPECT_EQ(descs[y].size, 16u);
+    }
+
+    // Region has to fit in buffer object
+    region.height = 65;
+    EXPECT_EQ(VPUCopyCommand::create(ctx,
+                                     srcBo->getBasePointer() + 8,
+                                     srcBo,
+                                     dstBo->getBasePointer(),
+                                     dstBo,
+                                     region),
+              nullptr);
+
+    cmd.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(srcBo->getBasePointer()));
+    EXPECT_TRUE(ctx->freeMemAlloc(dstBo->getBasePointer()));
+}
+
+TEST_F(VPUCommandTest, fillSequenceDoublesFilledPartOfDestination) {
+    const uint32_t pattern = 0xdeadbeef;
+    const size_t size = 70000;
+    auto dstBo = ctx->createSharedMemAlloc(size);
+    memset(dstBo->getBasePointer(), 0, size);
+
+    auto patternBo = ctx->fillPatternCacheAcquire(pattern);
+    ASSERT_NE(patternBo, nullptr);
+    EXPECT_EQ(ctx->fillPatternCacheAcquire(pattern), patternBo);
+    EXPECT_EQ(patternBo->getAllocSize(), FillPatternCacheFactory::patternBufferSize);
+
+    auto commands = VPUCopyCommand::createFillSequence(ctx,
+                                                       patternBo,
+                                                       dstBo->getBasePointer(),
+                                                       dstBo,
+                                                       size);
+    // 4KB from pattern buffer, then 4KB, 8KB, 16KB, 32KB and the remaining 4464 bytes
+    ASSERT_EQ(commands.size(), 11u);
+
+    // Execute descriptors on host, addresses are translated back using buffer objects
+    auto toHost = [&](uint64_t vpuAddr) -> uint8_t * {
+        for (auto &bo : {patternBo, dstBo}) {
+            if (vpuAddr >= bo->getVPUAddr() && vpuAddr < bo->getVPUAddr() + bo->getAllocSize())
+                return bo->getBasePointer() + (vpuAddr - bo->getVPUAddr());
+        }
+        return nullptr;
+    };
+
+    size_t filled = 0;
+    for (size_t i = 0; i < commands.size(); i++) {
+        if (i % 2) {
+            EXPECT_EQ(commands[i]->getCommandType(), VPU_CMD_BARRIER);
+            continue;
+        }
+
+        ASSERT_EQ(commands[i]->getCommandType(), VPU_CMD_COPY);
+        auto *desc = reinterpret_cast<const vpu_cmd_copy_descriptor_37xx_t *>(
+            commands[i]->getDescriptorData());
+        ASSERT_EQ(commands[i]->getDescriptorSize(), sizeof(*desc));
+        EXPECT_EQ(desc->src_address, i ? dstBo->getVPUAddr() : patternBo->getVPUAddr());
+        EXPECT_EQ(desc->dst_address, dstBo->getVPUAddr() + filled);
+        ASSERT_NE(toHost(desc->src_address), nullptr);
+        ASSERT_NE(toHost(desc->dst_address), nullptr);
+        memcpy(toHost(desc->dst_address), toHost(desc->src_address), desc->size);
+        filled += desc->size;
+    }
+    EXPECT_EQ(filled, size);
+
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(dstBo->getBasePointer()[i], reinterpret_cast<const uint8_t *>(&pattern)[i % 4]);
+
+    // Fill has to fit in destination buffer object
+    EXPECT_TRUE(VPUCopyCommand::createFillSequence(ctx,
+                                                   patternBo,
+                                                   dstBo->getBasePointer() + 1,
+                                                   dstBo,
+                                                   size)
+                    .empty());
+
+    commands.clear();
+    patternBo.reset();
+    ctx->fillPatternCachePrune();
+    EXPECT_TRUE(ctx->freeMemAlloc(dstBo->getBasePointer()));
+}
+
 TEST_F(VPUCommandTest, barrierCommandShouldReturnExpectedProperties) {
     std::shared_ptr<VPUCommand> barrierCmd = VPUBarrierCommand::create();
     ASSERT_NE(barrierCmd, nullptr);
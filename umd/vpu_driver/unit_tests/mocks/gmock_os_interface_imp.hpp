@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,7 @@ class GMockOsFileImp : public OsFile {
     MOCK_METHOD(bool, write, (const void *, size_t), (override));
     MOCK_METHOD(void *, mmap, (), (override));
     MOCK_METHOD(size_t, size, (), (override));
+    MOCK_METHOD(int64_t, mtime, (), (override));
 };
 
 class GMockOsInterfaceImp : public OsInterface {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,7 +14,9 @@
 #include "umd_common.hpp"
 #include "vpu_driver/source/utilities/log.hpp"
 
+#include <algorithm>
 #include <api/vpu_jsm_api.h>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <errno.h>
@@ -117,7 +119,9 @@ int MockOsInterfaceImp::osiIoctl(int fd, unsigned int request, void *data) {
             return -1;
         }
 
+        callCntBoCreate++;
         auto *args = static_cast<struct drm_ivpu_bo_create *>(data);
+        args->handle = nextHandle++;
         args->vpu_addr = deviceAddress;
         deviceAddress += ALIGN(args->size, osiGetSystemPageSize());
     } else if (request == DRM_IOCTL_IVPU_BO_INFO) {
@@ -126,13 +130,43 @@ int MockOsInterfaceImp::osiIoctl(int fd, unsigned int request, void *data) {
 
     } else if (request == DRM_IOCTL_IVPU_SUBMIT) {
         callCntSubmit++;
+        if (busySubmits > 0) {
+            busySubmits--;
+            errno = EBUSY;
+            return -1;
+        }
     } else if (request == DRM_IOCTL_IVPU_CMDQ_CREATE) {
         callCntSubmit++;
     } else if (request == DRM_IOCTL_IVPU_CMDQ_SUBMIT) {
         callCntSubmit++;
+        if (busySubmits > 0) {
+            busySubmits--;
+            errno = EBUSY;
+            return -1;
+        }
     } else if (request == DRM_IOCTL_IVPU_CMDQ_DESTROY) {
         callCntSubmit++;
     } else if (request == DRM_IOCTL_IVPU_BO_WAIT) {
+        auto *args = static_cast<struct drm_ivpu_bo_wait *>(data);
+        {
+            std::unique_lock<std::mutex> lock(jobWaitMutex);
+            auto deadline =
+                std::chrono::steady_clock::time_point(std::chrono::nanoseconds(args->timeout_ns));
+            bool blocking = jobWaitBlocked && deadline > std::chrono::steady_clock::now();
+            if (blocking) {
+                blockedJobWaits++;
+                jobWaitCv.notify_all();
+            }
+            bool unblocked =
+                jobWaitCv.wait_until(lock, deadline, [this] { return !jobWaitBlocked; });
+            if (blocking)
+                blockedJobWaits--;
+            if (!unblocked) {
+                errno = ETIMEDOUT;
+                return -1;
+            }
+        }
+
         bool timeout = waitFailed.test(0);
         waitFailed >>= 1;
         if (timeout) {
@@ -140,7 +174,6 @@ int MockOsInterfaceImp::osiIoctl(int fd, unsigned int request, void *data) {
             return -1;
         }
 
-        auto *args = static_cast<struct drm_ivpu_bo_wait *>(data);
         if (jobFailed.test(0)) {
             args->job_status = VPU_JSM_STATUS_PARSING_ERR;
         } else {
@@ -153,8 +186,21 @@ int MockOsInterfaceImp::osiIoctl(int fd, unsigned int request, void *data) {
             errno = EINVAL;
             return -1;
         }
+        args->handle = nextHandle++;
         args->vpu_addr = deviceAddress;
         deviceAddress += ALIGN(args->size, osiGetSystemPageSize());
+    } else if (request == DRM_IOCTL_IVPU_METRIC_STREAMER_GET_DATA) {
+        auto *args = static_cast<struct drm_ivpu_metric_streamer_get_data *>(data);
+        const std::lock_guard<std::mutex> lock(metricDataMutex);
+        metricGetDataCount++;
+        if (args->buffer_size == 0) {
+            args->data_size = metricData.size();
+        } else {
+            size_t size = std::min<size_t>(args->buffer_size, metricData.size());
+            memcpy(reinterpret_cast<void *>(args->buffer_ptr), metricData.data(), size);
+            metricData.erase(metricData.begin(), metricData.begin() + size);
+            args->data_size = size;
+        }
     } else if (request == DRM_IOCTL_IVPU_METRIC_STREAMER_GET_INFO) {
         drm_ivpu_metric_streamer_get_data *args =
             static_cast<struct drm_ivpu_metric_streamer_get_data *>(data);
@@ -307,4 +353,31 @@ void MockOsInterfaceImp::mockSuccessNextJobStatus() {
     jobFailed <<= 1;
 }
 
+void MockOsInterfaceImp::mockBusyNextSubmits(uint32_t count) {
+    busySubmits = count;
+}
+
+void MockOsInterfaceImp::mockMetricStreamerData(const std::vector<uint8_t> &data) {
+    const std::lock_guard<std::mutex> lock(metricDataMutex);
+    metricData.insert(metricData.end(), data.begin(), data.end());
+}
+
+uint32_t MockOsInterfaceImp::getMetricStreamerGetDataCount() {
+    const std::lock_guard<std::mutex> lock(metricDataMutex);
+    return metricGetDataCount;
+}
+
+void MockOsInterfaceImp::mockBlockJobWait(bool block) {
+    {
+        const std::lock_guard<std::mutex> lock(jobWaitMutex);
+        jobWaitBlocked = block;
+    }
+    jobWaitCv.notify_all();
+}
+
+void MockOsInterfaceImp::mockWaitForBlockedJobWait() {
+    std::unique_lock<std::mutex> lock(jobWaitMutex);
+    jobWaitCv.wait(lock, [this] { return blockedJobWaits > 0; });
+}
+
 } // namespace VPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2024 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,11 +12,14 @@
 #include "vpu_driver/source/os_interface/os_interface.hpp"
 
 #include <bitset>
+#include <condition_variable>
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <sys/types.h>
+#include <vector>
 
 namespace VPU {
 class MockOsInterfaceImp : public OsInterface {
@@ -34,10 +37,12 @@ class MockOsInterfaceImp : public OsInterface {
     uint32_t callCntFree = 0;
     uint32_t callCntIoctl = 0;
     uint32_t callCntSubmit = 0;
+    uint32_t callCntBoCreate = 0;
 
     unsigned long ioctlLastCommand = 0;
     int fd = 3;
     uint64_t deviceAddress = 0xc000'0000;
+    uint32_t nextHandle = 1;
     uint64_t unique_id = 0;
 
     int32_t kmdApiVersionMajor = 1;
@@ -79,11 +84,28 @@ class MockOsInterfaceImp : public OsInterface {
     void mockSuccessNextJobWait();
     void mockFailNextJobStatus();
     void mockSuccessNextJobStatus();
+    // Job wait blocks until unblocked or until its timeout expires
+    void mockBlockJobWait(bool block);
+    // Returns once a job wait is blocked by mockBlockJobWait
+    void mockWaitForBlockedJobWait();
+    // Next count submissions fail with EBUSY
+    void mockBusyNextSubmits(uint32_t count);
+    // Append synthetic reports returned by DRM_IOCTL_IVPU_METRIC_STREAMER_GET_DATA
+    void mockMetricStreamerData(const std::vector<uint8_t> &data);
+    uint32_t getMetricStreamerGetDataCount();
 
   private:
     bool failNextAlloc = false;
+    bool jobWaitBlocked = false;
+    uint32_t blockedJobWaits = 0;
+    uint32_t busySubmits = 0;
+    std::mutex jobWaitMutex;
+    std::condition_variable jobWaitCv;
     std::bitset<8> waitFailed = {};
     std::bitset<8> jobFailed = {};
+    std::mutex metricDataMutex;
+    std::vector<uint8_t> metricData;
+    uint32_t metricGetDataCount = 0;
 };
 
 } // namespace VPU
@@ -1,12 +1,16 @@
 /*
- * Copyright (C) 2022-2025 Intel Corporation
+ * Copyright (C) 2022-2026 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include <cstdint>
+#include <errno.h>
+#include <fcntl.h>
 #include <stddef.h>
+#include <string.h>
+#include <unistd.h>
 
 #include "api/vpu_jsm_job_cmd_api.h"
 #include "gtest/gtest.h"
@@ -21,13 +25,18 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <numeric>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 using namespace VPU;
+using namespace std::chrono_literals;
 
 struct DeviceContextTest : public ::testing::Test {
     void SetUp() override {
@@ -36,8 +45,8 @@ struct DeviceContextTest : public ::testing::Test {
     }
 
     void TearDown() override {
-        // No tracking memory should be left.
-        ASSERT_EQ(ctx->getBuffersCount(), 0u);
+        // No tracking memory should be left, except idle command buffers kept for reuse.
+        ASSERT_EQ(ctx->getBuffersCount(), ctx->getCommandBufferCacheCount());
     }
 
     void checkOffsets(std::vector<std::shared_ptr<VPUCommand>> &commands,
@@ -603,3 +612,359 @@ TEST_F(DeviceContextTest, preemptionBufferCacheShouldWorkAsExpected) {
     // Expect no preemption buffers left
     EXPECT_EQ(ctx->getAllocatedSize(), 0u);
 }
+
+TEST_F(DeviceContextTest, commandBufferCacheShouldWorkAsExpected) {
+    const size_t minSize = CommandBufferCacheFactory::minSizeClass;
+
+    // Requests are rounded up to power of two size classes
+    auto bo = ctx->commandBufferCacheAcquire(minSize + 1);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_EQ(bo->getAllocSize(), minSize * 2);
+    EXPECT_EQ(ctx->getBuffersCount(), 1u);
+
+    // Buffer in use is not returned twice
+    auto bo2 = ctx->commandBufferCacheAcquire(minSize * 2);
+    ASSERT_NE(bo2, nullptr);
+    EXPECT_NE(bo->getVPUAddr(), bo2->getVPUAddr());
+    EXPECT_EQ(ctx->getAllocatedSize(), minSize * 4);
+
+    // Idle buffers are reported as cached and reused
+    auto vpuAddr = bo->getVPUAddr();
+    bo.reset();
+    EXPECT_EQ(ctx->getBuffersCount(), 2u);
+    EXPECT_EQ(ctx->getCommandBufferCacheCount(), 1u);
+    bo = ctx->commandBufferCacheAcquire(minSize + 64);
+    EXPECT_EQ(bo->getVPUAddr(), vpuAddr);
+
+    // Pruning keeps buffers in use
+    bo2.reset();
+    ctx->commandBufferCachePrune();
+    EXPECT_EQ(ctx->getAllocatedSize(), minSize * 2);
+    bo.reset();
+    ctx->commandBufferCachePrune();
+    EXPECT_EQ(ctx->getAllocatedSize(), 0u);
+
+    // Oversized buffers are not cached
+    size_t maxSize = minSize << (CommandBufferCacheFactory::numSizeClasses - 1);
+    bo = ctx->commandBufferCacheAcquire(maxSize + 1);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_EQ(bo->getAllocSize(), maxSize + 1);
+    bo.reset();
+    EXPECT_EQ(ctx->getAllocatedSize(), 0u);
+}
+
+TEST_F(DeviceContextTest, uniqueInferenceIdsAreReservedInBlocks) {
+    const size_t blockSize = 1ULL << VPUDeviceContext::inferenceIdBlockShift;
+
+    osInfc.callCntIoctl = 0;
+    std::set<uint64_t> ids;
+    for (size_t i = 0; i < 1000; i++) {
+        uint64_t id = 0;
+        ASSERT_TRUE(ctx->getUniqueInferenceId(id));
+        EXPECT_TRUE(id & VPUDeviceContext::inferenceIdBlockTag);
+        ids.insert(id);
+    }
+    EXPECT_EQ(ids.size(), 1000u);
+    EXPECT_EQ(osInfc.callCntIoctl, 1u);
+
+    // Next block is requested from kernel when current one is exhausted
+    for (size_t i = ids.size(); i < blockSize + 1; i++) {
+        uint64_t id = 0;
+        ASSERT_TRUE(ctx->getUniqueInferenceId(id));
+        ids.insert(id);
+    }
+    EXPECT_EQ(ids.size(), blockSize + 1);
+    EXPECT_EQ(osInfc.callCntIoctl, 2u);
+
+    // Blocks reserved by other contexts do not overlap
+    auto otherContext = vpuDevice->createMockDeviceContext();
+    uint64_t id = 0;
+    ASSERT_TRUE(otherContext->getUniqueInferenceId(id));
+    EXPECT_EQ(ids.count(id), 0u);
+}
+
+TEST_F(DeviceContextTest, findBufferObjectReturnsBufferAddedOrRemovedAfterLookup) {
+    auto bo1 = ctx->createHostMemAlloc(4096);
+    ASSERT_NE(bo1, nullptr);
+    EXPECT_EQ(ctx->findBufferObject(bo1->getBasePointer()), bo1);
+
+    // Snapshot used for lookup is refreshed after buffer list is changed
+    auto bo2 = ctx->createHostMemAlloc(4096);
+    ASSERT_NE(bo2, nullptr);
+    EXPECT_EQ(ctx->findBufferObject(bo2->getBasePointer() + 4095), bo2);
+    EXPECT_EQ(ctx->findBufferObject(bo1->getBasePointer()), bo1);
+
+    void *ptr2 = bo2->getBasePointer();
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(bo2)));
+    EXPECT_EQ(ctx->findBufferObject(ptr2), nullptr);
+
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(bo1)));
+}
+
+TEST_F(DeviceContextTest, findBufferObjectFromMultipleThreadsWhileBuffersChange) {
+    const size_t bufferCount = 64;
+    const size_t threads = 4;
+    const size_t lookupsPerThread = 10000;
+
+    std::vector<std::shared_ptr<VPUBufferObject>> bos;
+    for (size_t i = 0; i < bufferCount; i++) {
+        auto bo = ctx->createHostMemAlloc(4096);
+        ASSERT_NE(bo, nullptr);
+        bos.push_back(std::move(bo));
+    }
+
+    std::atomic<bool> stop = false;
+    std::atomic<size_t> mismatches = 0;
+
+    // Buffers are added and removed during lookups to exercise snapshot refresh
+    std::thread writer([&] {
+        while (!stop) {
+            auto bo = ctx->createHostMemAlloc(4096);
+            if (bo)
+                ctx->freeMemAlloc(std::move(bo));
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < threads; t++) {
+        readers.emplace_back([&, t] {
+            for (size_t i = 0; i < lookupsPerThread; i++) {
+                auto &bo = bos[(i * 7 + t) % bufferCount];
+                if (ctx->findBufferObject(bo->getBasePointer() + i % 4096) != bo)
+                    mismatches++;
+            }
+        });
+    }
+    for (auto &reader : readers)
+        reader.join();
+    stop = true;
+    writer.join();
+
+    EXPECT_EQ(mismatches, 0u);
+    for (auto &bo : bos)
+        EXPECT_TRUE(ctx->freeMemAlloc(std::move(bo)));
+}
+
+TEST_F(DeviceContextTest, smallAllocationsAreSubAllocatedFromSlab) {
+    const size_t slotSize = SlabAllocatorFactory::minSizeClass;
+    const size_t slotCount = SlabAllocatorFactory::slabSize / slotSize;
+
+    osInfc.callCntAlloc = 0;
+    std::vector<std::shared_ptr<VPUBufferObject>> bos;
+    for (size_t i = 0; i < slotCount; i++) {
+        auto bo = ctx->createHostMemAlloc(100);
+        ASSERT_NE(bo, nullptr);
+        EXPECT_TRUE(bo->isSubAllocation());
+        EXPECT_EQ(bo->getAllocSize(), 100u);
+        bos.push_back(std::move(bo));
+    }
+    EXPECT_EQ(osInfc.callCntAlloc, 1u);
+    EXPECT_EQ(ctx->getSlabCount(), 1u);
+    EXPECT_EQ(ctx->getBuffersCount(), slotCount);
+
+    // Pointer inside of sub-allocation resolves to parent address with slot offset
+    uint64_t slabVpuAddr = bos[0]->getVPUAddr();
+    for (size_t i = 0; i < slotCount; i++) {
+        uint8_t *ptr = bos[i]->getBasePointer() + 10;
+        auto bo = ctx->findBufferObject(ptr);
+        EXPECT_EQ(bo, bos[i]);
+        EXPECT_EQ(bo->getVPUAddr(ptr), slabVpuAddr + i * slotSize + 10);
+        EXPECT_EQ(bo->getHandle(), bos[0]->getHandle());
+    }
+
+    // Full slab is followed by new slab
+    auto bo = ctx->createHostMemAlloc(100);
+    ASSERT_NE(bo, nullptr);
+    EXPECT_EQ(osInfc.callCntAlloc, 2u);
+    EXPECT_EQ(ctx->getSlabCount(), 2u);
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(bo)));
+
+    // Freed slot is reused and cleared
+    memset(bos[3]->getBasePointer(), 0xff, 100);
+    uint8_t *ptr = bos[3]->getBasePointer();
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(bos[3])));
+    bos[3] = ctx->createHostMemAlloc(100);
+    ASSERT_NE(bos[3], nullptr);
+    EXPECT_EQ(bos[3]->getBasePointer(), ptr);
+    EXPECT_EQ(std::count(ptr, ptr + slotSize, 0), static_cast<long>(slotSize));
+    EXPECT_EQ(osInfc.callCntAlloc, 2u);
+
+    // Single empty slab is kept for next allocations until prune
+    size_t callCntFree = osInfc.callCntFree;
+    for (auto &bo : bos)
+        EXPECT_TRUE(ctx->freeMemAlloc(std::move(bo)));
+    EXPECT_EQ(ctx->getSlabCount(), 1u);
+    EXPECT_EQ(osInfc.callCntFree, callCntFree + 1);
+
+    ctx->slabAllocatorPrune();
+    EXPECT_EQ(ctx->getSlabCount(), 0u);
+    EXPECT_EQ(osInfc.callCntFree, callCntFree + 2);
+}
+
+TEST_F(DeviceContextTest, slabsAreNotSharedBetweenSizeClassesAndTypes) {
+    osInfc.callCntAlloc = 0;
+    auto host4k = ctx->createHostMemAlloc(4 * 1024);
+    auto host8k = ctx->createHostMemAlloc(6 * 1024);
+    auto shared4k = ctx->createSharedMemAlloc(4 * 1024);
+    auto device4k = ctx->createDeviceMemAlloc(4 * 1024);
+    EXPECT_EQ(osInfc.callCntAlloc, 4u);
+    EXPECT_EQ(ctx->getSlabCount(), 4u);
+    EXPECT_NE(host8k->getBasePointer() - host4k->getBasePointer(), 4 * 1024);
+
+    // Allocation above the largest size class gets own buffer object
+    auto large = ctx->createHostMemAlloc(SlabAllocatorFactory::maxAllocSize + 1);
+    ASSERT_NE(large, nullptr);
+    EXPECT_FALSE(large->isSubAllocation());
+    EXPECT_EQ(ctx->getSlabCount(), 4u);
+
+    for (auto *bo : {&host4k, &host8k, &shared4k, &device4k, &large})
+        EXPECT_TRUE(ctx->freeMemAlloc(std::move(*bo)));
+    ctx->slabAllocatorPrune();
+    EXPECT_EQ(ctx->getSlabCount(), 0u);
+}
+
+TEST_F(DeviceContextTest, allocatedMemoryCountsSlabsInsteadOfSubAllocations) {
+    const auto location = VPUBufferObject::Location::Host;
+    const int64_t slabSize = static_cast<int64_t>(SlabAllocatorFactory::slabSize);
+    int64_t initial = VPUBufferObject::getAllocatedMemory(location);
+
+    // First small allocation creates the slab, the next one is carved out of it
+    auto first = ctx->createHostMemAlloc(100);
+    auto second = ctx->createHostMemAlloc(100);
+    ASSERT_TRUE(first && second);
+    EXPECT_TRUE(second->isSubAllocation());
+    EXPECT_EQ(VPUBufferObject::getAllocatedMemory(location), initial + slabSize);
+
+    // Allocation above the largest size class is counted with its own size
+    auto large = ctx->createHostMemAlloc(SlabAllocatorFactory::maxAllocSize + 1);
+    ASSERT_NE(large, nullptr);
+    EXPECT_FALSE(large->isSubAllocation());
+    int64_t largeSize = static_cast<int64_t>(large->getAllocSize());
+    EXPECT_EQ(VPUBufferObject::getAllocatedMemory(location), initial + slabSize + largeSize);
+
+    // Empty slab is counted until it is pruned
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(first)));
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(second)));
+    EXPECT_EQ(VPUBufferObject::getAllocatedMemory(location), initial + slabSize + largeSize);
+    ctx->slabAllocatorPrune();
+    EXPECT_EQ(VPUBufferObject::getAllocatedMemory(location), initial + largeSize);
+
+    EXPECT_TRUE(ctx->freeMemAlloc(std::move(large)));
+    EXPECT_EQ(VPUBufferObject::getAllocatedMemory(location), initial);
+}
+
+static int64_t absTimeoutNs(std::chrono::nanoseconds timeout) {
+    return (std::chrono::steady_clock::now().time_since_epoch() + timeout).count();
+}
+
+TEST_F(DeviceContextTest, completionServiceWakesAllWaitersAndSignalsEventFd) {
+    auto &service = ctx->getCompletionService();
+    int eventFd = service.createStream();
+    ASSERT_GE(eventFd, 0);
+
+    auto bo = ctx->createUntrackedBufferObject(4 * 1024, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+
+    osInfc.mockBlockJobWait(true);
+    auto completion = service.track(eventFd, bo);
+    ASSERT_NE(completion, nullptr);
+
+    uint32_t jobStatus = 0;
+    EXPECT_FALSE(service.wait(*completion, absTimeoutNs(1ms), jobStatus));
+
+    constexpr size_t numWaiters = 8;
+    std::array<std::atomic<bool>, numWaiters> finished = {};
+    std::vector<std::thread> waiters;
+    for (size_t i = 0; i < numWaiters; i++) {
+        waiters.emplace_back([&, i] {
+            uint32_t status = 0;
+            finished[i] = service.wait(*completion, absTimeoutNs(10s), status) &&
+                          status == DRM_IVPU_JOB_STATUS_SUCCESS;
+        });
+    }
+
+    uint64_t value = 0;
+    EXPECT_EQ(read(eventFd, &value, sizeof(value)), -1);
+    EXPECT_EQ(errno, EAGAIN);
+
+    osInfc.mockBlockJobWait(false);
+    for (auto &waiter : waiters)
+        waiter.join();
+    for (auto &waiterFinished : finished)
+        EXPECT_TRUE(waiterFinished);
+
+    EXPECT_EQ(read(eventFd, &value, sizeof(value)), static_cast<ssize_t>(sizeof(value)));
+    EXPECT_EQ(value, 1u);
+
+    // Waiters do not issue BO waits, the service thread waits for progress in time slices
+    uint64_t waitCount = service.getWaitCount();
+    EXPECT_TRUE(service.wait(*completion, 0, jobStatus));
+    EXPECT_EQ(service.getWaitCount(), waitCount);
+    bo.reset();
+}
+
+TEST_F(DeviceContextTest, completionServiceRetiresStreamsInSubmissionOrder) {
+    auto &service = ctx->getCompletionService();
+    std::array<int, 2> streams = {service.createStream(), service.createStream()};
+    ASSERT_GE(streams[0], 0);
+    ASSERT_GE(streams[1], 0);
+
+    auto bo = ctx->createUntrackedBufferObject(4 * 1024, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+
+    osInfc.mockBlockJobWait(true);
+    std::vector<std::shared_ptr<const VPUCompletionService::Completion>> completions;
+    for (size_t i = 0; i < 6; i++)
+        completions.push_back(service.track(streams[i % 2], bo));
+
+    osInfc.mockBlockJobWait(false);
+    uint32_t jobStatus = 0;
+    for (auto &completion : completions) {
+        ASSERT_NE(completion, nullptr);
+        EXPECT_TRUE(service.wait(*completion, absTimeoutNs(10s), jobStatus));
+        EXPECT_EQ(jobStatus, DRM_IVPU_JOB_STATUS_SUCCESS);
+    }
+
+    uint64_t value = 0;
+    for (int eventFd : streams) {
+        EXPECT_EQ(read(eventFd, &value, sizeof(value)), static_cast<ssize_t>(sizeof(value)));
+        EXPECT_EQ(value, 3u);
+    }
+
+    EXPECT_EQ(service.track(-1, bo), nullptr);
+
+    auto subBo = ctx->createUntrackedSubAllocation(64, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(subBo, nullptr);
+    ASSERT_TRUE(subBo->isSubAllocation());
+    EXPECT_EQ(service.track(streams[0], subBo), nullptr);
+    subBo.reset();
+    bo.reset();
+}
+
+TEST_F(DeviceContextTest, completionServiceDestroyedStreamClosesEventFdAndFailsPendingJobs) {
+    auto &service = ctx->getCompletionService();
+    size_t streamCount = service.getStreamCount();
+    int eventFd = service.createStream();
+    ASSERT_GE(eventFd, 0);
+    EXPECT_EQ(service.getStreamCount(), streamCount + 1);
+
+    auto bo = ctx->createUntrackedBufferObject(4 * 1024, VPUBufferObject::Type::CachedFw);
+    ASSERT_NE(bo, nullptr);
+
+    osInfc.mockBlockJobWait(true);
+    auto completion = service.track(eventFd, bo);
+    ASSERT_NE(completion, nullptr);
+
+    service.destroyStream(eventFd);
+    EXPECT_EQ(service.getStreamCount(), streamCount);
+    EXPECT_EQ(fcntl(eventFd, F_GETFD), -1);
+    EXPECT_EQ(errno, EBADF);
+    EXPECT_EQ(service.track(eventFd, bo), nullptr);
+
+    // Job of destroyed stream is waited with direct BO wait
+    osInfc.mockBlockJobWait(false);
+    uint32_t jobStatus = 0;
+    EXPECT_TRUE(service.wait(*completion, absTimeoutNs(10s), jobStatus));
+    EXPECT_EQ(jobStatus, DRM_IVPU_JOB_STATUS_SUCCESS);
+    bo.reset();
+}
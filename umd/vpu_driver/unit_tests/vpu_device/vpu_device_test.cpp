@@ -12,12 +12,17 @@
 #include "vpu_driver/source/command/ts_command.hpp"
 #include "vpu_driver/source/device/metric_info.hpp"
 #include "vpu_driver/source/device/vpu_command_queue.hpp"
+#include "vpu_driver/source/device/vpu_completion_service.hpp"
 #include "vpu_driver/source/memory/vpu_buffer_object.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
 #include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
 
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 using namespace VPU;
@@ -25,7 +30,9 @@ using namespace VPU;
 struct VPUDeviceTest : public ::testing::Test {
     void SetUp() {}
 
-    void TearDown() { ASSERT_EQ(ctx->getBuffersCount(), 0u); }
+    void TearDown() {
+        ASSERT_EQ(ctx->getBuffersCount(), ctx->getCommandBufferCacheCount());
+    }
 
     MockOsInterfaceImp osInfc;
     std::unique_ptr<MockVPUDevice> vpuDevice = MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
@@ -82,3 +89,193 @@ TEST_F(VPUDeviceTest, deviceGetMetricsInfoRetrievesExpectedResults) {
     EXPECT_EQ(metricGroupsInfo[0].counterInfo[0].valueType,
               CounterInfo::ValueType::VALUE_TYPE_UINT64);
 }
+
+TEST_F(VPUDeviceTest, queueWaitPolicyWithZeroSpinBudgetDisablesBusyWait) {
+    EXPECT_EQ(queue->getWaitPolicy(), nullptr);
+
+    EXPECT_TRUE(queue->setWaitPolicy({std::chrono::milliseconds(1), 99}));
+    ASSERT_NE(queue->getWaitPolicy(), nullptr);
+    EXPECT_EQ(queue->getWaitPolicy()->getConfig().percentile, 99u);
+
+    EXPECT_TRUE(queue->setWaitPolicy({std::chrono::nanoseconds::zero(), 90}));
+    EXPECT_EQ(queue->getWaitPolicy(), nullptr);
+}
+
+TEST_F(VPUDeviceTest, turboQueueUsesDefaultWaitPolicyUnlessInOrder) {
+    // Mock device does not report command queue management, so queues are created directly
+    VPUDeviceQueueManaged turboQueue(&ctx->getDriverApi(), 1, VPUDeviceQueue::ModeFlags::TURBO);
+    EXPECT_NE(turboQueue.getWaitPolicy(), nullptr);
+
+    VPUDeviceQueueManaged inOrderQueue(&ctx->getDriverApi(),
+                                       2,
+                                       VPUDeviceQueue::ModeFlags::TURBO |
+                                           VPUDeviceQueue::ModeFlags::IN_ORDER);
+    EXPECT_EQ(inOrderQueue.getWaitPolicy(), nullptr);
+    EXPECT_FALSE(inOrderQueue.setWaitPolicy({std::chrono::milliseconds(1), 99}));
+    EXPECT_EQ(inOrderQueue.getWaitPolicy(), nullptr);
+}
+
+TEST_F(VPUDeviceTest, fullFirmwareQueueBlocksSubmitterUntilJobCompletes) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    std::vector<std::unique_ptr<VPUJob>> jobs;
+    for (size_t i = 0; i < 3; i++) {
+        auto job = std::make_unique<VPUJob>(ctx.get());
+        EXPECT_TRUE(job->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(job->closeCommands());
+        jobs.push_back(std::move(job));
+    }
+
+    EXPECT_TRUE(queue->submit(jobs[0].get()));
+    EXPECT_EQ(queue->getThrottleStats().count, 0u);
+
+    // Firmware queue is full with the first job, submitter blocks until the job completes
+    osInfc.mockBlockJobWait(true);
+    osInfc.mockBusyNextSubmits(1);
+    std::thread completer([this] {
+        osInfc.mockWaitForBlockedJobWait();
+        osInfc.mockBlockJobWait(false);
+    });
+    osInfc.callCntSubmit = 0;
+    EXPECT_TRUE(queue->submit(jobs[1].get()));
+    completer.join();
+    EXPECT_EQ(osInfc.callCntSubmit, 2u);
+    EXPECT_EQ(queue->getThrottleStats().count, 1u);
+    EXPECT_GT(queue->getThrottleStats().timeNs, 0u);
+    // Completion of the first job was observed by the queue
+    EXPECT_FALSE(jobs[0]->getCommandBuffers().front()->isSubmitted());
+    EXPECT_TRUE(jobs[1]->getCommandBuffers().front()->isSubmitted());
+
+    // Learned limit blocks the submitter without retrying submission
+    osInfc.mockBlockJobWait(true);
+    completer = std::thread([this] {
+        osInfc.mockWaitForBlockedJobWait();
+        osInfc.mockBlockJobWait(false);
+    });
+    osInfc.callCntSubmit = 0;
+    EXPECT_TRUE(queue->submit(jobs[2].get()));
+    completer.join();
+    EXPECT_EQ(osInfc.callCntSubmit, 1u);
+    EXPECT_EQ(queue->getThrottleStats().count, 2u);
+    EXPECT_FALSE(jobs[1]->getCommandBuffers().front()->isSubmitted());
+
+    for (auto &job : jobs)
+        EXPECT_TRUE(job->waitForCompletion(0));
+    jobs.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, inFlightLimitIsRaisedWhenProbingSubmissionIsAccepted) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    std::vector<std::unique_ptr<VPUJob>> jobs;
+    auto submitJob = [&]() {
+        auto job = std::make_unique<VPUJob>(ctx.get());
+        EXPECT_TRUE(job->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(job->closeCommands());
+        EXPECT_TRUE(queue->submit(job.get()));
+        jobs.push_back(std::move(job));
+    };
+    auto submitBlockedJob = [&]() {
+        osInfc.mockBlockJobWait(true);
+        std::thread completer([this] {
+            osInfc.mockWaitForBlockedJobWait();
+            osInfc.mockBlockJobWait(false);
+        });
+        submitJob();
+        completer.join();
+    };
+
+    // Firmware queue accepts a single job, limit is learned from the first busy submission
+    submitJob();
+    osInfc.mockBusyNextSubmits(1);
+    submitBlockedJob();
+    EXPECT_EQ(queue->getThrottleStats().count, 1u);
+
+    for (uint32_t i = 2; i < VPUDeviceQueue::inFlightLimitProbeInterval; i++)
+        submitBlockedJob();
+    EXPECT_EQ(queue->getThrottleStats().count, VPUDeviceQueue::inFlightLimitProbeInterval - 1);
+
+    // Submission is tried above the limit and firmware accepts it
+    osInfc.mockBlockJobWait(true);
+    osInfc.callCntSubmit = 0;
+    submitJob();
+    EXPECT_EQ(osInfc.callCntSubmit, 1u);
+    EXPECT_EQ(queue->getThrottleStats().count, VPUDeviceQueue::inFlightLimitProbeInterval - 1);
+
+    // Two jobs are in flight without throttling
+    osInfc.mockBlockJobWait(false);
+    submitJob();
+    osInfc.mockBlockJobWait(true);
+    submitJob();
+    EXPECT_EQ(queue->getThrottleStats().count, VPUDeviceQueue::inFlightLimitProbeInterval - 1);
+    osInfc.mockBlockJobWait(false);
+
+    for (auto &job : jobs)
+        EXPECT_TRUE(job->waitForCompletion(0));
+    jobs.clear();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, submissionRetriesBusyQueueWithoutTrackedJobs) {
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    auto job = std::make_unique<VPUJob>(ctx.get());
+    EXPECT_TRUE(job->appendCommand(
+        VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                    tsDest)));
+    EXPECT_TRUE(job->closeCommands());
+
+    osInfc.mockBusyNextSubmits(3);
+    osInfc.callCntSubmit = 0;
+    EXPECT_TRUE(queue->submit(job.get()));
+    EXPECT_EQ(osInfc.callCntSubmit, 4u);
+    EXPECT_EQ(queue->getThrottleStats().count, 1u);
+
+    EXPECT_TRUE(job->waitForCompletion(0));
+    job.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
+
+TEST_F(VPUDeviceTest, destroyingQueueDestroysItsCompletionStream) {
+    auto &service = ctx->getCompletionService();
+    size_t streamCount = service.getStreamCount();
+
+    int eventFd = queue->enableCompletionNotification(service);
+    ASSERT_GE(eventFd, 0);
+    EXPECT_EQ(queue->enableCompletionNotification(service), eventFd);
+    EXPECT_EQ(service.getStreamCount(), streamCount + 1);
+
+    queue.reset();
+    EXPECT_EQ(service.getStreamCount(), streamCount);
+    EXPECT_EQ(fcntl(eventFd, F_GETFD), -1);
+    EXPECT_EQ(errno, EBADF);
+}
+
+TEST_F(VPUDeviceTest, statusQueryOfTrackedJobSeesItFinishedBeforeServiceObservesIt) {
+    ASSERT_GE(queue->enableCompletionNotification(ctx->getCompletionService()), 0);
+
+    auto tsDest = ctx->createSharedMemAlloc(4096);
+    ASSERT_NE(nullptr, tsDest);
+
+    for (int i = 0; i < 10; i++) {
+        auto job = std::make_unique<VPUJob>(ctx.get());
+        EXPECT_TRUE(job->appendCommand(
+            VPUTimeStampCommand::create(reinterpret_cast<uint64_t *>(tsDest->getBasePointer()),
+                                        tsDest)));
+        EXPECT_TRUE(job->closeCommands());
+        EXPECT_TRUE(queue->submit(job.get()));
+        EXPECT_TRUE(job->waitForCompletion(0));
+    }
+
+    // Jobs not yet retired by the service thread are released with the stream
+    queue.reset();
+    EXPECT_TRUE(ctx->freeMemAlloc(tsDest->getBasePointer()));
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_metric_stream_reader.hpp"
+#include "vpu_driver/source/os_interface/vpu_driver_api.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace VPU;
+using namespace std::chrono_literals;
+
+struct VPUMetricStreamReaderTest : public ::testing::Test {
+    static constexpr size_t reportSize = 16;
+
+    void SetUp() override { ASSERT_NE(drvApi, nullptr); }
+
+    VPUMetricStreamReader::Config createConfig(size_t capacityReports) {
+        VPUMetricStreamReader::Config config;
+        config.groupMask = 0x1;
+        config.reportSize = reportSize;
+        config.capacityReports = capacityReports;
+        config.samplingPeriod = 1ms;
+        config.kernelReadPeriodReports = 16;
+        return config;
+    }
+
+    // Each report is filled with its sequence number
+    void produceReports(size_t count) {
+        std::vector<uint8_t> data(count * reportSize);
+        for (size_t i = 0; i < count; i++)
+            std::fill_n(data.begin() + i * reportSize, reportSize, nextReport++);
+        osInfc.mockMetricStreamerData(data);
+    }
+
+    void expectReports(const std::vector<uint8_t> &data, uint8_t firstReport) {
+        ASSERT_EQ(data.size() % reportSize, 0u);
+        for (size_t i = 0; i < data.size(); i++)
+            ASSERT_EQ(data[i], static_cast<uint8_t>(firstReport + i / reportSize)) << i;
+    }
+
+    int64_t absTimeoutNs(std::chrono::nanoseconds timeout) {
+        return (std::chrono::steady_clock::now().time_since_epoch() + timeout).count();
+    }
+
+    MockOsInterfaceImp osInfc;
+    std::unique_ptr<VPUDriverApi> drvApi = VPUDriverApi::openDriverApi("dev/node/fake", osInfc);
+    uint8_t nextReport = 0;
+};
+
+TEST_F(VPUMetricStreamReaderTest, readsWholeReportsAcrossRingWrap) {
+    VPUMetricStreamReader reader(*drvApi, createConfig(8));
+    EXPECT_EQ(reader.getCapacity(), 8 * reportSize);
+
+    produceReports(6);
+    EXPECT_EQ(reader.drain(), static_cast<int64_t>(6 * reportSize));
+    EXPECT_EQ(reader.getAvailableSize(), 6 * reportSize);
+
+    // Partial report is not returned
+    std::vector<uint8_t> data(4 * reportSize + reportSize / 2);
+    ASSERT_EQ(reader.read(data.data(), data.size()), 4 * reportSize);
+    data.resize(4 * reportSize);
+    expectReports(data, 0);
+
+    // Data is drained into the end of the ring and then from the beginning
+    produceReports(5);
+    EXPECT_EQ(reader.drain(), static_cast<int64_t>(5 * reportSize));
+    EXPECT_EQ(reader.getAvailableSize(), 7 * reportSize);
+
+    data.resize(7 * reportSize);
+    ASSERT_EQ(reader.read(data.data(), data.size()), 7 * reportSize);
+    expectReports(data, 4);
+    EXPECT_EQ(reader.getAvailableSize(), 0u);
+
+    auto stats = reader.getStats();
+    EXPECT_EQ(stats.overflowCount, 0u);
+    EXPECT_EQ(stats.droppedReports, 0u);
+}
+
+TEST_F(VPUMetricStreamReaderTest, fullRingDropsOldestReports) {
+    VPUMetricStreamReader reader(*drvApi, createConfig(8));
+
+    produceReports(10);
+    EXPECT_EQ(reader.drain(), static_cast<int64_t>(10 * reportSize));
+
+    auto stats = reader.getStats();
+    EXPECT_EQ(stats.overflowCount, 1u);
+    EXPECT_EQ(stats.droppedReports, 2u);
+
+    std::vector<uint8_t> data(8 * reportSize);
+    ASSERT_EQ(reader.read(data.data(), data.size()), 8 * reportSize);
+    expectReports(data, 2);
+}
+
+TEST_F(VPUMetricStreamReaderTest, readerThreadFillsRingAndWakesWaiter) {
+    VPUMetricStreamReader reader(*drvApi, createConfig(64));
+    reader.start();
+
+    EXPECT_FALSE(reader.waitForData(reportSize, absTimeoutNs(1ms)));
+
+    produceReports(16);
+    ASSERT_TRUE(reader.waitForData(16 * reportSize, absTimeoutNs(10s)));
+
+    // Buffered reports are read from ring without issuing ioctl
+    reader.stop();
+    std::vector<uint8_t> data(16 * reportSize);
+    uint32_t ioctlCount = osInfc.getMetricStreamerGetDataCount();
+    ASSERT_EQ(reader.read(data.data(), data.size()), 16 * reportSize);
+    expectReports(data, 0);
+    EXPECT_EQ(osInfc.getMetricStreamerGetDataCount(), ioctlCount);
+
+    EXPECT_FALSE(reader.waitForData(reportSize, absTimeoutNs(10s)));
+    EXPECT_FALSE(reader.hasFailed());
+}
+
+TEST_F(VPUMetricStreamReaderTest, pollIntervalAdaptsToDataRate) {
+    auto config = createConfig(64);
+    VPUMetricStreamReader reader(*drvApi, config);
+    auto nominal = reader.getPollInterval();
+    EXPECT_EQ(nominal, config.samplingPeriod * config.kernelReadPeriodReports / 4);
+
+    reader.start();
+    // Idle stream is polled less often
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    while (reader.getPollInterval() == nominal && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(reader.getPollInterval(), 2 * nominal);
+
+    // Burst of reports above the drain target speeds up polling
+    produceReports(config.kernelReadPeriodReports);
+    deadline = std::chrono::steady_clock::now() + 10s;
+    auto interval = reader.getPollInterval();
+    for (; interval == 2 * nominal && std::chrono::steady_clock::now() < deadline;
+         interval = reader.getPollInterval())
+        std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(interval, nominal);
+    reader.stop();
+}
+
+TEST_F(VPUMetricStreamReaderTest, failedIoctlStopsReaderAndWakesWaiter) {
+    VPUMetricStreamReader reader(*drvApi, createConfig(8));
+    osInfc.kmdIoctlRetCode = EINVAL;
+    EXPECT_EQ(reader.drain(), -1);
+    EXPECT_TRUE(reader.hasFailed());
+    EXPECT_FALSE(reader.waitForData(reportSize, absTimeoutNs(10s)));
+}
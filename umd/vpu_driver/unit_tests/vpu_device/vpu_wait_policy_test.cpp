@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// IWYU pragma: no_include <bits/chrono.h>
+
+#include <stdint.h>
+
+#include "gtest/gtest.h"
+#include "vpu_driver/source/device/vpu_wait_policy.hpp"
+
+#include <chrono>
+
+using namespace VPU;
+using namespace std::chrono_literals;
+
+struct VPUWaitPolicyTest : public ::testing::Test {
+    VPUWaitPolicy createPolicy(std::chrono::nanoseconds spinBudget, uint32_t percentile = 90) {
+        return VPUWaitPolicy({spinBudget, percentile}, [this] { return now; });
+    }
+
+    void recordJobs(VPUWaitPolicy &policy, std::chrono::nanoseconds duration, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            auto submitTime = now;
+            now += duration;
+            policy.recordCompletion(submitTime);
+        }
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::time_point(1s);
+};
+
+TEST_F(VPUWaitPolicyTest, spinsForBudgetUntilWarmedUp) {
+    auto policy = createPolicy(15ms);
+
+    recordJobs(policy, 100ms, VPUWaitPolicy::warmupSamples - 1);
+    EXPECT_EQ(policy.getExpectedDuration(), 0ns);
+
+    auto window = policy.getSpinWindow(now);
+    EXPECT_EQ(window.delay, 0ns);
+    EXPECT_EQ(window.duration, 15ms);
+
+    recordJobs(policy, 100ms, 1);
+    EXPECT_GE(policy.getExpectedDuration(), 100ms);
+}
+
+TEST_F(VPUWaitPolicyTest, spinsUntilExpectedCompletionOfShortJob) {
+    auto policy = createPolicy(15ms);
+    recordJobs(policy, 2ms, 32);
+
+    auto expected = policy.getExpectedDuration();
+    EXPECT_GE(expected, 2ms);
+    EXPECT_LT(expected, 3ms);
+
+    auto submitTime = now;
+    auto window = policy.getSpinWindow(submitTime);
+    EXPECT_EQ(window.delay, 0ns);
+    EXPECT_EQ(window.duration, expected);
+
+    now += 1ms;
+    window = policy.getSpinWindow(submitTime);
+    EXPECT_EQ(window.delay, 0ns);
+    EXPECT_EQ(window.duration, expected - 1ms);
+}
+
+TEST_F(VPUWaitPolicyTest, blocksUntilLongJobIsWithinSpinBudget) {
+    auto policy = createPolicy(5ms);
+    recordJobs(policy, 50ms, 32);
+
+    auto expected = policy.getExpectedDuration();
+    auto window = policy.getSpinWindow(now);
+    EXPECT_EQ(window.delay, expected - 5ms);
+    EXPECT_EQ(window.duration, 5ms);
+}
+
+TEST_F(VPUWaitPolicyTest, doesNotSpinForJobThatOverranExpectedDuration) {
+    auto policy = createPolicy(15ms);
+    recordJobs(policy, 2ms, 32);
+
+    auto submitTime = now;
+    now += 3ms;
+    auto window = policy.getSpinWindow(submitTime);
+    EXPECT_EQ(window.delay, 0ns);
+    EXPECT_EQ(window.duration, 0ns);
+}
+
+TEST_F(VPUWaitPolicyTest, zeroSpinBudgetNeverSpins) {
+    auto policy = createPolicy(0ns);
+    EXPECT_EQ(policy.getSpinWindow(now).duration, 0ns);
+
+    recordJobs(policy, 1ms, 32);
+    EXPECT_EQ(policy.getSpinWindow(now).duration, 0ns);
+}
+
+TEST_F(VPUWaitPolicyTest, expectedDurationFollowsPercentileTarget) {
+    auto median = createPolicy(15ms, 50);
+    auto tail = createPolicy(15ms, 90);
+    for (size_t i = 0; i < 20; i++) {
+        recordJobs(median, 1ms, 4);
+        recordJobs(median, 10ms, 1);
+        recordJobs(tail, 1ms, 4);
+        recordJobs(tail, 10ms, 1);
+    }
+
+    EXPECT_LT(median.getExpectedDuration(), 2ms);
+    EXPECT_GE(tail.getExpectedDuration(), 10ms);
+}
+
+TEST_F(VPUWaitPolicyTest, expectedDurationAdaptsToRecentJobs) {
+    auto policy = createPolicy(15ms);
+    recordJobs(policy, 50ms, 64);
+    EXPECT_GE(policy.getExpectedDuration(), 50ms);
+
+    recordJobs(policy, 1ms, 64);
+    EXPECT_LT(policy.getExpectedDuration(), 2ms);
+}
+
+TEST_F(VPUWaitPolicyTest, bucketUpperBoundCoversDuration) {
+    for (uint64_t durationNs : {0, 500, 1'000, 3'000, 1'000'000, 7'000'000, 1'000'000'000}) {
+        std::chrono::nanoseconds duration(durationNs);
+        size_t bucket = VPUWaitPolicy::toBucket(duration);
+        EXPECT_LT(bucket, VPUWaitPolicy::bucketCount);
+        EXPECT_GE(VPUWaitPolicy::toBucketUpperBound(bucket), duration);
+    }
+    EXPECT_EQ(VPUWaitPolicy::toBucket(1h), VPUWaitPolicy::bucketCount - 1);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Measures throughput of VPUDeviceContext::findBufferObject from multiple threads, while another
+// thread keeps allocating and freeing buffers, so lookups also refresh the buffer snapshot. The
+// benchmark runs on the mock device, so the numbers show only the driver side overhead.
+
+#include "vpu_driver/source/memory/vpu_buffer_object.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+int main(int argc, char *argv[]) {
+    uint32_t lookups = 200000;
+    uint32_t maxThreads = 8;
+    uint32_t bufferCount = 256;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "l:t:b:h")) != -1) {
+        switch (opt) {
+        case 'l':
+            lookups = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        case 't':
+            maxThreads = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        case 'b':
+            bufferCount = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        default:
+            printf("Usage: %s [-l lookups per thread] [-t max threads] [-b buffers]\n", argv[0]);
+            return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (lookups == 0 || maxThreads == 0 || bufferCount == 0) {
+        fprintf(stderr, "Number of lookups, threads and buffers has to be greater than 0\n");
+        return EXIT_FAILURE;
+    }
+
+    VPU::MockOsInterfaceImp osInfc;
+    auto device = VPU::MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
+    auto ctx = device->createMockDeviceContext();
+    if (ctx == nullptr) {
+        fprintf(stderr, "Failed to create device context\n");
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::shared_ptr<VPU::VPUBufferObject>> bos;
+    for (uint32_t i = 0; i < bufferCount; i++) {
+        auto bo = ctx->createHostMemAlloc(4096);
+        if (bo == nullptr) {
+            fprintf(stderr, "Failed to allocate buffer\n");
+            return EXIT_FAILURE;
+        }
+        bos.push_back(std::move(bo));
+    }
+
+    int ret = EXIT_SUCCESS;
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+        std::atomic<bool> stop = false;
+        std::atomic<uint64_t> mismatches = 0;
+
+        std::thread writer([&] {
+            while (!stop) {
+                auto bo = ctx->createHostMemAlloc(4096);
+                if (bo)
+                    ctx->freeMemAlloc(std::move(bo));
+            }
+        });
+
+        std::vector<std::thread> readers;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t t = 0; t < threads; t++) {
+            readers.emplace_back([&, t] {
+                for (uint32_t i = 0; i < lookups; i++) {
+                    auto &bo = bos[(i * 7 + t) % bufferCount];
+                    if (ctx->findBufferObject(bo->getBasePointer() + i % 4096) != bo)
+                        mismatches++;
+                }
+            });
+        }
+        for (auto &reader : readers)
+            reader.join();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        stop = true;
+        writer.join();
+
+        double us = std::chrono::duration<double, std::micro>(elapsed).count();
+        printf("threads: %2u, total: %10.1f us, lookups per us: %8.2f\n",
+               threads,
+               us,
+               static_cast<double>(threads) * lookups / us);
+        if (mismatches > 0) {
+            fprintf(stderr, "%lu lookups returned wrong buffer\n", mismatches.load());
+            ret = EXIT_FAILURE;
+        }
+    }
+
+    for (auto &bo : bos)
+        ctx->freeMemAlloc(std::move(bo));
+    return ret;
+}
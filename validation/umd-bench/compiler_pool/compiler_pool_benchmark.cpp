@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Measures the cost of Compiler::getCompiledBlob with pooled compiler handles against creating
+// and destroying a compiler handle for every compilation. The benchmark is linked with the stub
+// compiler library, so the numbers show only the driver side overhead.
+
+#include "level_zero_driver/source/ext/blob_container.hpp"
+#include "level_zero_driver/source/ext/compiler.hpp"
+#include "stub_vcl.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_os_interface_imp.hpp"
+#include "vpu_driver/unit_tests/mocks/mock_vpu_device.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+template <typename F>
+double runThreads(uint32_t threads, uint32_t iterations, F &&func) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < threads; t++) {
+        workers.emplace_back([&] {
+            for (uint32_t i = 0; i < iterations; i++)
+                func();
+        });
+    }
+    for (auto &worker : workers)
+        worker.join();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count();
+}
+
+void printResult(const char *name, double elapsedUs, uint32_t calls, uint64_t creates) {
+    printf("%-12s total: %10.1f us, per compilation: %8.1f us, vclCompilerCreate calls: %lu\n",
+           name,
+           elapsedUs,
+           elapsedUs / calls,
+           creates);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    uint32_t iterations = 100;
+    uint32_t threads = 1;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "i:t:h")) != -1) {
+        switch (opt) {
+        case 'i':
+            iterations = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        case 't':
+            threads = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        default:
+            printf("Usage: %s [-i iterations per thread] [-t threads]\n"
+                   "Set STUB_VCL_CREATE_COST_US to change the cost of vclCompilerCreate\n",
+                   argv[0]);
+            return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (iterations == 0 || threads == 0) {
+        fprintf(stderr, "Number of iterations and threads has to be greater than 0\n");
+        return EXIT_FAILURE;
+    }
+
+    VPU::MockOsInterfaceImp osInfc;
+    auto device = VPU::MockVPUDevice::createWithDefaultHardwareInfo(osInfc);
+    auto ctx = device->createMockDeviceContext();
+    if (ctx == nullptr) {
+        fprintf(stderr, "Failed to create device context\n");
+        return EXIT_FAILURE;
+    }
+
+    if (L0::Compiler::compilerInit(device.get()) != ZE_RESULT_SUCCESS) {
+        fprintf(stderr, "Failed to initialize compiler, check if stub compiler is loaded\n");
+        return EXIT_FAILURE;
+    }
+
+    const VPU::VPUHwInfo &hwInfo = ctx->getDeviceCapabilities();
+    uint32_t calls = iterations * threads;
+    uint64_t creates = stubVclCompilerCreateCount();
+
+    double elapsed = runThreads(threads, iterations, [&] {
+        vcl_compiler_handle_t compiler = nullptr;
+        vcl_log_handle_t logHandle = nullptr;
+        if (L0::Compiler::compilerCreate(hwInfo, compiler, logHandle) == ZE_RESULT_SUCCESS)
+            L0::Compiler::compilerDestroy(compiler);
+    });
+    printResult("create only", elapsed, calls, stubVclCompilerCreateCount() - creates);
+
+    const uint8_t model[64] = {};
+    creates = stubVclCompilerCreateCount();
+    elapsed = runThreads(threads, iterations, [&] {
+        ze_graph_desc_2_t desc = {};
+        desc.format = ZE_GRAPH_FORMAT_NGRAPH_LITE;
+        desc.inputSize = sizeof(model);
+        desc.pInput = model;
+        desc.pBuildFlags = "";
+
+        std::unique_ptr<L0::BlobContainer> blob;
+        std::string log;
+        if (L0::Compiler::getCompiledBlob(ctx.get(), desc, blob, log) != ZE_RESULT_SUCCESS) {
+            fprintf(stderr, "Failed to compile blob, log: %s\n", log.c_str());
+            exit(EXIT_FAILURE);
+        }
+    });
+    printResult("pooled", elapsed, calls, stubVclCompilerCreateCount() - creates);
+
+    return EXIT_SUCCESS;
+}
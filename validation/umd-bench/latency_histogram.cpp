@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+LatencyHistogram::LatencyHistogram(unsigned subBucketBits)
+    : subBucketBits(std::clamp(subBucketBits, 2u, 16u))
+    , subBucketCount(1ULL << this->subBucketBits)
+    , subBucketHalfCount(subBucketCount / 2) {
+    // Exact range followed by half sized ranges up to the highest bit of uint64_t
+    buckets.resize(subBucketCount + (64 - this->subBucketBits) * subBucketHalfCount);
+}
+
+size_t LatencyHistogram::getBucketIndex(uint64_t value) const {
+    if (value < subBucketCount)
+        return value;
+
+    unsigned highestBit = 63 - static_cast<unsigned>(__builtin_clzll(value));
+    unsigned shift = highestBit - subBucketBits + 1;
+    return subBucketCount + (shift - 1) * subBucketHalfCount + (value >> shift) -
+           subBucketHalfCount;
+}
+
+uint64_t LatencyHistogram::getBucketHighestValue(size_t index) const {
+    if (index < subBucketCount)
+        return index;
+
+    size_t range = (index - subBucketCount) / subBucketHalfCount;
+    uint64_t subBucket = (index - subBucketCount) % subBucketHalfCount + subBucketHalfCount;
+    unsigned shift = static_cast<unsigned>(range) + 1;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    buckets[getBucketIndex(value)]++;
+    count++;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+}
+
+void LatencyHistogram::reset() {
+    std::fill(buckets.begin(), buckets.end(), 0);
+    count = 0;
+    min = UINT64_MAX;
+    max = 0;
+    sum = 0;
+}
+
+uint64_t LatencyHistogram::getPercentile(double percentile) const {
+    if (count == 0)
+        return 0;
+
+    percentile = std::clamp(percentile, 0., 100.);
+    auto target = static_cast<uint64_t>(std::ceil(percentile / 100. * static_cast<double>(count)));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        total += buckets[i];
+        if (total >= target)
+            return std::min(getBucketHighestValue(i), max);
+    }
+    return max;
+}
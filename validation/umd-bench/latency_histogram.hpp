@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
+/**
+ * Log-linear latency histogram in the HdrHistogram style. Values below 2^subBucketBits are
+ * recorded exactly, above that every power of two range is split into 2^(subBucketBits - 1)
+ * linear buckets, so relative error of a recorded value is below 2^(1 - subBucketBits).
+ */
+class LatencyHistogram {
+  public:
+    explicit LatencyHistogram(unsigned subBucketBits = 8);
+
+    void record(uint64_t value);
+    void reset();
+
+    /* Return the highest value equivalent to the percentile, percentile in range (0, 100] */
+    uint64_t getPercentile(double percentile) const;
+    uint64_t getCount() const { return count; }
+    uint64_t getMin() const { return count ? min : 0; }
+    uint64_t getMax() const { return max; }
+    double getMean() const { return count ? static_cast<double>(sum) / count : 0.; }
+
+  private:
+    size_t getBucketIndex(uint64_t value) const;
+    uint64_t getBucketHighestValue(size_t index) const;
+
+    unsigned subBucketBits;
+    uint64_t subBucketCount;
+    uint64_t subBucketHalfCount;
+    std::vector<uint64_t> buckets;
+
+    uint64_t count = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    /* Sum of values in nanoseconds overflows after 584 years of measurements */
+    uint64_t sum = 0;
+};
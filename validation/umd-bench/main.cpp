@@ -0,0 +1,558 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+/*
+ * Host side latency of Level Zero API calls. By default the benchmark runs against the null
+ * device, so the driver CPU overhead can be measured on any Linux machine without NPU.
+ */
+
+#include "latency_histogram.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <getopt.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <ze_api.h>
+#include <ze_graph_ext.h>
+
+namespace {
+
+constexpr const char *defaultPlatform = "LUNARLAKE";
+
+struct Options {
+    uint32_t iterations = 10000;
+    uint32_t warmup = 100;
+    size_t size = 4096;
+    std::string platform;
+    std::string blobPath;
+    std::string jsonPath;
+    std::string filter;
+
+    bool isJsonOnStdout() const { return jsonPath == "-"; }
+    /* Keep stdout parseable when JSON is written there */
+    FILE *getTextOut() const { return isJsonOnStdout() ? stderr : stdout; }
+};
+
+void printHelp(const char *name) {
+    printf("Usage: %s [OPTIONS]\n\n"
+           "Options:\n"
+           "  -i/--iterations <n>   Measured iterations of each benchmark (default: 10000)\n"
+           "  -w/--warmup <n>       Iterations run before measurement (default: 100)\n"
+           "  -s/--size <bytes>     Size of allocations and copies (default: 4096)\n"
+           "  -p/--platform <name>  Null device platform, sets ZE_INTEL_NPU_PLATFORM_OVERRIDE\n"
+           "                        (default: %s when the variable is not set)\n"
+           "  -b/--blob <path>      Compiled blob used by graph and mutable benchmarks, skipped\n"
+           "                        when not set\n"
+           "  -f/--filter <group>   Run one group: memory, cmdlist, submit, graph, mutable\n"
+           "  -j/--json <path>      Write results in JSON format, '-' writes to stdout\n"
+           "  -h/--help             Print this help message\n",
+           name,
+           defaultPlatform);
+}
+
+bool parseOptions(int argc, char **argv, Options &options) {
+    static struct option longOptions[] = {{"iterations", required_argument, 0, 'i'},
+                                          {"warmup", required_argument, 0, 'w'},
+                                          {"size", required_argument, 0, 's'},
+                                          {"platform", required_argument, 0, 'p'},
+                                          {"blob", required_argument, 0, 'b'},
+                                          {"filter", required_argument, 0, 'f'},
+                                          {"json", required_argument, 0, 'j'},
+                                          {"help", no_argument, 0, 'h'},
+                                          {}};
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "i:w:s:p:b:f:j:h", longOptions, nullptr)) != -1) {
+        switch (opt) {
+        case 'i':
+            options.iterations = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 'w':
+            options.warmup = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+        case 's':
+            options.size = strtoul(optarg, nullptr, 0);
+            break;
+        case 'p':
+            options.platform = optarg;
+            break;
+        case 'b':
+            options.blobPath = optarg;
+            break;
+        case 'f':
+            options.filter = optarg;
+            break;
+        case 'j':
+            options.jsonPath = optarg;
+            break;
+        default:
+            printHelp(argv[0]);
+            return false;
+        }
+    }
+
+    if (options.iterations == 0 || options.size == 0) {
+        fprintf(stderr, "Number of iterations and size have to be greater than 0\n");
+        return false;
+    }
+    return true;
+}
+
+void check(ze_result_t result, const char *call) {
+    if (result != ZE_RESULT_SUCCESS)
+        throw std::runtime_error(std::string(call) + " failed with result " +
+                                 std::to_string(result));
+}
+
+class Recorder {
+  public:
+    /* Time single API call, the result is recorded only outside of warmup */
+    template <typename Call>
+    void measure(const char *name, Call &&call) {
+        auto start = std::chrono::steady_clock::now();
+        ze_result_t result = call();
+        auto end = std::chrono::steady_clock::now();
+
+        check(result, name);
+        if (recording)
+            getHistogram(name).record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    void setRecording(bool enable) { recording = enable; }
+    const std::vector<std::pair<std::string, LatencyHistogram>> &getResults() const {
+        return results;
+    }
+
+  private:
+    LatencyHistogram &getHistogram(const char *name) {
+        for (auto &[resultName, histogram] : results) {
+            if (resultName == name)
+                return histogram;
+        }
+        return results.emplace_back(name, LatencyHistogram()).second;
+    }
+
+    bool recording = false;
+    std::vector<std::pair<std::string, LatencyHistogram>> results;
+};
+
+class Benchmark {
+  public:
+    explicit Benchmark(const Options &options)
+        : options(options) {}
+
+    ~Benchmark() {
+        if (context)
+            zeContextDestroy(context);
+    }
+
+    void init() {
+        check(zeInit(ZE_INIT_FLAG_VPU_ONLY), "zeInit");
+
+        uint32_t driverCount = 0;
+        check(zeDriverGet(&driverCount, nullptr), "zeDriverGet");
+        std::vector<ze_driver_handle_t> drivers(driverCount);
+        check(zeDriverGet(&driverCount, drivers.data()), "zeDriverGet");
+
+        for (auto drv : drivers) {
+            uint32_t deviceCount = 1;
+            ze_device_handle_t dev = nullptr;
+            if (zeDeviceGet(drv, &deviceCount, &dev) != ZE_RESULT_SUCCESS || dev == nullptr)
+                continue;
+
+            ze_device_properties_t properties = {};
+            properties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+            check(zeDeviceGetProperties(dev, &properties), "zeDeviceGetProperties");
+            if (properties.type == ZE_DEVICE_TYPE_VPU) {
+                driver = drv;
+                device = dev;
+                break;
+            }
+        }
+        if (device == nullptr)
+            throw std::runtime_error("NPU device not found");
+
+        ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+        check(zeContextCreate(driver, &contextDesc, &context), "zeContextCreate");
+        check(zeDriverGetExtensionFunctionAddress(driver,
+                                                  ZE_GRAPH_EXT_NAME,
+                                                  reinterpret_cast<void **>(&graphDdi)),
+              "zeDriverGetExtensionFunctionAddress");
+    }
+
+    /* Create objects reused by iterations of cmdlist, submit and graph benchmarks */
+    void setUp() {
+        ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC, nullptr, 0};
+        ze_device_mem_alloc_desc_t deviceDesc =
+            {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC, nullptr, 0, 0};
+        check(zeMemAllocHost(context, &hostDesc, options.size, 0, &srcBuffer), "zeMemAllocHost");
+        check(zeMemAllocDevice(context, &deviceDesc, options.size, 0, device, &dstBuffer),
+              "zeMemAllocDevice");
+
+        ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC,
+                                             nullptr,
+                                             0,
+                                             0,
+                                             0,
+                                             ZE_COMMAND_QUEUE_MODE_DEFAULT,
+                                             ZE_COMMAND_QUEUE_PRIORITY_NORMAL};
+        check(zeCommandQueueCreate(context, device, &queueDesc, &queue), "zeCommandQueueCreate");
+
+        ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0};
+        check(zeCommandListCreate(context, device, &listDesc, &closedList), "zeCommandListCreate");
+        check(zeCommandListAppendMemoryCopy(closedList,
+                                            dstBuffer,
+                                            srcBuffer,
+                                            options.size,
+                                            nullptr,
+                                            0,
+                                            nullptr),
+              "zeCommandListAppendMemoryCopy");
+        check(zeCommandListClose(closedList), "zeCommandListClose");
+
+        ze_fence_desc_t fenceDesc = {ZE_STRUCTURE_TYPE_FENCE_DESC, nullptr, 0};
+        check(zeFenceCreate(queue, &fenceDesc, &fence), "zeFenceCreate");
+
+        if (!options.blobPath.empty()) {
+            loadBlob();
+            setUpMutableGraph();
+        }
+    }
+
+    void tearDown() {
+        if (mutableList)
+            zeCommandListDestroy(mutableList);
+        if (mutableGraph)
+            graphDdi->pfnDestroy(mutableGraph);
+        for (void *ptr : graphArgs)
+            zeMemFree(context, ptr);
+        if (fence)
+            zeFenceDestroy(fence);
+        if (closedList)
+            zeCommandListDestroy(closedList);
+        if (queue)
+            zeCommandQueueDestroy(queue);
+        if (dstBuffer)
+            zeMemFree(context, dstBuffer);
+        if (srcBuffer)
+            zeMemFree(context, srcBuffer);
+    }
+
+    void run(Recorder &recorder) {
+        runGroup("memory", recorder, [this](Recorder &r) { memory(r); });
+        runGroup("cmdlist", recorder, [this](Recorder &r) { commandList(r); });
+        runGroup("submit", recorder, [this](Recorder &r) { submit(r); });
+        if (!options.blobPath.empty())
+            runGroup("graph", recorder, [this](Recorder &r) { graph(r); });
+        if (mutableList)
+            runGroup("mutable", recorder, [this](Recorder &r) { mutableGraphArgument(r); });
+    }
+
+  private:
+    template <typename Group>
+    void runGroup(const char *name, Recorder &recorder, Group &&group) {
+        if (!options.filter.empty() && options.filter != name)
+            return;
+
+        fprintf(options.getTextOut(), "Running %s benchmarks\n", name);
+        recorder.setRecording(false);
+        for (uint32_t i = 0; i < options.warmup; i++)
+            group(recorder);
+
+        recorder.setRecording(true);
+        for (uint32_t i = 0; i < options.iterations; i++)
+            group(recorder);
+        recorder.setRecording(false);
+    }
+
+    void memory(Recorder &recorder) {
+        ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC, nullptr, 0};
+        ze_device_mem_alloc_desc_t deviceDesc =
+            {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC, nullptr, 0, 0};
+        void *ptr = nullptr;
+
+        recorder.measure("zeMemAllocHost", [&] {
+            return zeMemAllocHost(context, &hostDesc, options.size, 0, &ptr);
+        });
+        recorder.measure("zeMemFree (host)", [&] { return zeMemFree(context, ptr); });
+
+        recorder.measure("zeMemAllocDevice", [&] {
+            return zeMemAllocDevice(context, &deviceDesc, options.size, 0, device, &ptr);
+        });
+        recorder.measure("zeMemFree (device)", [&] { return zeMemFree(context, ptr); });
+
+        recorder.measure("zeMemAllocShared", [&] {
+            return zeMemAllocShared(context, &deviceDesc, &hostDesc, options.size, 0, device, &ptr);
+        });
+        recorder.measure("zeMemFree (shared)", [&] { return zeMemFree(context, ptr); });
+    }
+
+    void commandList(Recorder &recorder) {
+        ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, nullptr, 0, 0};
+        ze_command_list_handle_t list = nullptr;
+
+        recorder.measure("zeCommandListCreate",
+                         [&] { return zeCommandListCreate(context, device, &listDesc, &list); });
+        recorder.measure("zeCommandListAppendMemoryCopy", [&] {
+            return zeCommandListAppendMemoryCopy(list,
+                                                 dstBuffer,
+                                                 srcBuffer,
+                                                 options.size,
+                                                 nullptr,
+                                                 0,
+                                                 nullptr);
+        });
+        recorder.measure("zeCommandListAppendBarrier",
+                         [&] { return zeCommandListAppendBarrier(list, nullptr, 0, nullptr); });
+        recorder.measure("zeCommandListClose", [&] { return zeCommandListClose(list); });
+        recorder.measure("zeCommandListDestroy", [&] { return zeCommandListDestroy(list); });
+    }
+
+    void submit(Recorder &recorder) {
+        recorder.measure("zeCommandQueueExecuteCommandLists", [&] {
+            return zeCommandQueueExecuteCommandLists(queue, 1, &closedList, fence);
+        });
+        recorder.measure("zeFenceHostSynchronize",
+                         [&] { return zeFenceHostSynchronize(fence, UINT64_MAX); });
+        recorder.measure("zeFenceReset", [&] { return zeFenceReset(fence); });
+    }
+
+    void graph(Recorder &recorder) {
+        ze_graph_handle_t graph = nullptr;
+
+        recorder.measure("pfnCreate2 (native blob)", [&] {
+            return graphDdi->pfnCreate2(context, device, &graphDesc, &graph);
+        });
+        recorder.measure("pfnDestroy (graph)", [&] { return graphDdi->pfnDestroy(graph); });
+    }
+
+    /*
+     * Swap the first graph argument between two buffers in every iteration. Submission applies the
+     * update, so its latency shows the cost of relocating the changed argument.
+     */
+    void mutableGraphArgument(Recorder &recorder) {
+        swapArgument = graphArgs[swapArgument == graphArgs[0] ? graphArgs.size() - 1 : 0];
+        ze_mutable_graph_argument_exp_desc_t argumentDesc = {
+            ZE_STRUCTURE_TYPE_MUTABLE_GRAPH_ARGUMENT_EXP_DESC,
+            nullptr,
+            mutableCommandId,
+            0,
+            swapArgument};
+        ze_mutable_commands_exp_desc_t commandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC,
+                                                       &argumentDesc,
+                                                       0};
+
+        recorder.measure("zeCommandListUpdateMutableCommandsExp", [&] {
+            return zeCommandListUpdateMutableCommandsExp(mutableList, &commandsDesc);
+        });
+        recorder.measure("zeCommandListClose (mutable)",
+                         [&] { return zeCommandListClose(mutableList); });
+        recorder.measure("zeCommandQueueExecuteCommandLists (mutable)", [&] {
+            return zeCommandQueueExecuteCommandLists(queue, 1, &mutableList, fence);
+        });
+        check(zeFenceHostSynchronize(fence, UINT64_MAX), "zeFenceHostSynchronize");
+        check(zeFenceReset(fence), "zeFenceReset");
+    }
+
+    /* Create graph with all arguments allocated and mutable command list that executes it */
+    void setUpMutableGraph() {
+        check(graphDdi->pfnCreate2(context, device, &graphDesc, &mutableGraph), "pfnCreate2");
+
+        ze_graph_properties_t properties = {};
+        properties.stype = ZE_STRUCTURE_TYPE_GRAPH_PROPERTIES;
+        check(graphDdi->pfnGetProperties(mutableGraph, &properties), "pfnGetProperties");
+
+        ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC, nullptr, 0};
+        ze_device_mem_alloc_desc_t deviceDesc =
+            {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC, nullptr, 0, 0};
+        // The extra argument buffer replaces the first argument in mutable benchmark
+        for (uint32_t i = 0; i <= properties.numGraphArgs; i++) {
+            ze_graph_argument_properties_t argProperties = {};
+            argProperties.stype = ZE_STRUCTURE_TYPE_GRAPH_ARGUMENT_PROPERTIES;
+            check(graphDdi->pfnGetArgumentProperties(mutableGraph,
+                                                     i < properties.numGraphArgs ? i : 0,
+                                                     &argProperties),
+                  "pfnGetArgumentProperties");
+
+            // Buffers are allocated for the widest precision, the content is not checked
+            size_t size = sizeof(uint64_t);
+            for (uint32_t dim = 0; dim < ZE_MAX_GRAPH_ARGUMENT_DIMENSIONS_SIZE; dim++)
+                size *= argProperties.dims[dim];
+
+            void *ptr = nullptr;
+            check(zeMemAllocShared(context, &deviceDesc, &hostDesc, size, 0, device, &ptr),
+                  "zeMemAllocShared");
+            graphArgs.push_back(ptr);
+            if (i < properties.numGraphArgs)
+                check(graphDdi->pfnSetArgumentValue(mutableGraph, i, ptr), "pfnSetArgumentValue");
+        }
+        swapArgument = graphArgs[0];
+
+        ze_mutable_command_list_exp_desc_t mutableDesc = {
+            ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_DESC,
+            nullptr,
+            0};
+        ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, &mutableDesc, 0, 0};
+        check(zeCommandListCreate(context, device, &listDesc, &mutableList), "zeCommandListCreate");
+
+        ze_mutable_command_id_exp_desc_t commandIdDesc = {
+            ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC,
+            nullptr,
+            ZE_MUTABLE_COMMAND_EXP_FLAG_GRAPH_ARGUMENTS};
+        check(zeCommandListGetNextCommandIdExp(mutableList, &commandIdDesc, &mutableCommandId),
+              "zeCommandListGetNextCommandIdExp");
+        check(graphDdi->pfnAppendGraphExecute(mutableList,
+                                              mutableGraph,
+                                              nullptr,
+                                              nullptr,
+                                              0,
+                                              nullptr),
+              "pfnAppendGraphExecute");
+        check(zeCommandListClose(mutableList), "zeCommandListClose");
+    }
+
+    void loadBlob() {
+        std::ifstream file(options.blobPath, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("Failed to open blob " + options.blobPath);
+
+        blob.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        graphDesc.stype = ZE_STRUCTURE_TYPE_GRAPH_DESC_2;
+        graphDesc.format = ZE_GRAPH_FORMAT_NATIVE;
+        graphDesc.inputSize = blob.size();
+        graphDesc.pInput = reinterpret_cast<const uint8_t *>(blob.data());
+        graphDesc.pBuildFlags = nullptr;
+        graphDesc.flags = ZE_GRAPH_FLAG_NONE;
+    }
+
+    const Options &options;
+    ze_driver_handle_t driver = nullptr;
+    ze_device_handle_t device = nullptr;
+    ze_context_handle_t context = nullptr;
+    ze_graph_dditable_ext_t *graphDdi = nullptr;
+
+    void *srcBuffer = nullptr;
+    void *dstBuffer = nullptr;
+    ze_command_queue_handle_t queue = nullptr;
+    ze_command_list_handle_t closedList = nullptr;
+    ze_fence_handle_t fence = nullptr;
+
+    std::vector<char> blob;
+    ze_graph_desc_2_t graphDesc = {};
+
+    ze_graph_handle_t mutableGraph = nullptr;
+    ze_command_list_handle_t mutableList = nullptr;
+    uint64_t mutableCommandId = 0;
+    std::vector<void *> graphArgs;
+    void *swapArgument = nullptr;
+};
+
+void printResults(const Recorder &recorder) {
+    printf("\n%-36s %10s %10s %10s %10s %10s %10s %10s\n",
+           "Benchmark [ns]",
+           "count",
+           "min",
+           "p50",
+           "p99",
+           "p999",
+           "max",
+           "mean");
+    for (const auto &[name, histogram] : recorder.getResults()) {
+        printf("%-36s %10lu %10lu %10lu %10lu %10lu %10lu %10.0f\n",
+               name.c_str(),
+               histogram.getCount(),
+               histogram.getMin(),
+               histogram.getPercentile(50.),
+               histogram.getPercentile(99.),
+               histogram.getPercentile(99.9),
+               histogram.getMax(),
+               histogram.getMean());
+    }
+}
+
+bool writeJson(const Recorder &recorder, const Options &options, const char *platform) {
+    FILE *out = options.isJsonOnStdout() ? stdout : fopen(options.jsonPath.c_str(), "w");
+    if (out == nullptr) {
+        fprintf(stderr, "Failed to open %s\n", options.jsonPath.c_str());
+        return false;
+    }
+
+    fprintf(out,
+            "{\n  \"platform\": \"%s\",\n  \"iterations\": %u,\n  \"warmup\": %u,\n"
+            "  \"size\": %zu,\n  \"unit\": \"ns\",\n  \"benchmarks\": [",
+            platform,
+            options.iterations,
+            options.warmup,
+            options.size);
+
+    const char *separator = "\n";
+    for (const auto &[name, histogram] : recorder.getResults()) {
+        fprintf(out,
+                "%s    {\"name\": \"%s\", \"count\": %lu, \"min\": %lu, \"p50\": %lu, "
+                "\"p99\": %lu, \"p999\": %lu, \"max\": %lu, \"mean\": %.1f}",
+                separator,
+                name.c_str(),
+                histogram.getCount(),
+                histogram.getMin(),
+                histogram.getPercentile(50.),
+                histogram.getPercentile(99.),
+                histogram.getPercentile(99.9),
+                histogram.getMax(),
+                histogram.getMean());
+        separator = ",\n";
+    }
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return 1;
+
+    // Null device has to be selected before the driver is loaded
+    if (!options.platform.empty())
+        setenv("ZE_INTEL_NPU_PLATFORM_OVERRIDE", options.platform.c_str(), 1);
+    else
+        setenv("ZE_INTEL_NPU_PLATFORM_OVERRIDE", defaultPlatform, 0);
+    const char *platform = getenv("ZE_INTEL_NPU_PLATFORM_OVERRIDE");
+    fprintf(options.getTextOut(), "Null device platform: %s\n", platform);
+
+    Recorder recorder;
+    try {
+        Benchmark benchmark(options);
+        benchmark.init();
+        benchmark.setUp();
+        try {
+            benchmark.run(recorder);
+        } catch (...) {
+            benchmark.tearDown();
+            throw;
+        }
+        benchmark.tearDown();
+    } catch (const std::exception &e) {
+        fprintf(stderr, "Benchmark failed: %s\n", e.what());
+        return 1;
+    }
+
+    if (!options.isJsonOnStdout())
+        printResults(recorder);
+    if (!options.jsonPath.empty() && !writeJson(recorder, options, platform))
+        return 1;
+    return 0;
+}
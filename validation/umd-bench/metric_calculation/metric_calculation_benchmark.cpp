@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+// Measures MetricGroup::calculateMetricValues over synthetic raw streamer buffers. The metric
+// groups are built from layouts in the same way as Device::loadMetricGroupsInfo does, so no
+// device is needed. The decoder is compared with the per value decoding that queries metric
+// properties for every value.
+
+#include "level_zero_driver/source/metric.hpp"
+#include "vpu_driver/source/device/metric_info.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <memory>
+#include <random>
+#include <string.h>
+#include <vector>
+
+namespace {
+
+using ValueType = VPU::CounterInfo::ValueType;
+
+VPU::GroupInfo createGroupInfo(const char *name, const std::vector<ValueType> &valueTypes) {
+    VPU::GroupInfo groupInfo = {};
+    groupInfo.metricGroupName = name;
+    groupInfo.metricCount = static_cast<uint32_t>(valueTypes.size());
+    for (size_t i = 0; i < valueTypes.size(); i++) {
+        VPU::CounterInfo counter = {};
+        counter.metricType = VPU::CounterInfo::MetricType::METRIC_TYPE_EVENT;
+        counter.valueType = valueTypes[i];
+        counter.metricName = std::string(name) + "_" + std::to_string(i);
+        groupInfo.counterInfo.push_back(counter);
+    }
+    return groupInfo;
+}
+
+std::unique_ptr<L0::MetricGroup>
+createMetricGroup(const VPU::GroupInfo &groupInfo,
+                  std::vector<std::shared_ptr<L0::Metric>> &metrics) {
+    zet_metric_group_properties_t groupProperties = {};
+    groupProperties.stype = ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES;
+    groupProperties.metricCount = groupInfo.metricCount;
+
+    size_t allocationSize = 0u;
+    for (const auto &counter : groupInfo.counterInfo) {
+        zet_metric_properties_t properties = {};
+        properties.stype = ZET_STRUCTURE_TYPE_METRIC_PROPERTIES;
+        strncpy(properties.name, counter.metricName.c_str(), ZET_MAX_METRIC_NAME - 1);
+        properties.metricType = L0::Metric::getMetricType(counter.metricType);
+        properties.resultType = L0::Metric::getValueType(counter.valueType);
+
+        allocationSize += L0::Metric::getMetricValueSize(counter.valueType);
+        metrics.push_back(std::make_shared<L0::Metric>(properties));
+    }
+
+    return std::make_unique<L0::MetricGroup>(groupProperties, allocationSize, metrics, 0, 1);
+}
+
+// Decoding that was used before the metric group cached its layout
+void calculatePerValue(const std::vector<std::shared_ptr<L0::Metric>> &metrics,
+                       size_t allocationSize,
+                       const uint8_t *pRawData,
+                       size_t valueCount,
+                       zet_typed_value_t *pValues) {
+    for (size_t i = 0; i < valueCount; i++) {
+        zet_metric_properties_t properties = {};
+        metrics[i % metrics.size()]->getProperties(&properties);
+
+        pValues[i].type = properties.resultType;
+        switch (properties.resultType) {
+        case ZET_VALUE_TYPE_UINT32:
+            memcpy(&pValues[i].value.ui32, pRawData, sizeof(uint32_t));
+            break;
+        case ZET_VALUE_TYPE_UINT64:
+            memcpy(&pValues[i].value.ui64, pRawData, sizeof(uint64_t));
+            break;
+        case ZET_VALUE_TYPE_FLOAT32:
+            memcpy(&pValues[i].value.fp32, pRawData, sizeof(float));
+            break;
+        case ZET_VALUE_TYPE_FLOAT64:
+            memcpy(&pValues[i].value.fp64, pRawData, sizeof(double));
+            break;
+        case ZET_VALUE_TYPE_BOOL8:
+            pValues[i].value.b8 = *pRawData;
+            break;
+        default:
+            break;
+        }
+        pRawData += allocationSize / metrics.size();
+    }
+}
+
+template <typename F>
+double measureUs(uint32_t iterations, F &&func) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+        func();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    uint32_t iterations = 10;
+    size_t reportCount = 100000;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "i:r:h")) != -1) {
+        switch (opt) {
+        case 'i':
+            iterations = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+            break;
+        case 'r':
+            reportCount = strtoul(optarg, nullptr, 10);
+            break;
+        default:
+            printf("Usage: %s [-i iterations] [-r reports in raw buffer]\n", argv[0]);
+            return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (iterations == 0 || reportCount == 0) {
+        fprintf(stderr, "Number of iterations and reports has to be greater than 0\n");
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<VPU::GroupInfo> layouts = {
+        createGroupInfo("NOC", {ValueType::VALUE_TYPE_UINT64}),
+        createGroupInfo("DDR", std::vector<ValueType>(4, ValueType::VALUE_TYPE_UINT64)),
+        createGroupInfo("L2_CACHE", std::vector<ValueType>(16, ValueType::VALUE_TYPE_UINT64)),
+        createGroupInfo("MIXED",
+                        {ValueType::VALUE_TYPE_UINT32,
+                         ValueType::VALUE_TYPE_FLOAT32,
+                         ValueType::VALUE_TYPE_UINT32,
+                         ValueType::VALUE_TYPE_FLOAT32}),
+    };
+
+    std::mt19937_64 random(0);
+    printf("%-10s %8s %12s %16s %16s %16s\n",
+           "group",
+           "metrics",
+           "raw [KiB]",
+           "per value [us]",
+           "values [us]",
+           "max values [us]");
+
+    for (const auto &layout : layouts) {
+        std::vector<std::shared_ptr<L0::Metric>> metrics;
+        auto metricGroup = createMetricGroup(layout, metrics);
+
+        std::vector<uint8_t> rawData(reportCount * metricGroup->getAllocationSize());
+        std::generate(rawData.begin(), rawData.end(), [&] {
+            return static_cast<uint8_t>(random());
+        });
+
+        uint32_t valueCount = 0;
+        metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                           rawData.size(),
+                                           rawData.data(),
+                                           &valueCount,
+                                           nullptr);
+        std::vector<zet_typed_value_t> values(valueCount);
+        std::vector<zet_typed_value_t> reference(valueCount);
+
+        double perValueUs = measureUs(iterations, [&] {
+            calculatePerValue(metrics,
+                              metricGroup->getAllocationSize(),
+                              rawData.data(),
+                              reference.size(),
+                              reference.data());
+        });
+
+        double valuesUs = measureUs(iterations, [&] {
+            uint32_t count = 0;
+            metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                               rawData.size(),
+                                               rawData.data(),
+                                               &count,
+                                               nullptr);
+            metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                               rawData.size(),
+                                               rawData.data(),
+                                               &count,
+                                               values.data());
+        });
+
+        for (size_t i = 0; i < values.size(); i++) {
+            auto valueType = layout.counterInfo[i % layout.metricCount].valueType;
+            if (values[i].type != reference[i].type ||
+                memcmp(&values[i].value,
+                       &reference[i].value,
+                       L0::Metric::getMetricValueSize(valueType)) != 0) {
+                fprintf(stderr, "Group %s: value %lu differs\n", layout.metricGroupName.c_str(), i);
+                return EXIT_FAILURE;
+            }
+        }
+
+        std::vector<zet_typed_value_t> maxValues(layout.metricCount);
+        double maxValuesUs = measureUs(iterations, [&] {
+            uint32_t count = layout.metricCount;
+            metricGroup->calculateMetricValues(ZET_METRIC_GROUP_CALCULATION_TYPE_MAX_METRIC_VALUES,
+                                               rawData.size(),
+                                               rawData.data(),
+                                               &count,
+                                               maxValues.data());
+        });
+
+        printf("%-10s %8u %12.1f %16.1f %16.1f %16.1f\n",
+               layout.metricGroupName.c_str(),
+               layout.metricCount,
+               static_cast<double>(rawData.size()) / 1024,
+               perValueUs,
+               valuesUs,
+               maxValuesUs);
+    }
+
+    return EXIT_SUCCESS;
+}
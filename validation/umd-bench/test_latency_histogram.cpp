@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "latency_histogram.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+TEST(LatencyHistogram, emptyHistogramReportsZero) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.getCount(), 0u);
+    EXPECT_EQ(histogram.getMin(), 0u);
+    EXPECT_EQ(histogram.getMax(), 0u);
+    EXPECT_EQ(histogram.getMean(), 0.);
+    EXPECT_EQ(histogram.getPercentile(50.), 0u);
+}
+
+TEST(LatencyHistogram, valuesInExactRangeAreRecordedExactly) {
+    LatencyHistogram histogram(8);
+    for (uint64_t value = 1; value <= 200; value++)
+        histogram.record(value);
+
+    EXPECT_EQ(histogram.getCount(), 200u);
+    EXPECT_EQ(histogram.getMin(), 1u);
+    EXPECT_EQ(histogram.getMax(), 200u);
+    EXPECT_EQ(histogram.getMean(), 100.5);
+    EXPECT_EQ(histogram.getPercentile(50.), 100u);
+    EXPECT_EQ(histogram.getPercentile(99.), 198u);
+    EXPECT_EQ(histogram.getPercentile(99.9), 200u);
+    EXPECT_EQ(histogram.getPercentile(100.), 200u);
+}
+
+TEST(LatencyHistogram, valuesAboveExactRangeShareLinearBuckets) {
+    // Exact range is 0-3, then every power of two range is split into two buckets
+    LatencyHistogram histogram(2);
+    histogram.record(4);
+    histogram.record(8);
+    histogram.record(12);
+    histogram.record(13);
+
+    EXPECT_EQ(histogram.getPercentile(25.), 5u);
+    EXPECT_EQ(histogram.getPercentile(50.), 11u);
+    // 12 and 13 fall into bucket 12-15 that is capped by the highest recorded value
+    EXPECT_EQ(histogram.getPercentile(75.), 13u);
+    EXPECT_EQ(histogram.getPercentile(100.), 13u);
+}
+
+TEST(LatencyHistogram, percentileIsWithinRelativeErrorOfRecordedValue) {
+    const uint64_t values[] = {300, 1000, 123456789, 1ull << 40, UINT64_MAX - 1};
+    for (uint64_t value : values) {
+        LatencyHistogram histogram(8);
+        histogram.record(value);
+        histogram.record(UINT64_MAX);
+
+        uint64_t p50 = histogram.getPercentile(50.);
+        EXPECT_GE(p50, value);
+        EXPECT_LE(p50 - value, value >> 7) << "value: " << value;
+    }
+}
+
+TEST(LatencyHistogram, resetClearsRecordedValues) {
+    LatencyHistogram histogram;
+    histogram.record(1000);
+    histogram.reset();
+
+    EXPECT_EQ(histogram.getCount(), 0u);
+    EXPECT_EQ(histogram.getPercentile(100.), 0u);
+
+    histogram.record(10);
+    EXPECT_EQ(histogram.getMin(), 10u);
+    EXPECT_EQ(histogram.getMax(), 10u);
+    EXPECT_EQ(histogram.getPercentile(50.), 10u);
+}
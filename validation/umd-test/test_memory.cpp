@@ -290,7 +290,7 @@ TEST_F(MemoryExecution, CheckQueryContextMemory) {
     EXPECT_GT(memAllocated.allocated, userAllocatedMem);
 }
 
-enum CopyDimension { one_dimension, two_dimension };
+enum CopyDimension { one_dimension, two_dimension, three_dimension };
 
 class MemoryCopyExecution : public MemoryAllocation {
   public:
@@ -333,6 +333,12 @@ class MemoryCopyExecution : public MemoryAllocation {
                 srcCols = node["src_cols"].as<uint32_t>();
                 dstRows = node["dst_rows"].as<uint32_t>();
                 dstCols = node["dst_cols"].as<uint32_t>();
+            } else if (dim == "three_dimension") {
+                copyDimension = CopyDimension::three_dimension;
+                // Source and destination share the slice pitch, so they have the same shape
+                srcRows = dstRows = node["rows"].as<uint32_t>();
+                srcCols = dstCols = node["cols"].as<uint32_t>();
+                slices = node["slices"].as<uint32_t>();
             }
         }
     }
@@ -349,6 +355,8 @@ class MemoryCopyExecution : public MemoryAllocation {
     uint32_t srcCols = 0u;
     uint32_t dstRows = 0u;
     uint32_t dstCols = 0u;
+    // 3D region
+    uint32_t slices = 0u;
 
     size_t srcSizeInBytes = 0u;
     size_t dstSizeInBytes = 0u;
@@ -380,6 +388,7 @@ static std::vector<YAML::Node> getMemoryCopyExecutionParameters() {
         YAML::Load("{ dimension: one_dimension, src_num_elements: 10, dst_num_elements: 7 }"),
         YAML::Load(
             "{ dimension: two_dimension, src_rows: 6, src_cols: 6, dst_rows: 4, dst_cols: 6 }"),
+        YAML::Load("{ dimension: three_dimension, rows: 4, cols: 4, slices: 3 }"),
     };
 }
 
@@ -496,6 +505,42 @@ TEST_P(MemoryCopyExecution, AppendMemoryCopyRegion) {
         }
         TRACE("\n");
     } break;
+    case CopyDimension::three_dimension: {
+        // Allocate slices of rows x cols matrices as source and destination buffers
+        srcSizeInBytes = slices * srcRows * srcCols * sizeof(uint64_t);
+        dstSizeInBytes = slices * dstRows * dstCols * sizeof(uint64_t);
+
+        srcMem = AllocSharedMemory(srcSizeInBytes);
+        dstMem = AllocSharedMemory(dstSizeInBytes);
+
+        srcArray = reinterpret_cast<uint64_t *>(srcMem.get());
+        dstArray = reinterpret_cast<uint64_t *>(dstMem.get());
+
+        DataHandle::generateRandomData(srcArray, srcSizeInBytes);
+        memset(dstArray, 0, dstSizeInBytes);
+
+        // Define the source region: 2x2x2 block
+        // Source region starts at slice 1, row 1, column 1
+        srcRegion.originX = 1 * sizeof(uint64_t);
+        srcRegion.originY = 1;
+        srcRegion.originZ = 1;
+        srcRegion.width = 2 * sizeof(uint64_t);
+        srcRegion.height = 2;
+        srcRegion.depth = 2;
+
+        // Destination region starts at slice 0, row 0, column 2
+        dstRegion.originX = 2 * sizeof(uint64_t);
+        dstRegion.originY = 0;
+        dstRegion.originZ = 0;
+        dstRegion.width = 2 * sizeof(uint64_t);
+        dstRegion.height = 2;
+        dstRegion.depth = 2;
+
+        // The pitch is the full row size, the slice pitch is the full matrix size
+        srcPitchInBytes = srcCols * sizeof(uint64_t);
+        dstPitchInBytes = dstCols * sizeof(uint64_t);
+        slicePitchInBytes = srcRows * srcPitchInBytes;
+    } break;
     default:
         break;
     }
@@ -547,6 +592,27 @@ TEST_P(MemoryCopyExecution, AppendMemoryCopyRegion) {
             EXPECT_EQ(memcmp(srcArray + srcOffset, dstArray + dstOffset, dstRegion.width), 0);
         }
     } break;
+    case CopyDimension::three_dimension: {
+        // Verification of the copied region, offsets are in bytes
+        auto *srcBytes = reinterpret_cast<const uint8_t *>(srcArray);
+        auto *dstBytes = reinterpret_cast<const uint8_t *>(dstArray);
+        for (uint32_t z = 0; z < dstRegion.depth; z++) {
+            for (uint32_t y = 0; y < dstRegion.height; y++) {
+                size_t srcOffset = srcRegion.originX +
+                                   (srcRegion.originY + y) * srcPitchInBytes +
+                                   (srcRegion.originZ + z) * slicePitchInBytes;
+                size_t dstOffset = dstRegion.originX +
+                                   (dstRegion.originY + y) * dstPitchInBytes +
+                                   (dstRegion.originZ + z) * slicePitchInBytes;
+                EXPECT_EQ(memcmp(srcBytes + srcOffset, dstBytes + dstOffset, dstRegion.width),
+                          0);
+            }
+        }
+
+        // Memory outside of the destination region is not written
+        EXPECT_EQ(dstArray[0], 0u);
+        EXPECT_EQ(dstArray[dstSizeInBytes / sizeof(uint64_t) - 1], 0u);
+    } break;
     default:
         break;
     }